@@ -260,6 +260,10 @@ minibuffer-prompt-properties--setter
 	     ;; fileio.c
 	     (delete-by-moving-to-trash auto-save boolean "23.1")
 	     (auto-save-visited-file-name auto-save boolean)
+	     (large-file-map-threshold files
+				       (choice integer
+					       (const :tag "Never" nil))
+				       "27.1")
 	     ;; filelock.c
 	     (create-lockfiles files boolean "24.3")
 	     (temporary-file-directory
@@ -508,6 +512,10 @@ minibuffer-prompt-properties--setter
 since it could result in memory overflow and make Emacs crash."
 					      nil))
 			       "27.1")
+	     (undo-log-limit undo
+			     (choice (const :tag "Use the undo list" nil)
+				     integer)
+			     "27.1")
 	     ;; window.c
 	     (temp-buffer-show-function windows (choice (const nil) function))
 	     (next-screen-context-lines windows integer)
@@ -251,6 +251,68 @@ string-remove-suffix
       (substring string 0 (- (length string) (length suffix)))
     string))
 
+;;;; String builders.
+
+(cl-defstruct (string-builder
+               (:constructor make-string-builder ())
+               (:conc-name string-builder--)
+               (:copier nil))
+  "An object that accumulates a string piece by piece.
+Appending with `string-builder-append' takes time proportional to the
+text appended, whereas repeatedly calling `concat' or `format' on the
+accumulated string copies all of it each time."
+  (joined nil :documentation "Strings made of joined pieces, last first.")
+  (pieces nil :documentation "Pieces appended since the last join, last first.")
+  (count 0 :documentation "The number of elements of PIECES.")
+  (length 0 :documentation "The total number of characters appended."))
+
+(defconst string-builder--join-count 256
+  "Join this many pending pieces of a string builder into one string.
+This keeps builders fed with many small pieces compact, while copying
+each character only once more.")
+
+(defun string-builder--push (builder piece)
+  "Add the string PIECE to the end of BUILDER."
+  (push piece (string-builder--pieces builder))
+  (cl-incf (string-builder--length builder) (length piece))
+  (when (>= (cl-incf (string-builder--count builder))
+            string-builder--join-count)
+    (push (apply #'concat (nreverse (string-builder--pieces builder)))
+          (string-builder--joined builder))
+    (setf (string-builder--pieces builder) nil)
+    (setf (string-builder--count builder) 0)))
+
+(defun string-builder-append (builder &rest objects)
+  "Append OBJECTS to the string being built by BUILDER.
+Each of OBJECTS should be a string or a character.  Text properties
+of strings are kept, so `propertize' can be used to add text with
+properties, and multibyte and unibyte text can be mixed as with
+`concat'.  Return BUILDER."
+  (dolist (object objects)
+    (cond ((stringp object)
+           (unless (equal object "")
+             (string-builder--push builder object)))
+          ((characterp object)
+           (string-builder--push builder (string object)))
+          (t (signal 'wrong-type-argument (list 'char-or-string-p object)))))
+  builder)
+
+(defun string-builder-append-number (builder number)
+  "Append the decimal representation of NUMBER to BUILDER.
+Return BUILDER."
+  (string-builder--push builder (number-to-string number))
+  builder)
+
+(defsubst string-builder-length (builder)
+  "Return the number of characters appended to BUILDER so far."
+  (string-builder--length builder))
+
+(defun string-builder-string (builder)
+  "Return a new string with the contents appended to BUILDER so far.
+BUILDER can still be appended to afterwards."
+  (apply #'concat (reverse (append (string-builder--pieces builder)
+                                   (string-builder--joined builder)))))
+
 (defun replace-region-contents (beg end replace-fn
                                     &optional max-secs max-costs)
   "Replace the region between BEG and END using REPLACE-FN.
@@ -2228,7 +2228,12 @@ find-file-noselect
                      (file-attribute-size attributes) "open" filename t)
                     'raw)
             (setf rawfile t))
-	  (warn-maybe-out-of-memory (file-attribute-size attributes)))
+	  ;; A file visited literally may be mapped rather than read.
+	  (unless (and rawfile (natnump large-file-map-threshold)
+		       (natnump (file-attribute-size attributes))
+		       (>= (file-attribute-size attributes)
+			   large-file-map-threshold))
+	    (warn-maybe-out-of-memory (file-attribute-size attributes))))
 	(if buf
 	    ;; We are using an existing buffer.
 	    (let (nonexistent)
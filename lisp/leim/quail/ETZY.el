@@ -0,0 +1,1547 @@
+;; Quail package `chinese-etzy
+;;   Generated by the command `titdic-convert'
+;;	Original TIT dictionary file: ETZY.tit
+
+;; # -*- coding: cn-big5 -*-
+;; # HANZI input table for cxterm
+;; # Generated from ETZY.cit by cit2tit
+;; # To be used by cxterm, convert me to .cit format first
+;; # .cit version 1
+;; ENCODE:	BIG5
+;; MULTICHOICE:	YES
+;; PROMPT:	中文輸入【倚天注音】
+;; #
+;; COMMENT Copyright (c) 1997, 2001 Wei-Chung Hwang <wchwang@csie.nctu.edu.tw>
+;; COMMENT 
+;; COMMENT Permission to copy and distribute both modified and unmodified
+;; COMMENT versions is granted without royalty provided this notice is preserved.
+;; COMMENT 
+;; COMMENT Contructed by Wei-Chung Hwang (黃維中)  <wchwang@csie.nctu.edu.tw>
+;; COMMENT Made available in TANET at OCT 15, 1992.
+;; COMMENT 
+;; COMMENT In Taipei(ETen) Big5 coding (eg. used with taipei15,taipei20)
+;; COMMENT 
+;; COMMENT 鍵盤採用倚天鍵盤注音符號排列方式。
+;; COMMENT
+;; COMMENT 注音: ㄅ ㄆ ㄇ ㄈ ㄉ ㄊ ㄋ ㄌ ㄍ ㄎ ㄏ ㄐ ㄑ ㄒ ㄓ ㄔ ㄕ ㄖ ㄗ ㄘ ㄙ
+;; COMMENT 鍵盤:  b  p  m  f  d  t  n  l  v  k  h  g  7  c  ,  .  /  j  ;  '  s
+;; COMMENT
+;; COMMENT 注音: ㄚ ㄛ ㄜ ㄝ ㄞ ㄟ ㄠ ㄡ ㄢ ㄣ ㄤ ㄥ ㄦ ㄧ ㄨ ㄩ
+;; COMMENT 鍵盤:  a  o  r  w  i  q  z  y  8  9  0  -  =  e  x  u
+;; COMMENT
+;; COMMENT 聲調: 陰平(　)  陽平(ˊ)  上聲(ˇ)  去聲(ˋ)  輕聲(˙)
+;; COMMENT 鍵盤:  space         2         3         4        1 
+;; COMMENT
+;; COMMENT         鍵盤注音符號排列圖      
+;; COMMENT +----+----+----+----+----+----+----+----+----+----+----+----+--
+;; COMMENT |1   |2   |3   |4   |    |    |7   |8   |9   |0   |-   |=   |
+;; COMMENT |輕聲|陽平|上聲|去聲|    |    |  ㄑ|  ㄢ|  ㄣ|  ㄤ|  ㄥ|  ㄦ|
+;; COMMENT ++---++---++---++---++---++---++---++---++---++---++---+----+-
+;; COMMENT  |Q   |W   |E   |R   |T   |Y   |U   |I   |O   |P   |
+;; COMMENT  |  ㄟ|  ㄝ|  ㄧ|  ㄜ|  ㄊ|  ㄡ|  ㄩ|  ㄞ|  ㄛ|  ㄆ|
+;; COMMENT  ++---++---++---++---++---++---++---++---++---++---++----+
+;; COMMENT   |A   |S   |D   |F   |G   |H   |J   |K   |L   |;   |'   |
+;; COMMENT   |  ㄚ|  ㄙ|  ㄉ|  ㄈ|  ㄐ|  ㄏ|  ㄖ|  ㄎ|  ㄌ|  ㄗ|  ㄘ|
+;; COMMENT   ++---++---++---++---++---++---++---++---++---++---++---+
+;; COMMENT    |Z   |X   |C   |V   |B   |N   |M   |,   |.   |/   |
+;; COMMENT    |  ㄠ|  ㄨ|  ㄒ|  ㄍ|  ㄅ|  ㄋ|  ㄇ|  ㄓ|  ㄔ|  ㄕ|
+;; COMMENT    +----+----+----+----+----+----+----+----+----+----+
+;; COMMENT         |         (SPACE BAR)                      |
+;; COMMENT         |                      陰平                |
+;; COMMENT         +------------------------------------------+
+;; # define keys
+;; VALIDINPUTKEY:	\040',-./01234789;=abcdefghijklmnopqrstuvwxyz
+;; SELECTKEY:	1
+;; SELECTKEY:	2
+;; SELECTKEY:	3
+;; SELECTKEY:	4
+;; SELECTKEY:	5
+;; SELECTKEY:	6
+;; SELECTKEY:	7
+;; SELECTKEY:	8
+;; SELECTKEY:	9
+;; SELECTKEY:	0
+;; BACKSPACE:	\010\177
+;; DELETEALL:	\015\025
+;; MOVERIGHT:	>
+;; MOVELEFT:	<
+;; REPEATKEY:	\020\022
+;; KEYPROMPT(\040):	　
+;; KEYPROMPT('):	ㄘ
+;; KEYPROMPT(,):	ㄓ
+;; KEYPROMPT(-):	ㄥ
+;; KEYPROMPT(.):	ㄔ
+;; KEYPROMPT(/):	ㄕ
+;; KEYPROMPT(0):	ㄤ
+;; KEYPROMPT(1):	˙
+;; KEYPROMPT(2):	ˊ
+;; KEYPROMPT(3):	ˇ
+;; KEYPROMPT(4):	ˋ
+;; KEYPROMPT(7):	ㄑ
+;; KEYPROMPT(8):	ㄢ
+;; KEYPROMPT(9):	ㄣ
+;; KEYPROMPT(;):	ㄗ
+;; KEYPROMPT(=):	ㄦ
+;; KEYPROMPT(a):	ㄚ
+;; KEYPROMPT(b):	ㄅ
+;; KEYPROMPT(c):	ㄒ
+;; KEYPROMPT(d):	ㄉ
+;; KEYPROMPT(e):	ㄧ
+;; KEYPROMPT(f):	ㄈ
+;; KEYPROMPT(g):	ㄐ
+;; KEYPROMPT(h):	ㄏ
+;; KEYPROMPT(i):	ㄞ
+;; KEYPROMPT(j):	ㄖ
+;; KEYPROMPT(k):	ㄎ
+;; KEYPROMPT(l):	ㄌ
+;; KEYPROMPT(m):	ㄇ
+;; KEYPROMPT(n):	ㄋ
+;; KEYPROMPT(o):	ㄛ
+;; KEYPROMPT(p):	ㄆ
+;; KEYPROMPT(q):	ㄟ
+;; KEYPROMPT(r):	ㄜ
+;; KEYPROMPT(s):	ㄙ
+;; KEYPROMPT(t):	ㄊ
+;; KEYPROMPT(u):	ㄩ
+;; KEYPROMPT(v):	ㄍ
+;; KEYPROMPT(w):	ㄝ
+;; KEYPROMPT(x):	ㄨ
+;; KEYPROMPT(y):	ㄡ
+;; KEYPROMPT(z):	ㄠ
+;; # the following line must not be removed
+;; BEGINDICTIONARY
+
+;;; End of the header of original TIT dictionary.
+
+;;; Code:
+
+(require 'quail)
+
+(quail-define-package "chinese-etzy" "Chinese-BIG5" "倚注"
+ '(   (122 . "ㄠ")
+   (121 . "ㄡ")
+   (120 . "ㄨ")
+   (119 . "ㄝ")
+   (118 . "ㄍ")
+   (117 . "ㄩ")
+   (116 . "ㄊ")
+   (115 . "ㄙ")
+   (114 . "ㄜ")
+   (113 . "ㄟ")
+   (112 . "ㄆ")
+   (111 . "ㄛ")
+   (110 . "ㄋ")
+   (109 . "ㄇ")
+   (108 . "ㄌ")
+   (107 . "ㄎ")
+   (106 . "ㄖ")
+   (105 . "ㄞ")
+   (104 . "ㄏ")
+   (103 . "ㄐ")
+   (102 . "ㄈ")
+   (101 . "ㄧ")
+   (100 . "ㄉ")
+   (99 . "ㄒ")
+   (98 . "ㄅ")
+   (97 . "ㄚ")
+   (61 . "ㄦ")
+   (59 . "ㄗ")
+   (57 . "ㄣ")
+   (56 . "ㄢ")
+   (55 . "ㄑ")
+   (52 . "ˋ")
+   (51 . "ˇ")
+   (50 . "ˊ")
+   (49 . "˙")
+   (48 . "ㄤ")
+   (47 . "ㄕ")
+   (46 . "ㄔ")
+   (45 . "ㄥ")
+   (44 . "ㄓ")
+   (39 . "ㄘ")
+   (32 . "　")
+)"中文輸入【倚天注音】
+
+ Copyright (c) 1997, 2001 Wei-Chung Hwang <wchwang@csie.nctu.edu.tw>
+ 
+ Permission to copy and distribute both modified and unmodified
+ versions is granted without royalty provided this notice is preserved.
+ 
+ Contructed by Wei-Chung Hwang (黃維中)  <wchwang@csie.nctu.edu.tw>
+ Made available in TANET at OCT 15, 1992.
+ 
+ In Taipei(ETen) Big5 coding (eg. used with taipei15,taipei20)
+ 
+ 鍵盤採用倚天鍵盤注音符號排列方式。
+
+ 注音: ㄅ ㄆ ㄇ ㄈ ㄉ ㄊ ㄋ ㄌ ㄍ ㄎ ㄏ ㄐ ㄑ ㄒ ㄓ ㄔ ㄕ ㄖ ㄗ ㄘ ㄙ
+ 鍵盤:  b  p  m  f  d  t  n  l  v  k  h  g  7  c  ,  .  /  j  ;  '  s
+
+ 注音: ㄚ ㄛ ㄜ ㄝ ㄞ ㄟ ㄠ ㄡ ㄢ ㄣ ㄤ ㄥ ㄦ ㄧ ㄨ ㄩ
+ 鍵盤:  a  o  r  w  i  q  z  y  8  9  0  -  =  e  x  u
+
+ 聲調: 陰平(　)  陽平(ˊ)  上聲(ˇ)  去聲(ˋ)  輕聲(˙)
+ 鍵盤:  space         2         3         4        1 
+
+         鍵盤注音符號排列圖      
+ +----+----+----+----+----+----+----+----+----+----+----+----+--
+ |1   |2   |3   |4   |    |    |7   |8   |9   |0   |-   |=   |
+ |輕聲|陽平|上聲|去聲|    |    |  ㄑ|  ㄢ|  ㄣ|  ㄤ|  ㄥ|  ㄦ|
+ ++---++---++---++---++---++---++---++---++---++---++---+----+-
+  |Q   |W   |E   |R   |T   |Y   |U   |I   |O   |P   |
+  |  ㄟ|  ㄝ|  ㄧ|  ㄜ|  ㄊ|  ㄡ|  ㄩ|  ㄞ|  ㄛ|  ㄆ|
+  ++---++---++---++---++---++---++---++---++---++---++----+
+   |A   |S   |D   |F   |G   |H   |J   |K   |L   |;   |'   |
+   |  ㄚ|  ㄙ|  ㄉ|  ㄈ|  ㄐ|  ㄏ|  ㄖ|  ㄎ|  ㄌ|  ㄗ|  ㄘ|
+   ++---++---++---++---++---++---++---++---++---++---++---+
+    |Z   |X   |C   |V   |B   |N   |M   |,   |.   |/   |
+    |  ㄠ|  ㄨ|  ㄒ|  ㄍ|  ㄅ|  ㄋ|  ㄇ|  ㄓ|  ㄔ|  ㄕ|
+    +----+----+----+----+----+----+----+----+----+----+
+         |         (SPACE BAR)                      |
+         |                      陰平                |
+         +------------------------------------------+
+
+Zhuyin base input method for Chinese Big5 characters (`chinese-big5-1',
+`chinese-big5-2').
+
+Zhuyin is a kind of phonetic symbol.  One to three Zhuyin symbols
+compose one Chinese character.
+
+In this input method, you enter a Chinese character by first typing
+keys corresponding to Zhuyin symbols (see the above table) followed by
+SPC, 1, 2, 3, or 4 specifying a tone (SPC:陰平, 1:輕聲, 2:陽平, 3: 上聲,
+4:去聲).
+
+\\<quail-translation-docstring>
+"
+ '(("\C-?" . quail-delete-last-char)
+   
+   (">" . quail-next-translation)
+   ("<" . quail-prev-translation))
+ nil nil nil nil)
+
+(quail-define-rules
+("' " "疵庛雌ㄘ差趀骴")
+("'- " "噌")
+("'-2" "曾層嶒鄫碀")
+("'-4" "蹭")
+("'0 " "蒼倉滄艙傖鶬凔嵢")
+("'02" "藏鑶")
+("'2" "詞辭慈磁瓷雌祠疵茨粢餈柌嬨濨呲飺薋")
+("'3" "此佌泚玼跐皉")
+("'4" "次刺賜廁伺佽蛓莿朿栨蚝絘")
+("'8 " "參餐驂")
+("'82" "殘蠶慚嬠")
+("'83" "慘憯朁噆黲")
+("'84" "燦孱璨粲澯")
+("'9 " "參嵾梫")
+("'92" "岑涔梣笒埁")
+("'a " "擦搽嚓")
+("'a3" "礤")
+("'a4" "囃")
+("'i " "猜")
+("'i2" "才財材裁纔")
+("'i3" "採彩采睬踩綵跴寀棌婇")
+("'i4" "蔡菜埰采縩")
+("'r4" "冊策測側廁惻筴畟茦粣拺矠憡蓛")
+("'x " "粗麤觕")
+("'x- " "匆聰從囪璁瑽樅驄蓯鏦熜棇暰蔥瞛蟌鍐")
+("'x-2" "從叢淙琮悰潀漎賨錝婃孮徖慒")
+("'x-4" "欉藂謥")
+("'x2" "殂徂")
+("'x4" "促醋簇蹴蔟蹙猝卒錯趣趨鏃瘯踧槭梀噈殧鼀")
+("'x8 " "攛躥鋑")
+("'x82" "攢巑劗")
+("'x84" "竄篡爨篹")
+("'x9 " "村皴")
+("'x92" "存袸")
+("'x93" "忖刌")
+("'x94" "寸吋籿")
+("'xo " "搓撮磋蹉蒫遳髊")
+("'xo2" "瘥矬鹺痤醝嵯蔖")
+("'xo3" "瑳脞縒硰")
+("'xo4" "錯措挫銼撮剉厝莝侳剒齰蓌")
+("'xq " "摧催崔嗺墔磪鏙榱衰")
+("'xq2" "凗慛")
+("'xq3" "璀趡漼")
+("'xq4" "翠脆粹悴瘁萃啐淬倅毳橇焠竁膬綷膵脺濢")
+("'y4" "湊輳腠楱")
+("'z " "操糙鄵喿")
+("'z2" "曹槽嘈漕螬艚嶆")
+("'z3" "草懆騲艸")
+("'z4" "糙操肏襙")
+(", " "之知隻織支枝汁只吱芝脂肢蜘祇梔祗氏枳ㄓ胝鴟卮搘秖跖泜鳷汥秪榰胑衼椥")
+(",- " "爭征蒸睜徵掙箏正怔猙錚崢諍癥鉦烝篜姃炡埩聇丁眐")
+(",-3" "整拯氶撜糽")
+(",-4" "鄭正證政証症掙幀")
+(",0 " "張章彰漳樟璋獐嫜暲鄣蟑鱆慞傽墇騿遧")
+(",03" "長掌漲仉鞝")
+(",04" "丈仗帳障賬脹杖漲長幛瘴嶂扙瞕粀")
+(",2" "直職質值植執殖擲姪侄蹠蟄躑桎埴稙摭縶柣犆秷擿馽慹樴膱懫蟙褁瓡嬂蘵")
+(",3" "只指紙止旨址徵祇趾祉咫枳酯恉沚阯芷黹軹疻晊厎坁藢栺淽滍")
+(",4" "至制治志製致置智秩誌稚質峙緻幟滯摯窒炙痔雉識懥痣輊騭帙陟知寘忮桎躓蛭贄鷙厔鑕豸庤彘猘畤疐紩觶郅銍偫跱遰鋕櫍袟騺淛狾礩胵膣螲挃洷覟庢鴙迣翐臸駤祑觢鴩")
+(",8 " "詹沾瞻氈霑旃譫鱣覘邅栴鸇驙占呫饘鉆詀薝譠")
+(",83" "展斬盞輾搌嶄琖魙醆颭樿皽蹍嫸榐橏")
+(",84" "佔戰站暫占棧顫湛綻蹔蘸虥轏輚偡")
+(",9 " "真針珍貞偵禎斟箴砧甄臻楨榛診蓁獉溱碪胗鍼鱵媜駗薽禛樼潧瑊遉寊蒧轃籈鷏堻")
+(",93" "診枕疹軫畛袗縝稹紾鬒眕黰辴抮抌笉絼祳晸縥黕")
+(",94" "鎮陣振震賑朕枕鴆揕酖眹娠侲挋栚蜄桭誫敶")
+(",a " "渣扎喳楂查齇柤皻抯挓樝謯")
+(",a2" "扎札紮閘炸霅鍘哳劄蚻譗蠿")
+(",a3" "眨渣鮓厏苲")
+(",a4" "榨柵炸詐乍搾蚱咋蜡吒溠砟醡鮓痄簎")
+(",i " "摘齋齊捚")
+(",i2" "宅翟")
+(",i3" "窄岝")
+(",i4" "債寨祭責瘵砦")
+(",r " "遮螫晢嫬")
+(",r1" "著遮晢嫬")
+(",r2" "折哲摺懾褶謫輒摘轍慴蜇磔乇讋晢鮿耴悊砓謺虴鸅讘瓋")
+(",r3" "者赭鍺")
+(",r4" "這浙蔗鷓柘宅檡烢蟅")
+(",x " "珠朱諸株豬蛛茱硃誅銖侏洙瀦邾櫫櫧祩藷絑袾觰鴸蠩蝫鮢藸")
+(",x- " "中鐘終忠鍾衷忪盅螽伀妐蔠柊煄彸舯炂籦")
+(",x-3" "種腫塚踵冢")
+(",x-4" "中種重仲眾尰湩狆衶偅堹緟")
+(",x0 " "裝莊樁妝粧庄梉")
+(",x03" "奘")
+(",x04" "狀壯撞戇焋")
+(",x2" "竹築逐燭蠋筑竺朮躅舳軸窋蓫笁趉鱁灟蠾茿篫")
+(",x3" "主屬煮囑貯渚矚著麈拄瘃斸砫陼孎壴罜欘泞眝")
+(",x4" "住著助注祝駐註柱蛀鑄炷苧佇箸杼紵翥宁柷羜馵疰莇鉒紸嵀跓軴樦麆櫡殶諔")
+(",x8 " "專磚耑顓塼鄟鱄剸嫥瑼篿鷒膞蟤")
+(",x83" "轉囀")
+(",x84" "傳賺篆撰譔饌轉僎瑑縳腞")
+(",x9 " "諄屯肫窀迍宒訰")
+(",x93" "準准隼埻綧")
+(",x94" "稕")
+(",xa " "抓撾髽檛")
+(",xa3" "爪")
+(",xi " "拽")
+(",xi3" "跩")
+(",xi4" "拽")
+(",xo " "捉桌涿棹穛")
+(",xo2" "卓茁濁拙濯酌灼著啄鐲擢琢諑倬斲斮梲椓焯蝃踔鷟彴汋斫禚篧浞棳謶錣啅罬斀蠗圴剢灂")
+(",xq " "追錐椎隹騅鵻腄鴭")
+(",xq3" "沝")
+(",xq4" "綴墜贅縋惴餟硾膇鑆")
+(",y " "周週州洲舟粥賙啁盩譸輈喌騆鵃洀淍銂珘徟輖侜婤")
+(",y2" "軸妯")
+(",y3" "帚肘睭鯞")
+(",y4" "晝皺宙紂縐冑咒繇甃籀咮酎僽怞胄噣駎")
+(",z " "朝招昭召著嘲釗駋鉊晁盄鍣妱")
+(",z2" "著")
+(",z3" "找沼爪菬瑵")
+(",z4" "照趙召罩兆肇詔晁笊櫂炤雿狣棹箌鵫垗旐曌")
+("- " "鞥ㄥ")
+(". " "吃蚩癡痴嗤喫ㄔ郗魑笞絺鴟媸摛瓻螭眵齝离貾誺瞝齹黐麶")
+(".- " "稱撐瞠蟶偁檉赬琤橕鏿浾埥棦牚竀崝饓")
+(".-2" "成程承盛乘誠呈城懲澄橙丞澂棖酲宬晟裎郕埕掁湞珵荿騬脀脭揨峸鋮塍")
+(".-3" "逞騁悜庱塣")
+(".-4" "稱秤偁牚")
+(".0 " "昌倡猖娼閶菖鯧倀鼚錩淐琩裮")
+(".02" "長常場嘗裳償腸嫦鱨徜嚐萇鋿粻")
+(".03" "場廠敞氅昶鋹")
+(".04" "唱倡暢悵鬯韔")
+(".2" "持池遲馳匙弛墀坻踟箎茬蚳篪蚔茌痄忯汦荎栘歭耛貾趍箈徲謘徥")
+(".3" "尺齒恥呎侈褫欼搋蚇恀拸姼傂誃鉹伬鶒")
+(".4" "赤翅斥飭叱熾啻傺敕眙抶饎栻遫彳跮踅鷘乿瘛鉓哧淔痸懘戠摰")
+(".8 " "摻攙梴襜辿鋓惉嬓欃")
+(".82" "纏蟬禪饞讒潺蟾巉嬋單澶廛孱劖毚瀍瀺躔鑱磛艬僝棎湹鋋煘獑繵嚵酁")
+(".83" "產鏟闡剷蕆嘽囅丳嵼燀諂驏幝繟滻簅灛旵譂")
+(".84" "懺羼儳")
+(".9 " "嗔琛瞋郴賝棽謓諃搷堔")
+(".92" "陳沉晨臣塵辰娠忱沈宸諶煁茞蔯樄莐愖鈂螴麎鷐伔敶")
+(".93" "捵磣鍖裖墋踸贂")
+(".94" "趁稱襯櫬讖疢齔嚫藽儭")
+(".a " "差插叉喳艖嗏扠杈偛疀鎈")
+(".a2" "查察茶搽槎鍤碴臿垞秅")
+(".a3" "蹅")
+(".a4" "詫岔剎差汊衩蜡侘奼紁")
+(".i " "拆釵差偨")
+(".i2" "柴豺儕祡喍")
+(".i4" "蠆袃囆")
+(".r " "車硨莗")
+(".r3" "扯撦奲")
+(".r4" "徹澈轍撤掣坼屮迠硩")
+(".x " "出初齣貙")
+(".x- " "充衝沖舂忡憧珫茺浺蹖祌")
+(".x-2" "重崇虫蟲种翀蝩隀茧痋")
+(".x-3" "寵")
+(".x-4" "衝銃揰")
+(".x0 " "窗創瘡囪憃戧摐")
+(".x02" "床幢撞橦")
+(".x03" "闖搶漺")
+(".x04" "創闖愴刱獊")
+(".x2" "除儲廚鋤櫥雛芻躇滁躕篨耡蜍鉏蒢跦鶵幮貙趎犓")
+(".x3" "處楚儲礎杵褚楮濋檚")
+(".x4" "處觸畜絀矗黜俶怵搐歜詘鄐斶亍豖泏琡踀滀儊臅敊")
+(".x8 " "穿川鐉氚瑏")
+(".x82" "傳船遄椽歂諯暷輲")
+(".x83" "喘舛荈")
+(".x84" "串釧玔汌夼賗")
+(".x9 " "春椿杶輴焞鰆媋暙鶞")
+(".x92" "純唇醇淳蓴鶉漘錞韕脣憌鯙")
+(".x93" "蠢惷踳偆萶")
+(".xa " "欻")
+(".xi2" "膗")
+(".xi3" "揣")
+(".xi4" "踹嘬")
+(".xo " "戳")
+(".xo4" "綽輟齪婼啜惙歠醊婥畷逴娖吷珿磭腏趠擉嚽")
+(".xq " "吹炊")
+(".xq2" "垂鎚槌搥椎陲錘捶棰箠圌湷倕菙綞娷腄甀")
+(".xq4" "吹炊諈")
+(".y " "抽瘳搊篘犨婤")
+(".y2" "愁仇籌綢酬稠紬躊疇惆裯儔讎幬鯈薵嬦椆絒菗懤詶雔燽栦")
+(".y3" "丑醜瞅杻杽吜莥")
+(".y4" "臭簉溴殠憱")
+(".z " "抄鈔超勦弨怊訬剿罺")
+(".z2" "朝潮巢嘲晁樔轈鄛")
+(".z3" "吵炒眧")
+(".z4" "耖")
+("/ " "失施師詩濕溼獅屍ㄕ蝨噓虱尸迉蓍葹鳲邿湤絁鰤溮鶳箷褷襹螄")
+("/- " "生聲勝升牲昇甥笙陞泩鉎鼪呏狌湦焺鵿")
+("/-2" "繩澠憴譝鱦溗")
+("/-3" "省眚冼箵偗")
+("/-4" "勝盛聖剩嵊乘賸圣貹")
+("/0 " "商傷殤觴湯漡蔏螪謪鬺")
+("/01" "裳")
+("/03" "賞晌上")
+("/04" "上尚爙姠仩")
+("/1" "匙")
+("/2" "十什石時實食拾蝕碩射提蒔湜鰣塒祏鼫鉐榯湁溡鼭寔")
+("/3" "使始史駛矢屎豕")
+("/4" "市是事世士勢識室示試視式氏適釋飾侍誓逝嗜恃仕柿使螫弒噬拭豉媞筮舐軾諡貰奭戺澨諟襫鈰揓鉽唑翨銴謚遾簭鯷齛跩烒崼徥詍戠褆衋")
+("/8 " "山扇衫杉刪珊羶舢煽潸跚姍芟苫搧縿穇挻烻狦笘剼")
+("/83" "閃陝睒晱覢")
+("/84" "善扇汕擅膳繕鄯煽訕單贍疝鱔騸禪墠嬗掞摲謆墡釤蟺赸儃")
+("/9 " "身深伸申紳呻信參蔘娠莘甡侁籸葠詵駪燊砷柛氠屾珅胂阠妽峷眒")
+("/92" "神甚")
+("/93" "沈審嬸瀋諗讅矧哂寀瞫邥覾")
+("/94" "慎腎滲甚蜃沁葚椹脤抻侺鋠")
+("/a " "殺沙紗砂莎煞鯊裟杉痧鎩魦樧猀帴摋蔱硰")
+("/a2" "啥")
+("/a3" "傻繌")
+("/a4" "煞霎廈嗄歃箑翣萐喢")
+("/i " "篩")
+("/i3" "骰繺")
+("/i4" "曬晒閷殺")
+("/q2" "誰")
+("/r " "奢賒奓檨譇")
+("/r2" "蛇舌甚佘什揲鉈")
+("/r3" "捨舍")
+("/r4" "社設射涉舍攝赦歙麝厙猞灄蔎韘騇拾葉捑蠂")
+("/x " "書輸殊舒梳疏蔬樞紓抒攄姝樗摴殳杸陎綀橾祋軗鵨藲")
+("/x0 " "雙霜孀艭驦鷞孇礵")
+("/x03" "爽塽樉漺慡縔")
+("/x04" "灀")
+("/x2" "叔熟淑塾贖孰菽秫襡埱焂跾鸀虪")
+("/x3" "數鼠屬暑署薯蜀黍癙潻藷钃婌襩糬韣")
+("/x4" "術數樹束述署豎疏恕庶曙墅漱倏戍澍翛沭裋鉥尌儵鏣鶐")
+("/x8 " "栓閂拴")
+("/x84" "涮")
+("/x93" "盾楯吮揗賰")
+("/x94" "順舜瞬蕣鬊瞚")
+("/xa " "刷唰鮛")
+("/xa3" "耍")
+("/xi " "摔衰縗孈")
+("/xi3" "甩")
+("/xi4" "率帥蟀咰繂")
+("/xo " "說")
+("/xo4" "朔碩爍數鑠嗍率蟀帥搠妁槊箾蒴勺欶揱獡鎙")
+("/xq2" "誰脽")
+("/xq3" "水")
+("/xq4" "說睡稅蛻帨涗裞")
+("/y " "收荍")
+("/y2" "熟")
+("/y3" "手首守掱艏")
+("/y4" "受售壽獸授瘦狩綬")
+("/z " "燒稍梢艄捎弰蛸莦筲旓髾輎鮹蕱")
+("/z2" "杓韶芍勺玿圴牊")
+("/z3" "少")
+("/z4" "少紹哨邵召卲劭袑睄潲")
+("0 " "骯腌ㄤ")
+("02" "昂卬")
+("03" "軮")
+("04" "盎醠")
+("7 " "ㄑ")
+("7e " "七妻欺戚漆棲悽淒柒萋慼溪沏諆郪娸鸂嘁顣悊榿磎倛咠栖谿凄唭徛桼僛緀磩霋魌鶈攲")
+("7e- " "清青輕傾卿氫蜻頃鯖圊氰狅郬")
+("7e-2" "情晴擎傾檠勍殑樈殌")
+("7e-3" "請頃廎")
+("7e-4" "慶罄親凊綮謦磬漀汫鑋靘掅碃罊")
+("7e0 " "槍腔鎗羌嗆搶鏘鏹蜣蹌斨瑲椌蹡錆矼嶈將牄謒")
+("7e02" "強牆薔戕墻嬙檣爿漒蘠廧彊")
+("7e03" "強搶襁磢傸墏繈")
+("7e04" "嗆羻唴熗蹌")
+("7e2" "其期齊奇旗騎祈棋祺碁祁崎琦岐歧琪麒鰭畦臍祇耆淇跂枝綦騏衹蘄圻錡旂萁蜞埼墘蠐頎懠艩蚔軝藄鄿鯕鬐蚑錤掑岓碕翗釮亓蚚稘鬿踑鮨鶀鵸玂麡濝")
+("7e3" "起啟豈乞綺杞稽綮屺棨敧芑婍邔芞呇")
+("7e4" "企氣器汽棄契砌泣迄訖汔憩緝亟葺磧栔愒妻蟿鏚盵蚑忔湆气諿湇甈鼜")
+("7e8 " "千鉛遷簽牽謙籤嵌仟阡韆騫愆僉慳搴褰粁岍汧縴芊掔扦檶鐱婜羥攐攓譣顩奷忏顅麉櫏")
+("7e82" "前錢乾潛黔鉗虔箝鈐掮媊揵燂拑鬵灊黚忴扲岒漧葥鳹騚鰬仱姏蚙軡榩")
+("7e83" "遣淺譴繾槏撖忏蜸")
+("7e84" "欠歉倩慊茜塹芡傔嗛槧縴篟綪棈蒨輤")
+("7e9 " "親侵欽衾駸嶔綅瀙鋟")
+("7e92" "勤琴秦禽擒芹檎懃噙芩螓鈙嫀斳耹靲澿庈肣蚙軡雂")
+("7e93" "寢昑寑曋螼坅顉")
+("7e94" "沁撳唚菣")
+("7ea " "掐")
+("7ea3" "卡酠")
+("7ea4" "恰洽帢愘殎")
+("7ew " "切沏")
+("7ew2" "茄伽癿")
+("7ew3" "且")
+("7ew4" "切竊妾怯愜挈篋鍥契朅踥鯜蛪緀藒洯")
+("7ey " "秋邱丘蚯鞦鰍鶖楸坵萩偢緧媝蓲趥龜恘蝵蟗蠤")
+("7ey2" "求球囚仇酋裘遒毬泅鰽逑俅厹璆絿艽虯蝤觩賕盚銶頄鼽訄犰朹梂釚煪苬紌脙莍崷僋蛷鮂鯄殏")
+("7ey3" "糗")
+("7ez " "敲鍬橇撬蹺磽蹻墝幧繑髜鐰鏒塙鄡墽骹庨郻頝")
+("7ez2" "橋瞧僑喬樵翹憔蕎礄譙簥趫燆劁嘺嫶趬敿")
+("7ez3" "巧悄愀鵲雀燋頝")
+("7ez4" "翹竅俏峭鞘誚撬蹺殼帩撽躈")
+("7u " "區屈驅趨軀嶇曲蛆瞿袪敺蛐佉砠胠岨祛呿凵抾阹镼魼鶌鱋紶髷")
+("7u- " "芎穹銎")
+("7u-2" "窮瓊芎穹跫蛩惸邛璚藭瞏煢筇輁藑桏赹笻橩蒆")
+("7u2" "渠劬麴衢蟝瞿籧璩氍蘧磲蕖朐軥鴝翑葋豦懅螶鼩匷灈欋臞蠷躣胊斪淭菃翵")
+("7u3" "取曲娶齲浀紶")
+("7u4" "去趣娶漆覷闃湨麮刞鼁")
+("7u8 " "圈悛棬弮絟惓")
+("7u82" "全權泉詮拳銓痊顴蜷筌卷荃鬈牷輇佺犬踡醛恮婘犈觠駩巏齤蠸姾瑔跧縓灥")
+("7u83" "犬綣甽畎琄虇汱圈")
+("7u84" "勸券牶烇絭")
+("7u9 " "逡踆峮")
+("7u92" "群裙宭")
+("7uw " "缺闕蒛")
+("7uw2" "瘸")
+("7uw4" "卻確鵲雀怯闕榷搉恪殼闋愨埆确碏碻礐硞皵毃礭")
+("8 " "安鞍庵諳氨銨胺ㄢ鵪媕侒盦峖痷腤萻韽垵")
+("82" "雸玵啽")
+("83" "俺唵晻堷")
+("84" "暗案岸按黯菴闇犴豻匼桉洝荌錌匎婩儑")
+("9 " "恩嗯ㄣ")
+("94" "摁")
+("; " "資茲滋吱姿咨孜諮貲玆ㄗ輜淄齜緇孳粢髭嵫菑鎡鶿鼒孖澬甾鄑鯔錙趑椔鈭鶅齍栥紎崰秶蠀")
+(";- " "曾增憎罾繒矰橧磳驓璔")
+(";-4" "贈甑")
+(";0 " "髒贓臢牂臧")
+(";03" "駔")
+(";04" "藏臟葬奘")
+(";1" "子")
+(";3" "子仔紫梓籽滓耔訾笫秭胏茈吇杍芓呰矷釨訿")
+(";4" "自字恣漬眥孳剚胔胾扻倳牸")
+(";8 " "簪鐕")
+(";82" "咱偺糌")
+(";83" "拶攢寁昝禶喒儹揝礸")
+(";84" "贊暫讚鏨瓚欑酇饡灒囋趲")
+(";93" "怎")
+(";94" "譖")
+(";a " "紮匝咂唼嘁抸鉔")
+(";a2" "雜咱砸偺雥磼")
+(";i " "災栽哉渽賳")
+(";i3" "仔宰崽載縡")
+(";i4" "在再載")
+(";q2" "賊")
+(";r2" "則責擇澤嘖窄舴咋幘笮賾迮崱萴謮蠌賊蠈")
+(";r3" "怎")
+(";r4" "仄側昃庂稄")
+(";x " "租蒩")
+(";x- " "宗蹤縱綜棕鬃豵騣鬷翪熧倧惾猣稯艐嵕蝬")
+(";x-3" "總摠傯熜朡蓗")
+(";x-4" "縱粽綜從瘲昮")
+(";x2" "足族卒嗾捽崒踿哫傶踤")
+(";x3" "組祖阻俎詛珇靻")
+(";x8 " "鑽躦")
+(";x83" "纂鑽纘籫儹")
+(";x84" "賺鑽攥饡")
+(";x9 " "尊遵樽墫鐏嶟繜鷷壿")
+(";x93" "撙噂墫僔譐")
+(";x94" "俊圳捘鱒銌燇")
+(";xo2" "昨作砟椊筰稓葃")
+(";xo3" "左佐繓")
+(";xo4" "做作坐座酢祚鑿柞怍胙阼葄夎")
+(";xq " "堆厜羧嶉纗")
+(";xq3" "嘴璻觜嶊噿濢")
+(";xq4" "最罪醉檇蕞晬檌絊祽鋷墬嶵")
+(";y " "鄒謅鄹諏啁掫菆陬騶鯫棸緅棷郰媰黀齱齺")
+(";y3" "走")
+(";y4" "奏驟揍")
+(";z " "遭糟蹧傮")
+(";z2" "鑿")
+(";z3" "早棗澡藻蚤璪繰")
+(";z4" "造皂燥噪慥譟灶躁皁趮矂")
+("= " "ㄦ兒")
+("=2" "兒而洏耏胹輀侕栭陑鮞檽聏荋唲鴯")
+("=3" "爾耳洱餌邇珥駬薾鉺峏尒栮")
+("=4" "二貳佴刵咡樲聏毦眲衈")
+("a " "阿啊ㄚ")
+("a1" "啊阿")
+("a4" "阿")
+("b " "ㄅ")
+("b- " "崩繃伻弸祊閍塴絣")
+("b-2" "甭")
+("b-3" "菶玤琫埲誁")
+("b-4" "蹦搒洴迸跰")
+("b0 " "幫邦傍梆鞤縍垹")
+("b03" "榜綁牓膀氆")
+("b04" "棒磅謗蚌傍鎊旁甏塝艕")
+("b8 " "班般搬斑頒扳瘢虨斒攽褩")
+("b83" "板版闆阪舨昄鈑粄蝂")
+("b84" "半辦伴扮拌絆姅瓣爿怑湴鉡靽")
+("b9 " "奔賁錛泍渀")
+("b93" "本畚苯")
+("b94" "笨体坌")
+("ba " "八捌巴疤芭笆粑叭扒豝吧仈朳")
+("ba1" "吧罷琶杷")
+("ba2" "拔跋鈸魃茇鼥軷犮菝胈詙")
+("ba3" "把靶鈀")
+("ba4" "罷爸霸壩耙弝灞伯猈")
+("be " "逼屄偪稫豍")
+("be- " "兵冰掤栟")
+("be-3" "餅丙稟柄秉炳昺邴怲鞞鉼蛃陃苪窉屏庰")
+("be-4" "並病併并摒寎鵧偋")
+("be2" "鼻")
+("be3" "比筆彼鄙匕沘秕屄蚍妣疕潷柀朼貏")
+("be4" "必敝畢壁避璧閉鄙臂幣弊婢斃碧泌祕俾蔽庇嗶愎辟弼裨陛埤箄篦畀比嬖睥賁贔襞毖蓽蹕髀怭庳愊楅湢狴獘篳苾薜觱詖躄邲閟柲梐珌痺飶馝駜鎞鷩皕堛鉍痹腷骳坒滭熚疪妼鏎鷝柫佖蜌彃箅蓖鄪罼鮅襒鵖襣驆鼊芘粊稗嫳獙廦鄨縪")
+("be8 " "邊編鞭蝙砭籩箯稨猵甂柉楄煸")
+("be83" "扁貶匾褊窆萹惼碥")
+("be84" "便變遍辨辯汴辮忭弁釆抃緶艑卞揙汳鴘閞")
+("be9 " "賓濱彬檳儐斌繽豳瀕邠璸蠙鑌豩汃椕霦矉驞")
+("be94" "殯鬢儐擯臏髕鶣")
+("bew " "憋鱉虌")
+("bew2" "別蹩咇徶襒蟞")
+("bew3" "癟蛂")
+("bew4" "彆縪")
+("bez " "標彪鑣鏢飆膘熛麃羆嘌杓滮瀌猋瘭穮颮驫摽儦臕颩髟謤墂贆蔈爂藨")
+("bez3" "表錶婊裱俵褾檦諘")
+("bez4" "鰾")
+("bi " "掰")
+("bi2" "白")
+("bi3" "百擺佰襬粨捭矲絔")
+("bi4" "敗拜唄粺椑稗矲庍")
+("bo " "玻撥剝菠缽嶓砵播般碆袚襏鱍啵柭蹳岥")
+("bo2" "伯博柏泊勃搏渤駁白薄脖帛舶箔荸蔔膊鈸餑鉑欂鵓踣浡襮踄鎛駮僰餺髆桲謈檗馞胉挬猼葧鋍懪簙礡鑮郣鸔糪")
+("bo3" "跛簸蚾")
+("bo4" "播擘簸亳薜譒薄檗蘗繴挀")
+("bq " "背杯悲卑碑俾揹偝盃裨萆桮椑伓綼鵯藣")
+("bq3" "北")
+("bq4" "被備背貝輩倍臂狽憊悖孛焙蓓褙邶琲誖鋇哱糒梖珼鄁牬郥犕奰")
+("bx " "逋晡餔峬鵏")
+("bx2" "不")
+("bx3" "補捕埔哺卜鳪獛")
+("bx4" "不部布步怖佈簿埠鈽蔀篰捗咘")
+("bz " "包胞苞褒枹笣蕔孢")
+("bz2" "雹薄窇瓝")
+("bz3" "保寶飽堡褓葆鴇怉駂鳵媬")
+("bz4" "報抱暴爆豹鮑刨趵鉋虣鑤儤菢煲袌嚗犦忁")
+("c " "ㄒ")
+("ce " "西希吸攜嘻犧稀悉溪析蟋熙禧膝棲釐嬉兮犀晰羲畦曦僖蜥扱熹奚盻觿譆晞欷蹊樨巇淅皙唏烯傒徯恓窸粞豨醯鼷氥浠潝燨瓗疧酅媐巂悕睎硒蠵鑴榽歖爔琋螇俙徆怷娭屖谿莃菥僁橀螝豯貕鵗騱驨郋桸惁凞闟誒礂")
+("ce- " "興星猩腥馨惺騂煋瑆胜垶蛵觲馫")
+("ce-2" "行形型刑邢陘硎鉶餳侀烆洐胻鋞濴")
+("ce-3" "省醒擤渻")
+("ce-4" "行興性幸姓杏倖悻荇婞莕涬")
+("ce0 " "鄉相香箱湘襄鑲廂驤緗薌瓖纕欀葙忀")
+("ce02" "詳祥降翔庠")
+("ce03" "想響享餉饗鯗饟晑")
+("ce04" "巷向相像項象橡嚮曏蠁萫闀蟓襐鐌鄉恦潒鱌")
+("ce2" "習昔息席惜媳錫襲熄蓆褶檄覡隰裼嶍螅鰼腊槢焟謵鎴欯棤蒠瘜獥薂霫飁騽蝷")
+("ce3" "喜洗徙璽鰓屣蓰囍枲蟢縰纚蹝釃匚狶諰簁葸漇敼")
+("ce4" "細戲係系繫夕汐隙歙鬩翕穸咥屭綌肸鄎醯餼滊褉酅潟舄矽鑴卌怬釸鎎釳赩郤熂覤蕮黖謑虩忥恄摡禊齂")
+("ce8 " "先仙掀鮮纖暹姍孅憸躚銛秈韱枮氙馦嬐仚屳奾杴忺澖灦祆僊嘕蓒褼廯襳珗")
+("ce82" "賢閒嫌咸鹹弦銜絃嫻嫺涎啣舷閑癇諴蚿憪鷴娹葴胘蛝羬燅礥鷳唌")
+("ce83" "險顯鮮癬蘚銑燹跣嶮蜆姺尟幰獫獮玁筅韅毨烍鍌搟鼸齴赻攇禒")
+("ce84" "縣現線限憲獻羨陷腺餡蜆莧霰俔僩峴晛睍豏轞鋧涀瀗粯娊撊錎姭")
+("ce9 " "心新辛薪欣鋅馨鑫莘炘歆芯昕訢鈊盺兟廞忻妡噷")
+("ce92" "尋鄩杺攳襑")
+("ce93" "伈")
+("ce94" "信釁芯焮舋膷囟妡煡阠")
+("cea " "瞎蝦岈颬鍜")
+("cea2" "暇峽轄霞俠狹挾匣呷遐硤狎瑕斜黠柙祫洽舝碬騢搳烚冾笚縖珨陜磍赮魻蕸")
+("cea4" "下夏嚇廈暇罅芐欱鏬鶷")
+("cew " "些歇蠍蝎猲褉嗋")
+("cew2" "協鞋斜脅諧邪偕頡挾絜攜擷勰纈襭脥慀劦蝢垥拹籺奊龤愶搚瑎熁燲")
+("cew3" "寫血")
+("cew4" "謝械洩屑瀉懈卸泄蟹解屜褻榭契駭廨渫邂燮楔絏薤紲媟嶰澥瀣獬躞灺疶鞢骱駴偰檞齘伳妎祄榍韰屧焎揳齥躠")
+("cey " "修休羞脩咻庥貅髹饈鵂滫樇臹茠銝蓨鎀潃")
+("cey3" "朽宿糔")
+("cey4" "秀繡鏽袖嗅宿臭銹琇溴岫珛玊殠褎螑")
+("cez " "消銷蕭瀟宵逍囂簫削硝霄哮驍梟蠨枵魈鴞嘵綃嘐歊潚烋獢虓蛸痚憢灱呺穘洨涍痟萷踃膮藃櫹髇毊虈庨啋窙顤謼")
+("cez2" "學洨笅郩")
+("cez3" "小曉筱篠謏")
+("cez4" "校笑孝效酵嘯肖傚恔熽踍")
+("cu " "須需虛鬚噓墟戌胥訏吁歔盱嬃繻殈旴呴楈嬬鑐欨倠稰縃蝑蕦驉魖晇幁揟糈")
+("cu- " "兄兇胸凶匈洶忷哅恟")
+("cu-2" "雄熊赨")
+("cu-4" "敻詗")
+("cu2" "徐")
+("cu3" "許栩煦咻詡冔姁湑諝醑鄦珝喣")
+("cu4" "序續蓄緒敘絮旭恤卹酗婿畜洫旮侐慉漵藚頊芧藇魆勖勗訹鱮烅怴垿窢瞲銊沀昫瞁")
+("cu8 " "宣軒喧瑄萱暄壎儇諼塤嬛揎翾諠愃晅鍹鶱梋煖萲愋佡昍鋗媗禤蝖蠉矎")
+("cu82" "玄旋懸漩璇璿伭妶琁玹嫙誸還縣蜁")
+("cu83" "選咺烜")
+("cu84" "炫絢漩眩泫渲旋眴楦敻鉉衒蔙駽鞙鏇昡楥袨縼讂贙")
+("cu9 " "勳薰燻熏醺峋曛焄獯纁臐蔒勛矄")
+("cu92" "尋巡詢循旬馴潯珣蟳洵荀徇恂峋栒燖璿紃郇鱘槆撏枔咰璕橁蕁噚")
+("cu94" "訊訓迅遜殉馴徇巽汛蕈噀侚潠韗迿鵔")
+("cuw " "薛靴噱嶨吙")
+("cuw2" "學穴鷽觷踅燢澩壆")
+("cuw3" "雪鱈")
+("cuw4" "血雪穴削趐泬謞岤袕")
+("d " "ㄉ")
+("d- " "登燈鐙簦豋璒嬁")
+("d-3" "等戥")
+("d-4" "鄧瞪蹬凳嶝磴墱邆霯")
+("d0 " "當噹鐺襠璫簹儅蟷澢艡嵣")
+("d03" "檔黨擋讜攩欓党")
+("d04" "當蕩擋盪碭宕菪逿璗愓瓽礑簜闣")
+("d8 " "單擔丹耽簞鄲眈聃酖砃甔襌匰聸勯嚪")
+("d83" "膽疸撢亶紞刐撣玬衴黵丼澸")
+("d84" "但旦淡蛋誕擔彈憚氮啖澹憺儋啗噉石癉窞僤幨霮髧萏鉭暺柦帎潬沊狚觛啿舕蜑嘾鴠癚殫灗泹")
+("da " "搭褡答撘瘩躂咑耷")
+("da2" "答達韃靼瘩怛繨噠妲笪荅薘褟鐽匒呾畣炟鎝")
+("da3" "打")
+("da4" "大")
+("de " "低滴氐羝鞮彽磾鍉袛菂墑熵")
+("de- " "丁釘叮疔酊盯仃玎帄靪虰")
+("de-3" "頂鼎酊嵿濎薡")
+("de-4" "定訂釘錠碇飣娗椗掟碠顁萣啶")
+("de2" "的敵迪狄笛滌翟荻嫡嘀鏑蹢芽犒糴覿篴蔋靮梑潪苖嚁鸐藋藡")
+("de3" "底抵邸詆牴砥氐坻柢弤觝呧阺聜菧軧扺")
+("de4" "地第弟帝遞蒂的締諦娣睇棣杕玓禘蔕螮踶楴渧碲虳釱樀旳軑梊焍馰墆嵽珶甋")
+("de8 " "顛巔癲滇掂傎瘨敁蹎槙齻厧")
+("de83" "點典碘錪婰琠蕇")
+("de84" "電店殿甸奠墊澱惦靛佃淀玷鈿簟坫痁癜磹阽扂婝踮壂")
+("dea " "嗲")
+("dew " "爹")
+("dew2" "跌蝶諜碟疊迭牒喋瓞耋絰咥垤堞蜨蹀鰈跕昳峌挕胅苵眣聑臷詄镻艓褋惵楪嶀")
+("dey " "丟銩")
+("dez " "雕凋刁貂鵰碉叼彫瞗琱鯛扚蛁鳭虭殦")
+("dez3" "屌")
+("dez4" "調掉釣吊弔窵蓧誂伄魡")
+("di " "呆待獃")
+("di3" "歹逮")
+("di4" "代帶待袋戴怠殆黛貸迨大玳岱逮襶埭靆紿廗汏忕瀻軩跢艜蹛柋酨")
+("dq3" "得")
+("dr1" "的得")
+("dr2" "得德淂")
+("dx " "都督嘟闍醏")
+("dx- " "東冬咚鼕苳蝀埬崠氡炵涷菄鶇")
+("dx-3" "懂董嬞墥")
+("dx-4" "動洞凍棟恫胴挏戙駧霘")
+("dx2" "讀獨毒牘纛瀆犢髑讟黷櫝儥碡殰蝳贕韇韥皾")
+("dx3" "賭堵睹篤肚錖裻帾")
+("dx4" "度渡肚妒鍍杜蠹秺喥")
+("dx8 " "端耑偳剬媏")
+("dx83" "短")
+("dx84" "段斷緞鍛毈腶籪椴葮碫躖")
+("dx9 " "敦蹲墩惇礅驐蜳撉鐓")
+("dx93" "盹躉")
+("dx94" "頓噸盾鈍遁盹燉沌囤遯炖坉扽伅庉潡崸鶨腞")
+("dxo " "多朵哆柁茤")
+("dxo2" "奪鐸多掇裰剟敪椯剫敓莌毲腏鮵襗")
+("dxo3" "躲朵埵垛嚲鬌痑趓")
+("dxo4" "惰墮舵跺剁咄踱馱垛墯嶞柮陏陊度袉貀鵽")
+("dxq " "堆頧痽")
+("dxq4" "對隊兌碓懟譈濧薱轛濻瀩憝")
+("dy " "都兜郖")
+("dy3" "斗抖陡蚪枓唗敨")
+("dy4" "鬥豆逗痘竇荳脰餖鋀梪浢讀")
+("dz " "刀叨忉舠氘幍魛")
+("dz3" "倒島導禱搗擣捯壔禂")
+("dz4" "到道倒稻盜蹈悼導纛翿檤菿瓙")
+("e " "一壹衣依醫伊揖噫漪猗咿ㄧ禕繄黟曀銥泆鷖欹郼圪溰稦燚洢陭蛜嫛瑿檹毉黳嶬")
+("e- " "應英鷹嬰鶯櫻膺瑛鸚嚶罌纓攖瓔嫈甖罃煐韺甇霙碤礯朠蝧渶褮偀霒蘡譻蠳鶧")
+("e-2" "營迎蠅螢贏盈瑩縈瀛滎嬴塋熒楹瀅瀠籯瀯謍攍巆廮藀")
+("e-3" "影景穎潁癭郢瀴矨梬浧")
+("e-4" "應硬映媵瀅鎣摬賏")
+("e0 " "央秧殃鴦鞅泱坱胦柍佒姎紻鉠雵")
+("e02" "楊陽揚洋羊佯烊瘍鍚徉颺暘煬垟昜禓蛘瑒珜鐊崵鸉眻婸")
+("e03" "養仰氧癢鞅卬攁岟炴抰痒懩蝆")
+("e04" "樣養恙漾怏煬瀁羕")
+("e2" "遺疑移宜怡姨儀夷一誼胰貽飴咦詒沂頤彝迤椸痍蛇圯嶷笫桋匜宧洟簃訑貤迻杝柂袲酏峓眱羠鈶寲侇珆衪銕呲恞萓沶栘瓵袘羡蛦暆跠歋熪箷螔顊謻觺鸃")
+("e3" "以已乙倚椅矣蟻尾艤迤苡偯扆旖螘扡酏鳦釔齮顗檥鉯迆胣礒掜陭崺晲轙")
+("e4" "意義易議亦益異藝億憶譯液役翼疫毅逸邑抑肄一誼繹溢縊軼詣屹佚翌羿驛掖懿裔臆曳奕蜴腋衣刈翳挹鎰囈弈佾乂弋艾懌劓圛斁薏悒瘞仡勩埸嶧帟曀杙枻殪浥熠艗襼饐黓亄唈燡藙豷寱阣熤劮檍嗌廙鐿鞥醳醷翊肊异枍伿浂澺芅熼玴抴蘙俋焲燱晹垼釴捙欭埶羛隿殔跇裛嫕緆膉靾槷潩蓺墿瘱謚繶瀷帠槸霬鷾齸")
+("e8 " "煙焉淹殷醃咽胭奄湮菸嫣燕蔫閹厭崦臙鄢漹猒珚偣嬮酀腌")
+("e82" "研言顏嚴延沿炎癌鹽岩筵簷閻妍蜒檐埏喦揅碞綖郔巖孍楌礹閰娮鈆狿虤顃壛麙壧莚嵒")
+("e83" "眼演掩衍郾偃兗甗儼魘剡弇罨沇巘扊揜渰蝘黶姶戭棪嬿鰋鼴琰匽厴椼抁龑酓嵃愝萒隒裺褗鶠黤曮惔躽馣黭")
+("e84" "驗燕厭晏雁宴淹豔燄彥堰硯咽嚥唁饜研讌諺沿讞焱釅贗喭灩爓閆鷃嬿鴳醼焰牪姲鷰椻曣懨婩傿鴈噞騴觾艷驠莚敥")
+("e9 " "因音陰姻殷茵慇氤瘖喑堙湮愔禋絪裀闉駰銦蒑諲垔韾洇凐歅噾霠韽黫摿")
+("e92" "銀吟寅淫鄞齦檐霪垠夤狺嚚崟誾蟫婬冘苂釿圁烎凐荶殥蔩檭鷣鏔")
+("e93" "引飲隱尹癮蚓听靷紖縯讔趛螾馻鈏檃濦蘟粌")
+("e94" "印飲隱蔭胤廕窨憖湚垽猌朄酳")
+("ea " "呀壓鴉鴨押丫椏煆孲")
+("ea2" "牙芽涯衙蚜押枒犽齖伢堐")
+("ea3" "亞啞雅掗厊庌蕥雃疋")
+("ea4" "亞訝迓砑氬婭揠錏聐軋圠襾玡猰窫齾")
+("ei2" "崖睚啀娾")
+("eo " "唷")
+("ew " "耶噎蠮")
+("ew2" "爺耶椰琊揶擨")
+("ew3" "也野冶埜漜")
+("ew4" "業葉頁夜咽謁拽靨鄴燁瞱擫射曄饁煠鍱鐷澲鎑偞殗嶪擛")
+("ey " "優憂幽悠呦攸耰麀櫌鄾懮怮嚘瀀纋蚴")
+("ey2" "由游遊尤油郵猶猷鈾輶疣蚰蕕斿蝣訧逌楢魷优沋浟偤秞莤")
+("ey3" "有友酉莠牖黝羑泑銪岰庮蒏苃聈槱")
+("ey4" "又右幼誘佑柚釉祐有莠宥侑囿鼬卣姷狖峟貁鴢扰牰迶")
+("ez " "要腰夭妖邀么吆喲喓祅葽訞")
+("ez2" "搖謠堯遙姚洮瑤僥淆餚颻傜繇嶢徭殽猺軺爻垚崤銚珧柼猇鰩肴媱烑窯嗂愮榣顤")
+("ez3" "咬窈舀夭殀杳窅窔鷕宎抭苭眑偠溔榚騕岆嫍蓔")
+("ez4" "要藥耀曜鑰樂鷂拗燿袎靿艞覞穾筄葯獟趭")
+("f " "ㄈ")
+("f- " "風蜂封豐瘋峰鋒丰烽楓諷酆葑灃犎捀桻妦檒偑崶蘴飌麷猦")
+("f-2" "逢縫馮夆渢堸艂摓")
+("f-3" "唪覂")
+("f-4" "奉鳳俸諷縫賵焨")
+("f0 " "方芳坊枋邡淓鈁匚汸")
+("f02" "房防妨肪坊魴")
+("f03" "訪彷仿紡倣舫昉瓬髣鶭")
+("f04" "放")
+("f8 " "番翻蕃繙幡帆旛籓僠嬏轓鱕")
+("f82" "凡煩繁帆蕃礬藩樊蘩璠籵墦燔膰蠜蹯颿笲釩瀿鐇勫橎薠羳鷭杋柉瀪")
+("f83" "反返魬")
+("f84" "範范犯氾汎飯販泛梵畈笵鄤奿軓軬滼嬔")
+("f9 " "分紛芬氛吩棻玢酚雰昐鈖砏翂衯饙梤鳻")
+("f92" "墳焚汾枌棼蚡豶鼖幩濆轒鼢妢炃羒蒶黂弅蕡鐼")
+("f93" "粉黺")
+("f94" "份忿奮憤分糞僨瀵坋秎魵橨膹羵")
+("fa " "發伐瞂")
+("fa2" "乏伐罰閥筏砝茷法疺藅")
+("fa3" "法髮")
+("fa4" "法琺")
+("fez4" "覅")
+("fo2" "佛坲")
+("fq " "非飛菲扉啡妃緋霏馡騑鯡騛婓裶")
+("fq2" "肥淝腓萉蜰")
+("fq3" "匪翡斐蜚誹悱菲朏棐榧篚奜餥")
+("fq4" "廢費肺沸吠痱怫疿芾屝剕狒砩濷癈昲胇俷厞曊鼣櫠蟦鐨")
+("fx " "夫膚敷孵伕麩跗趺柎砆鄜鈇箙罦衭稃邞泭怤尃荴綒鳺姇糐璷紨")
+("fx-4" "甮")
+("fx2" "服福扶浮符伏彿縛幅俘拂苻弗孚袱芙輻蝠匐蜉罘涪夫郛莩怫蚨桴紼茯菔紱咈洑綍艴芾茀艀刜帗笰葍袚氟棴澓烰枹玸岪枎垘昲柫琈虙踾鳧巿沷祓翇韍諨鴔黻鵩鶝")
+("fx3" "府腐撫輔甫斧俯釜脯腑莆滏嘸拊黼簠頫郙弣鯆暊冹蜅蚥軵父")
+("fx4" "父負婦付附富復副傅覆複腹咐赴賦駙阜訃馥賻蝮鮒祔偩輹鰒鍑榑复胕蚹萯蝜褔姇峊蛗緮蕧")
+("fy2" "罘芣紑剻")
+("fy3" "否缶殕缹鴀")
+("g " "ㄐ")
+("ge " "機基積績蹟激跡姬雞饑肌稽飢奇畸碁箕磯譏羈几机乩屐躋璣幾嘰畿嵇犄齎其期居唧勣禨欚癘羇虀觭霙蛣銈枅丌尐簊虮鐖櫅稘毄樍諅齍鞿鑇鰿齏笄剞隮鸄癪")
+("ge- " "經精京驚睛莖晶菁更兢涇鯨荊旌粳黥箐鶄巠婛旍鵛鶁鼱麠仱惊")
+("ge-3" "景警井頸阱儆璟憬剄璥丼烴憼暻蟼燛")
+("ge-4" "敬竟鏡靜境淨競逕徑靖勁凊脛痙獍倞靚竫婧桱俓凈葝擏弳")
+("ge0 " "將江疆僵漿姜薑豇殭韁螿橿茳礓瓨翞")
+("ge03" "講獎蔣槳顜膙")
+("ge04" "降匠醬強將絳糨洚謽嵹彊弶袶")
+("ge2" "及級極即集急擊疾籍吉寂輯脊圾唧嫉汲亟吃棘藉瘠楫岌笈鶺戢殛蹐伋蒺耤芨蕺踖鈒佶堲姞濈襋墼潗鴶嶯洁忣湒极銡狤鏶蝍衱偮庴莋塉槉漃膌蓻橶蕀轚霵彶揤楖秸鞊螏觙")
+("ge3" "幾給己擠脊戟濟几麂庋蟣剞掎泲踦魕丮穖妀撠")
+("ge4" "計記既紀際繼季寄技妓濟劑繫悸祭忌暨冀騎鯽稷躋薺驥霽薊髻罽覬伎洎瘈跽嚌塈惎漈穧芰蔇痵癠穄鮆鱭鯚鰶旡刉臮裚穊誋鬾瞡檕璾鵋齌懻瀱鱀蘮蘻")
+("ge8 " "間監堅尖兼肩艱奸姦煎緘濺漸箋殲菅戔鞬牋椷縑湔熸蒹鶼廌犍籛豜韉鬋鈃鑯鰹鰜櫼熞蕑揃搛幵菺靬葌鳽餰礛騝鵳瀸虃惤猏麉")
+("ge83" "簡撿剪減檢揀繭儉鹼柬筧翦謇戩蹇譾趼堿囝鰔挸湕瞼寋藆襺暕瑐")
+("ge84" "見建健漸件間監鍵鑑箭劍艦鑒賤踐諫毽薦餞腱濺僭檻閒洊俴牮栫楗珔瀳澗瞷荐諓榗糋鰎蔪鋻螹襉糮鑳")
+("ge9 " "今金禁津斤巾筋襟矜浸觔衿祲瑧菳珒埐紟嶜惍")
+("ge93" "緊僅錦謹儘覲瑾饉槿墐殣堇慬菫巹")
+("ge94" "進近盡禁晉儘浸勁覲燼廑噤靳縉僅藎妗贐寖搢肵璡賮嬧榗僸蓳瘽嚍濜璶伒溍")
+("gea " "家加嘉佳傢迦枷袈痂笳珈跏茄葭豭耞麚泇毠鎵鴐猳幏犌貑夾")
+("gea2" "夾挾頰蛺莢浹戛郟恝袷筴裌鋏梜跲舺唊鉿硈扴鞂鞈鵊")
+("gea3" "假甲賈鉀岬胛斝榎瘕檟婽玾徦椵夏")
+("gea4" "價假架駕嫁賈稼价")
+("gew " "街接皆階揭偕嗟喈幯結湝薢袺啑椄菨蝔鶛")
+("gew2" "節潔傑捷竭劫截結杰頡詰桀睫訐咭拮羯櫛桔孑癤絜偈擷倢劼婕楬碣鮚岊榤犵袺嵑栨騔滐鉣鐑衱迼崨嵥楶趌踕擳瀄鍻蠽昅揤緁巀緳")
+("gew3" "姐解姊檞媎")
+("gew4" "界借介戒藉屆疥芥誡解唶喈玠蚧犗褯吤岕价砎悈紒祴躤繲")
+("gey " "糾揪啾鳩轇湫樛揫勼朻牞觓揂萛鬮")
+("gey3" "九久酒玖赳灸韭糾")
+("gey4" "就究救舊舅臼柩疚咎僦鷲廄捄慦鯦麔")
+("gez " "教交膠驕焦嬌郊跤澆蛟蕉礁椒茭姣鮫僬憍艽鷦燋詨鱎鐎鵁鷮嘄憿膲穚蟂鷍嶕蟭")
+("gez2" "嚼")
+("gez3" "腳角繳攪勦矯絞姣佼餃皎僥剿較鉸狡皦儌筊蟜摷撟捁灚曒漅劋譑煍")
+("gez4" "教叫校較覺轎窖皭醮徼噭嶠挍斠珓釂滘窌嘂潐譥")
+("gu " "居拘駒沮疽蛆狙俱車据鋸裾苴趄罝菹娵椐腒崌痀琚雎涺葅鮈鶋斪揟蜛踙輋")
+("gu- " "扃坰駉")
+("gu-3" "窘迥煚泂炅絅褧冏熲囧皛炯幜顈")
+("gu2" "局鞠菊橘掬跼桔挶鞫侷匊踘鋦鵙鶪椈焗淗驧狊梮郹犑輂箤趜鵴蘜鼳陱駶")
+("gu3" "舉矩咀莒沮齟櫸筥踽蒟椇柜竘袓跙蝺")
+("gu4" "據句具巨劇聚俱拒距鋸懼鉅炬詎遽倨瞿踞颶泃苣窶醵屨秬虡寠鐻佢据粔姖怚絇足耟岠埧蚷駏澽貗躆洰焣壉犋")
+("gu8 " "捐娟鵑涓鐫圈蠲朘身脧裐")
+("gu83" "捲卷埢菤臇")
+("gu84" "倦卷眷絹雋悁狷圈獧睊睠罥鄄帣錈腃韏鬳")
+("gu9 " "軍君均鈞皸囷麇莙鮶桾蚐袀頵龜碅")
+("gu93" "窘蜠")
+("gu94" "俊菌郡峻竣雋濬駿蕈浚珺畯焌捃餕箘寯晙呁鵘葰蔨")
+("guw " "噘嗟撅")
+("guw2" "決覺絕爵掘嚼訣厥獗蹶蕨崛攫倔炔抉噱矍觖角孓玨劂橛爝譎屩觼玦腳臄蕝躩戄桷潏鴃貜趹鱖傕嵑瘚蠼鐍钁玃捔芵焆鈌蚗谻赽僪憰蟨彏鱊鷢堀殌穱")
+("guw3" "蹶")
+("guw4" "倔")
+("h " "ㄏ")
+("h- " "亨哼脝諻")
+("h-2" "橫恆衡恒珩蘅桁姮鑅楻誙諻揘佷")
+("h-4" "橫啈澋絎")
+("h0 " "夯")
+("h02" "行航杭吭頏桁迒苀肮蚢斻貥雽魧")
+("h03" "酐")
+("h04" "行沆")
+("h8 " "酣鼾蚶憨頇魽唅甝谽嫨")
+("h82" "寒含函涵韓邯汗邗榦琀梒鋡焓")
+("h83" "喊罕厂蔊豃嚂")
+("h84" "和漢汗旱焊憾翰撼悍頷扞瀚閈捍暵熯晥犴睅菡豻銲釬駻哻涆淊馯蜭頜螒顄雗攌譀鋎鶾")
+("h92" "痕拫鞎")
+("h93" "很狠")
+("h94" "恨")
+("ha " "哈")
+("ha2" "蛤")
+("ha3" "哈")
+("hi " "咳嗨咍")
+("hi2" "還孩骸頦")
+("hi3" "海醢烸")
+("hi4" "害亥駭嗨氦嗐絯餀")
+("hq " "黑嘿潶")
+("hq3" "黑")
+("hr " "喝呵訶峆")
+("hr2" "何合和河荷核盒禾褐劾闔閤曷龢涸盍覈蓋貉閡紇滆翮蝎嗑齕郃餲鶡鉌魺鞨菏姀毼熆蒚篕螛礉盉廅楁澕趷")
+("hr4" "賀和鶴喝荷嚇赫郝暍嗃熇猲翯佫煂")
+("hx " "忽呼乎惚滹戲猢欻膴虖吰虍幠寣昒歑烼垀曶啒峘淴謼匢淲")
+("hx- " "轟哄烘薨訇吽揈渹哅輷谾鍧焢魟")
+("hx-2" "紅洪宏鴻虹弘泓訌鋐閎黌竑紘翃浤鞃灴葒耾仜汯竤鈜霟妅玒谹渱舼触谼篊彋瓨苰")
+("hx-3" "哄嗊")
+("hx-4" "鬨汞澒蕻鍙")
+("hx0 " "荒慌肓衁巟嚝")
+("hx02" "黃徨惶簧璜磺蝗煌皇凰湟遑隍潢篁喤艎鍠熿韹鰉堭蟥偟穔鷬媓騜崲葟餭撗獚趪")
+("hx03" "謊恍晃幌洸怳榥熀鎤滉皝")
+("hx04" "晃軦")
+("hx2" "胡湖壺蝴糊狐弧葫鬍瑚餬斛鵠囫縠衚觳醐猢搰鶘槲媩抇鰗焀魱螜瀫楜嘝鶦")
+("hx3" "虎琥滸唬許汻")
+("hx4" "護戶互滬扈瓠怙祜笏冱戽楛沍岵鄠臛頀枑槴昈嫭婟嫮熩豰綔謢蔰")
+("hx8 " "歡驩讙獾犿懽酄鴅")
+("hx82" "還環桓圜繯鬟鍰鐶寰闤梡洹瓛貆澴荁萑肒捖羦懁豲嬛狟雈")
+("hx83" "緩皖澣睆輐")
+("hx84" "換喚宦患幻煥奐渙瘓豢梡逭擐漶垸轘瑍觨嚾瞣")
+("hx9 " "婚昏葷閽惛睯殙棔涽敯睧")
+("hx92" "魂渾餛混琿楎餫棞顐鼲繉轋")
+("hx93" "混睔")
+("hx94" "混渾溷諢圂慁輥倱梡")
+("hxa " "花華嘩鷨錵")
+("hxa2" "華滑划猾譁嘩樺驊鏵豁劃崋釫螖")
+("hxa4" "話化畫劃樺華嫿摦崋嬅杹觟槬繣澅")
+("hxi2" "懷淮徊槐踝佪怀褢褱櫰瀤")
+("hxi4" "壞坏諙孬咶蘹蘾")
+("hxo " "豁")
+("hxo1" "和")
+("hxo2" "活佸鈥萿")
+("hxo3" "火伙夥鈥")
+("hxo4" "或穫獲和惑禍霍貨豁壑蠖嚄藿鑊矱檴濩砉雘硅擭湱騞謋捇沎眓掝嗀嗀瓁臒攉瀖曤矐韄靃")
+("hxq " "灰揮輝恢詼暉麾徽墮褌撝隳煇翬豗褘洃隓顪鰴拻噅禈")
+("hxq2" "回迴蛔茴蚘洄痐恛藱")
+("hxq3" "會悔誨毀燬賄虺虫烠毇檓譭")
+("hxq4" "會惠匯繪慧彙穢誨賄晦彗諱潰卉蕙濊燴喙恚薈翽闠嘒槥篲繢繐蟪璯嬇憓潓瞺譓譿鏸橞廆詴圚蔧獩餯鐬饖芔禬襘")
+("hy " "齁")
+("hy2" "猴侯喉篌鍭餱瘊銗翭鯸葔")
+("hy3" "吼")
+("hy4" "後候厚后逅鱟垕堠郈鄇缿洉")
+("hz " "蒿嚆薅")
+("hz2" "號毫豪壕濠蠔貉嚎鶴蚵嗥籇諕勂譹")
+("hz3" "好郝")
+("hz4" "號耗浩皓鎬涸昊好灝澔皜顥鄗秏淏滈皞哠悎鰝昦薃")
+("i " "挨哀埃唉哎ㄞ誒")
+("i2" "捱皚騃敳")
+("i3" "矮藹靄欸毐昹佁")
+("i4" "愛礙艾曖璦隘噯乂靉僾堨嬡鑀賹濭鴱譪誒薆")
+("j " "ㄖ")
+("j- " "扔")
+("j-2" "仍礽陾")
+("j-3" "扔")
+("j02" "攘禳穰勷瀼瓤儴獽蘘躟鬤蠰")
+("j03" "嚷壤攘爙")
+("j04" "讓懹")
+("j4" "日衵馹鈤")
+("j82" "然燃髯蛅蚺袡")
+("j83" "染冉髯苒珃橪呥姌嫨")
+("j92" "人任仁壬紝儿芢銋")
+("j93" "忍稔荏腍棯栠荵")
+("j94" "任認刃飪賃軔衽紉妊恁仞訒韌牣鵀屻肕軠")
+("jr3" "惹喏若")
+("jr4" "熱渃")
+("jx-2" "容榮融溶絨熔戎蓉鎔茸榕羢嶸瑢肜毧狨瀜茙烿蠑爃媶榵褣駥髶鰫鷛")
+("jx-3" "冗茸氄傇軵")
+("jx2" "如儒孺茹蠕嚅濡袽襦鴽筎臑醹挐薷銣曘燸帤蕠")
+("jx3" "乳汝辱擩女侞")
+("jx4" "入辱褥孺茹洳縟蓐溽鄏媷嗕")
+("jx82" "堧壖撋")
+("jx83" "軟阮蠕耎蝡瓀緛礝朊")
+("jx9 " "犉")
+("jx94" "潤閏橍")
+("jxo4" "若弱箬偌爇鄀篛蒻楉鶸")
+("jxq2" "蕤緌婑")
+("jxq3" "蕊橤繠惢桵")
+("jxq4" "瑞銳芮睿蚋叡枘汭")
+("jy2" "柔揉韖蹂輮楺禸葇鍒鞣騥鶔媃蝚鰇")
+("jy3" "糅鍕粈煣")
+("jy4" "肉")
+("jz2" "饒蕘嬈橈蟯襓")
+("jz3" "擾")
+("jz4" "繞遶隢")
+("k " "ㄎ")
+("k- " "坑硜鏗牼吭阬硻銵娙挳鍞")
+("k-3" "挳")
+("k0 " "康慷糠鏮漮嫝")
+("k02" "扛")
+("k03" "慷")
+("k04" "亢抗炕伉匟囥犺閌邟鈧")
+("k8 " "刊堪勘戡看龕嵁")
+("k83" "砍侃坎崁莰檻欿轗歁歞埳凵顑")
+("k84" "看瞰勘闞矙磡衎墈鬫竷")
+("k93" "肯啃墾懇齦齗豤錹")
+("k94" "掯硍裉")
+("ka " "咖喀哈鉲")
+("ka3" "卡咳佧")
+("ka4" "喀髂")
+("ki " "開揩痎侅")
+("ki3" "凱慨楷愷剴豈鎧塏闓鍇颽暟輆")
+("ki4" "慨愾愒咳欬烗勓壒")
+("kr " "科柯刻棵顆苛瞌磕蚵蝌軻稞窠珂砢簻薖峇鈳樖犐嵙")
+("kr2" "咳殼")
+("kr3" "可渴哿坷岢堁敤嶱閜")
+("kr4" "客課刻克剋喀溘恪嗑可榼緙髁氪騍搕厒勀")
+("kx " "哭枯窟骷跍挎桍刳顝胐橭")
+("kx- " "空崆倥箜悾硿涳錓")
+("kx-3" "恐孔倥")
+("kx-4" "空控鞚")
+("kx0 " "匡框筐誆劻恇洭")
+("kx02" "狂誑鵟")
+("kx03" "俇")
+("kx04" "況礦曠框眶鄺貺壙纊絖懭爌彉")
+("kx3" "苦楛")
+("kx4" "庫褲酷嚳矻瘔趶")
+("kx8 " "寬髖臗")
+("kx83" "款窾梡")
+("kx9 " "昆崑坤琨錕焜褌晜鯤菎騉髡惃猑")
+("kx93" "捆綑悃梱閫壼稛硱裍齫")
+("kx94" "困睏涃")
+("kxa " "誇夸姱荂晇侉舿")
+("kxa3" "垮侉銙")
+("kxa4" "跨胯骻")
+("kxi " "咼喎")
+("kxi3" "蒯")
+("kxi4" "快塊會筷檜劊鄶澮膾噲獪儈鱠駃鬠欳")
+("kxo3" "擃")
+("kxo4" "括擴闊廓鞹漷蛞姡霩籗")
+("kxq " "虧窺盔闚刲悝鞹鍷茥藈噅巋蘬")
+("kxq2" "魁睽奎揆葵逵戣夔騤暌鄈頯聧楏櫆湀馗楑犪躨")
+("kxq3" "傀跬頍煃蹞峞")
+("kxq4" "愧潰匱饋餽喟簣媿聵憒簀蕢瞶槶樻鐀嘳撌騩硊蔮")
+("ky " "摳彄芤袧鏂")
+("ky3" "口")
+("ky4" "扣寇叩蔻釦鷇筘佝怐滱瞉簆")
+("kz " "尻")
+("kz3" "考烤拷栲攷薧洘")
+("kz4" "靠銬犒")
+("l " "ㄌ")
+("l-2" "稜崚棱薐蔆倰楞")
+("l-3" "冷")
+("l-4" "愣踜楞")
+("l0 " "啷")
+("l02" "郎狼廊螂瑯琅榔稂莨蜋桹筤鋃俍崀欴")
+("l03" "朗閬硠峎悢誏烺塱")
+("l04" "浪埌蒗")
+("l82" "蘭籃藍欄攔瀾襤婪嵐闌襴讕斕籣欗糷灆灡譋躝")
+("l83" "覽懶攬欖纜壈爦灠醂嬾顲浨")
+("l84" "爛濫纜鑭爁壏")
+("la " "拉啦喇柆鞡翋菈")
+("la1" "啦")
+("la2" "剌邋旯")
+("la3" "喇藞")
+("la4" "臘蠟鑞辣剌腊落鬎瘌揧楋")
+("le " "哩")
+("le- " "拎")
+("le-2" "零玲靈鈴齡陵凌菱聆羚苓伶綾淩翎鴒囹蛉瓴泠舲酃軨錂櫺柃欞睖砱詅輘霝鯪醽岭昤澪呬坽夌姈狑皊呤琌笭裬蘦怜婈駖蕶爧堎")
+("le-3" "領嶺彾")
+("le-4" "令另炩")
+("le02" "良梁量糧涼粱樑椋綡輬踉駺")
+("le03" "兩倆魎緉裲")
+("le04" "量亮諒輛喨晾涼啢踉湸悢")
+("le2" "離璃黎梨籬釐犛罹貍驪犁漓灕狸藜蜊蠡鸝嫠褵黧梩漦縭蔾氂厘蘺剺喱篱醨鱺劙孋廲騹孷樆謧鯬鵹攡麗菞鑗黐粍麶")
+("le3" "李里裡理禮裏哩浬鯉娌俚澧邐醴蠡鱧鋰粴豊峛欚")
+("le4" "力立利麗歷壢例曆莉厲勵礪粒蒞靂瀝儷隸礫吏荔栗慄俐痢癘笠戾唳酈琍詈嚦溧蠣櫪沴糲櫟轢瓅鬁猁盭篥苙唎屴躒釙鬲皪秝瑮轣岦朸欐禲赲鴗砅濿砬悷蚸厤筣綟蜧磿斄犡藶蠫鷅麜攦觻鷑攭鱳靋栵浰塛搮蝷儮曞讈瓥鱱娳")
+("le82" "連聯憐廉蓮漣簾鐮鰱奩璉帘褳嗹鎌鬑溓蠊槤縺謰覝磏濂翴薕蹥譧奱嬚")
+("le83" "臉鄻膦摙僆羷")
+("le84" "練鍊戀煉鏈殮斂瀲楝襝湅澰蘞歛薟萰堜")
+("le92" "林臨鄰淋鱗麟霖磷琳遴嶙燐璘粼轔潾痳疄瞵惏暽罧驎碄箖甐繗僯翷蹸壣鏻")
+("le93" "凜懍廩檁菻亃綝榃")
+("le94" "吝躪藺賃橉閵焛")
+("lea3" "倆")
+("lew " "咧")
+("lew3" "咧")
+("lew4" "列烈劣裂獵捩冽鬣躐洌茢睙擸趔姴迾脟蛚蛶颲儠鮤鴷犣")
+("ley " "溜蹓")
+("ley2" "劉流留硫琉榴瀏瘤遛旒騮鏐飀鶹懰鎏泵鎦媹嬼嵧藰裗麍鷎蓅鰡巰")
+("ley3" "柳綹罶鉚飹珋")
+("ley4" "六陸溜餾霤坴翏雡廇塯蹓")
+("lez " "撩")
+("lez2" "聊寮遼療寥撩僚燎潦嘹繚鐐嫽獠鷯屪鷚膋漻摎豂嵺憀嶚敹窷膫簝镽飂飉顟")
+("lez3" "了瞭蓼憭釕暸鄝蟟")
+("lez4" "廖料瞭燎尥撂炓蟉窲")
+("li2" "來萊徠淶騋箂崍郲錸鯠棶庲鶆唻")
+("li4" "賴癩瀨籟睞賚藾娕")
+("lq " "勒")
+("lq2" "雷累纍擂嫘鐳羸縲罍檑畾櫑瓃蠝轠壨欙")
+("lq3" "累壘儡漯耒磊蕾誄藟樏癗礌絫磥鑸瘣櫑櫐礨灅讄鸓頛礧蘲虆")
+("lq4" "類淚累擂纇酹銇儽蘱禷")
+("lr1" "了")
+("lr4" "樂垃勒肋泐埒叻仂捋扐阞砳鰳氻哷竻")
+("lu2" "驢閭櫚藘慺氀膢")
+("lu3" "呂旅履侶鋁屢縷褸婁膂漊穭梠郘挔絽儢祣")
+("lu4" "律綠率慮濾氯嵂膟鑢菉葎勴")
+("lu82" "攣孿")
+("lu83" "孌")
+("luw4" "略掠鋝撂擽")
+("lx " "嚕")
+("lx-2" "龍隆籠嚨聾瓏朧窿瀧癃櫳礱曨巃矓蘢躘豅鏧鑨靇蠪襱鸗儱龒蠬")
+("lx-3" "隴攏壟")
+("lx-4" "衖哢徿梇")
+("lx2" "盧蘆廬臚爐顱瀘鱸轤壚鸕玈罏艫鑪籚櫨嚧攎蠦纑")
+("lx3" "魯虜擄滷鹵櫓艣磠鐪鏀蓾擼氌")
+("lx4" "路陸錄鹿露賂祿碌氯麓鷺戮轆蓼逯漉輅僇潞籙璐甪稑穋簏醁騄淥琭盝磟彔菉蔍錴垏鏕鯥摝硉睩廘熝踛蕗螰簬鵱淕塶蹗")
+("lx82" "巒鑾鸞灤臠圞欒曫羉癵")
+("lx83" "卵")
+("lx84" "亂薍")
+("lx9 " "掄")
+("lx92" "倫論輪淪崙侖綸掄圇碖錀惀陯菕踚棆蜦")
+("lx93" "稐")
+("lx94" "論溣")
+("lxo " "囉")
+("lxo2" "羅螺蘿鑼邏籮騾囉玀儸覶摞欏蔂鏍鸁剆")
+("lxo3" "裸瘰臝蠃蓏鎯")
+("lxo4" "落駱洛絡雒烙酪濼犖咯珞纙袼硌鮥鵅峈")
+("ly " "摟")
+("ly2" "樓嘍婁螻髏僂蔞廔漊耬熡謱艛鞻鷜瞜")
+("ly3" "簍摟塿嶁")
+("ly4" "漏陋露鏤瘺")
+("lz " "撈")
+("lz2" "勞牢癆澇嘮醪浶鐒簩蟧嶗")
+("lz3" "老姥佬栳狫轑咾橑銠恅荖")
+("lz4" "勞絡烙酪嫪軂橯僗")
+("m " "ㄇ")
+("m-2" "蒙盟萌矇朦濛檬懵幪甍瞢艨虻曚甿礞氋雺莔儚蕄鄳鄸饛鸏")
+("m-3" "猛蜢艋錳懵蠓懞瓾")
+("m-4" "夢孟霿霥")
+("m02" "忙芒茫盲氓尨硭邙哤奀杗盳鋩娏牻痝蛖駹蘉鼆笀")
+("m03" "莽蟒漭汒庬硥茻壾")
+("m82" "蠻饅瞞蹣漫顢謾鰻璊悗慲槾鬘鬗")
+("m83" "滿屘矕")
+("m84" "慢漫曼蔓幔嫚鏝縵墁熳澫僈獌")
+("m9 " "悶")
+("m91" "們")
+("m92" "門們捫樠鍆穈菛虋")
+("m93" "暪")
+("m94" "悶燜懣")
+("ma " "媽嗎嬤")
+("ma1" "嘛嗎蟆")
+("ma2" "麻痲嘛麼蟆犘")
+("ma3" "馬螞碼瑪溤嗎鎷鷌嘜")
+("ma4" "罵禡傌榪")
+("me " "咪瞇")
+("me-2" "明名鳴銘螟冥瞑暝茗酩溟蓂鄍洺榠嫇覭詺熐")
+("me-3" "眳姳慏")
+("me-4" "命暝")
+("me2" "迷彌謎瀰靡糜麋縻獼蘼冞麛醚醾檷蘪攠瓕爢麊鸍")
+("me3" "米靡弭敉眯銤渳葞蔝濔灖")
+("me4" "密蜜秘祕覓泌汨謐宓冪塓幦鼏羃幎漞糸峚榓滵蔤蠠嘧")
+("me82" "棉綿眠媔婂蝒櫋矊矏")
+("me83" "免勉緬冕娩靦湎沔偭眄絻丏俛愐喕鮸")
+("me84" "面麵")
+("me92" "民岷玟緡痻苠忞旻鈱旼錉罠閺怋崏暋")
+("me93" "敏憫閔閩抿泯皿湣愍黽澠笢敃刡僶簢敯潣")
+("mew " "咩乜羋")
+("mew4" "滅蔑衊篾蠛幭覕搣薎懱瀎礣鱴")
+("mey " "唒")
+("mey4" "謬")
+("mez " "喵")
+("mez2" "苗描瞄鱙")
+("mez3" "秒渺藐邈緲杳眇淼杪篎")
+("mez4" "妙廟繆玅")
+("mi2" "埋霾薶")
+("mi3" "買嘪鷶")
+("mi4" "賣麥邁脈勱蝐")
+("mo " "摸")
+("mo1" "麼")
+("mo2" "模磨摩膜糢魔摹謨蘑劘嫫藦髍")
+("mo3" "抹")
+("mo4" "末莫默漠沒膜寞陌歿脈沫秣茉驀墨貊磨瘼靺歾饃鄚纆霢嚜眽瞙藦暯枺爅妺万銆鏌貘粖蛨袹嗼塻慔蟔鬕莈覛縸嘜")
+("mq2" "沒煤眉枚梅媒莓霉玫黴楣湄嵋苺禖郿堳瑂脢鋂呅腜塺徾攗")
+("mq3" "美每鎂浼媺渼媄挴燘")
+("mq4" "妹媚寐昧眛魅瑁沬袂痗韎煝蝞")
+("mr1" "麼")
+("mx2" "模氁")
+("mx3" "母畝牡姆拇牳鉧姥峔砪")
+("mx4" "木目幕牧慕墓募穆睦暮沐苜鶩楘霂鉬炑坶毣蚞幙鞪莯")
+("my2" "謀眸繆牟侔蝥鍪蛑麰洠鉾鴾呣哞")
+("my3" "某冇踇")
+("mz " "貓")
+("mz2" "毛茅矛髦錨旄蟊芼蝥髳媌堥罞酕嫹鶜枆軞渵")
+("mz3" "卯昴泖茆")
+("mz4" "帽冒貌貿茂瑁懋旄耄媢楙眊瞀芼袤毷艒萺鄮")
+("n " "ㄋ")
+("n-2" "能薴儜")
+("n-4" "濘")
+("n0 " "囔")
+("n01" "囔")
+("n02" "囊")
+("n03" "曩攮灢")
+("n04" "齉")
+("n8 " "囝囡")
+("n82" "南男難喃楠柟暔諵奻萳莮")
+("n83" "赧戁蝻湳腩揇")
+("n84" "難婻")
+("n94" "嫩")
+("na2" "拿挐拏誽")
+("na3" "那哪")
+("na4" "那納吶訥鈉捺娜肭衲軜妠豽魶笝")
+("ne-2" "寧凝獰嚀檸甯擰鸋鑏寍聹嬣")
+("ne-3" "擰")
+("ne-4" "濘佞")
+("ne02" "娘孃")
+("ne04" "釀")
+("ne2" "泥尼妮倪霓怩猊蜺輗郳麑鯓鯢齯臡秜狋觬婗淣呢狔屔跜鈮鶂")
+("ne3" "你妳擬禰儗旎昵坭柅薿檷抳苨馜隬譺")
+("ne4" "逆溺匿膩泥睨暱惄鷁鷊嫟縌迡堄")
+("ne82" "年黏粘姩哖")
+("ne83" "捻撚攆拈輦碾輾涊簐跈躎鯰")
+("ne84" "念唸淰齞廿鼰")
+("ne92" "您")
+("ne93" "拰")
+("new " "捏踗鑈")
+("new2" "苶")
+("new4" "孽鎳躡聶鑷涅囁囓臬乜嚙臲闑隉齧敜顳糱蘗疌嵲踂篞櫱蠥钀巕")
+("ney " "妞")
+("ney2" "牛")
+("ney3" "紐扭鈕忸狃炄莥")
+("ney4" "拗")
+("nez3" "鳥裊嬲嬝嫋蔦褭")
+("nez4" "尿")
+("ni2" "孻摨")
+("ni3" "乃奶迺氖嬭奈氝釢艿尕")
+("ni4" "耐奈褦鼐柰倷螚渿錼")
+("nq3" "餒哪腇")
+("nq4" "內")
+("nr " "呢")
+("nu3" "女籹釹")
+("nu4" "忸恧衄朒")
+("nuw4" "虐瘧謔")
+("nx-2" "農濃膿儂噥穠襛醲齈鬞")
+("nx-4" "弄")
+("nx2" "奴駑孥笯蒘")
+("nx3" "努弩砮")
+("nx4" "怒")
+("nx83" "暖餪煖渜")
+("nxo2" "挪娜儺捼梛")
+("nxo3" "橠")
+("nxo4" "諾懦糯搦挼逽懧糑")
+("ny2" "羺獳")
+("ny4" "耨鎒嗕譨")
+("nz " "峱")
+("nz2" "撓鐃橈呶猱怓譊髐嶩獶繷獿夒")
+("nz3" "腦惱瑙")
+("nz4" "鬧淖")
+("o " "喔ㄛ")
+("o2" "哦")
+("p " "ㄆ")
+("p- " "砰烹抨怦漰澎匉閛恲軯駍磞")
+("p-2" "朋彭澎蓬膨硼棚鵬篷蟛芃淜鬅痭錋倗輣傰韸髼憉樥鑝")
+("p-3" "捧皏")
+("p-4" "碰堋掽椪")
+("p0 " "乓磅滂")
+("p02" "旁龐膀螃徬蒡厖尨雱逄庬篣舽")
+("p03" "嗙耪")
+("p04" "胖")
+("p8 " "潘攀眅")
+("p82" "盤磐蟠般胖槃蹣磻踫鞶幋縏柈瀊蒰媻搫跘")
+("p83" "坢")
+("p84" "判叛盼畔拚袢泮襻詊頄溿沜牉頖")
+("p9 " "噴歕")
+("p92" "盆湓葐")
+("p93" "呠翸翉")
+("pa " "趴葩啪蚆舥")
+("pa2" "爬扒琶耙杷跁")
+("pa4" "怕帕帊袙")
+("pe " "批披匹劈霹砒被丕坯坏伾狉紕秠鈹鴄怌翍釽憵銔駓髬")
+("pe- " "乒娉砯頩覮")
+("pe-2" "平瓶憑評屏蘋萍坪枰泙帡洴缾軿俜玶甹苹郱呯竮艵蛢馮荓蓱炾")
+("pe-3" "絣")
+("pe2" "皮疲脾琵枇裨啤毗埤沘貔陂羆罷紕郫陴鼙鈹膍毘阰蚽蜱玭笓鈚錍魾螷犤毞猈藣蠯")
+("pe3" "否匹疋痞嚭苤仳庀圮崥諀")
+("pe4" "譬闢僻媲屁辟癖甓擗澼濞淠揊潎鷿髲礔")
+("pe8 " "篇偏扁翩萹媥貵頨鶣")
+("pe82" "便胼駢諞蹁楩骿")
+("pe84" "片騙遍")
+("pe9 " "拼姘礗涄")
+("pe92" "貧瀕頻顰嬪嚬矉")
+("pe93" "品")
+("pe94" "聘牝")
+("pew " "瞥撇氕")
+("pew3" "撇")
+("pez " "飄漂慓螵薸僄旚翲魒")
+("pez2" "瓢嫖淲")
+("pez3" "漂莩縹瞟殍皫摽醥犥鷅")
+("pez4" "票漂剽驃彯篻顠蔈")
+("pi " "拍啪")
+("pi2" "排牌徘俳簰棑")
+("pi3" "矲俖")
+("pi4" "派湃鎃蒎")
+("po " "波潑坡陂鏺癹翍")
+("po2" "婆鄱皤櫇")
+("po3" "頗剖叵笸")
+("po4" "破迫魄珀泊朴粕醱岶烞蒪")
+("pq " "胚呸坏醅柸岯垺衃")
+("pq2" "培賠陪裴邳碚毰陫荖")
+("pq3" "琣昢")
+("pq4" "配佩沛珮霈帔旆浿轡姵翇伂")
+("px " "撲仆鋪噗扑痡醭抪瞨")
+("px2" "僕樸葡蒲菩朴蹼脯濮璞匍莆蒱襆酺釙鏷轐纀墣")
+("px3" "普浦埔譜圃溥烳氆鐠潽誧")
+("px4" "暴鋪瀑曝舖")
+("py " "剖吥")
+("py2" "掊裒抔捊")
+("py3" "剖瓿棓婄")
+("pz " "拋脬")
+("pz2" "袍咆刨匏庖麃炰齙鞄炮瓟")
+("pz3" "跑")
+("pz4" "泡砲炮皰奅麭髱")
+("q " "ㄟ")
+("r " "阿婀痾ㄜ屙峉錒")
+("r2" "額訛鵝娥哦蛾峨莪俄囮吪硪蚵鋨迗珴涐皒睋魤")
+("r3" "噁")
+("r4" "惡餓俄鄂厄遏鍔扼鱷顎呃愕噩軛阨鶚堊諤萼咢啞崿搤詻閼頞堨齶枙堮岋鑩櫮砐砨蚅豟軶圔搹蝁嶭餩蘁")
+("s " "司思斯絲私撕廝鷥嘶ㄙ澌緦偲罳颸禠虒楒鍶凘泀蕬鉰俬覗榹禗蜤磃謕蟴鷈鼶")
+("s- " "僧鬙")
+("s0 " "喪桑")
+("s03" "嗓顙搡磉鎟褬")
+("s04" "喪")
+("s1" "思")
+("s3" "死")
+("s4" "四似賜嗣飼寺肆祀食俟伺泗巳耜儩姒笥駟兕涘柶汜肂貄蕼洍")
+("s8 " "三參毿攕鬖")
+("s83" "散傘繖糝鏾")
+("s84" "散閐")
+("s9 " "森槮罧襂幓篸")
+("sa " "撒仨")
+("sa3" "灑撒靸洒")
+("sa4" "薩卅趿颯攃馺隡")
+("si " "塞鰓腮毢揌")
+("si4" "賽塞僿")
+("sr4" "色塞瑟圾嗇澀穡濇轖譅銫璱翜犞飋濏")
+("sx " "蘇甦酥穌囌櫯")
+("sx- " "松鬆淞嵩忪菘娀崧濍倯硹蜙")
+("sx-3" "聳慫悚竦傱愯嵷駷")
+("sx-4" "送宋頌訟誦")
+("sx2" "俗")
+("sx4" "訴速素肅宿塑夙粟溯餗愬蓿縮觫愫膆謖嗉橚泝涑潚簌蔌樕遫驌鱐鷫嫊玊榡洬栜傃溹憟鋉縤藗僳窣")
+("sx8 " "酸痠狻")
+("sx83" "匴")
+("sx84" "算蒜筭")
+("sx9 " "孫飧蓀猻搎槂薞蕵")
+("sx93" "損筍榫簨鎨")
+("sx94" "潠愻")
+("sxo " "縮梭莎唆娑簑嗦傞挲蓑桫蹜莏趖摍")
+("sxo3" "所索鎖瑣璅嗩摵鎍鏼")
+("sxo4" "逤")
+("sxq " "雖綏濉睢荽毸眭浽哸娞荾滖")
+("sxq2" "隨隋雟")
+("sxq3" "髓嶲瀡巂靃")
+("sxq4" "歲遂碎穗隧祟燧誶睟穟璲檖襚鐩邃埣賥檅繀禭旞繸鐆")
+("sy " "搜颼鄋蒐廋溲餿獀醙嗖鎪騪")
+("sy3" "叟嗾藪擻瞍謏籔")
+("sy4" "嗽")
+("sz " "艘騷繅搔臊慅溞颾鱢")
+("sz3" "掃嫂埽")
+("sz4" "掃臊氉瘙")
+("t " "ㄊ")
+("t-2" "疼騰藤籐謄滕螣縢")
+("t0 " "湯鏜鼞蹚蝪")
+("t02" "堂糖唐塘膛螳棠醣搪鏜溏螗瑭赯榶樘漟煻鎕闛橖蓎磄踼薚鶶")
+("t03" "倘躺儻淌帑惝钂鎲戃曭爣矘")
+("t04" "趟燙鐋摥")
+("t8 " "貪灘攤癱坍怹抩舑緂探")
+("t82" "談彈痰潭譚檀壇曇罈覃郯錟餤驔鐔倓醰貚婒憛藫橝黮鷤")
+("t83" "坦毯袒襢忐禫菼贉嗿膻憳醓裧")
+("t84" "探嘆歎碳炭賧埮湠羰")
+("ta " "它他她牠塌褟祂禢")
+("ta3" "塔榙鎝")
+("ta4" "踏榻蹋塌獺搨遢嚃躂沓嗒撻遝闥鎉闒錔鞜鞳鰨羍涾傝毾誻鑉漯迖濌龘")
+("te " "梯踢剔焍")
+("te- " "聽廳汀桯艼耵")
+("te-2" "停庭廷亭蜓霆婷渟莛朾筳蝏聤葶鼮楟榳閮嵉綎")
+("te-3" "挺艇町梃頲珽脡鋌烶圢侹")
+("te-4" "聽")
+("te2" "題提啼堤蹄醍禔稊緹荑騠隄鶗惿厗鍗偍趧謕鶙崹睼蝭蕛鷤鯷鵜")
+("te3" "體体綈")
+("te4" "替惕涕屜悌剃銻嚏倜薙殢裼揥籊鬄悐褅逖鵜")
+("te8 " "天添倎屇酟婖")
+("te82" "田甜填恬闐畋窴沺盷湉菾磌")
+("te83" "舔忝殄腆靦淟餂賟悿蚕晪痶")
+("te84" "掭煔瑱")
+("tew " "貼帖怗")
+("tew3" "鐵帖驖僣")
+("tew4" "帖餮蛈")
+("tez " "挑祧恌庣鮡")
+("tez2" "條調笤佻迢蜩髫岧苕齠鰷鞗芀鎥趒祒")
+("tez3" "挑窕誂宨嬥")
+("tez4" "跳眺糶朓覜頫絩窱脁")
+("ti " "胎苔")
+("ti2" "台臺抬颱苔邰跆檯薹炱駘鮐儓嬯籉旲秮")
+("ti4" "太態泰汰鈦燤溙呔傣")
+("tr4" "特慝忒忑鋱貣蟘")
+("tx " "禿鵚涋捸嶀")
+("tx- " "通恫蓪痌炵熥狪")
+("tx-2" "同童銅桐潼瞳彤佟僮峒侗艟曈膧穜罿硐橦氃獞茼烔浵鉖餇仝酮迵粡絧朣犝蕫鮦鼨爞哃詷")
+("tx-3" "統筒桶捅垌筩姛")
+("tx-4" "痛衕慟蘳")
+("tx2" "圖途突徒塗屠凸荼涂余酴瘏稌腯峹葖鵚捈怢鍎跿梌湥筡蒤瑹駼鶟鷋鼵嵞廜潳鷵")
+("tx3" "土吐釷芏唋")
+("tx4" "兔吐菟鵵堍")
+("tx8 " "湍煓貒")
+("tx82" "團摶糰漙剸慱鏄鷻槫")
+("tx84" "彖褖")
+("tx9 " "吞暾啍涒旽")
+("tx92" "屯囤豚飩臀軘魨忳芚吨拵")
+("tx93" "汆吨畽")
+("tx94" "褪螁")
+("txo " "脫拖托託堶侂挩扥矺沰馲侻詑魠")
+("txo2" "駝陀馱沱佗鴕跎橐坨紽酡砣阤鮀岮碢鞁驒鼉鉈袉飥")
+("txo3" "妥橢撱庹嫷")
+("txo4" "拓唾柝籜蘀跅毻毤")
+("txq " "推蓷藬")
+("txq2" "頹穨隤魋橔僓蹪弚")
+("txq3" "腿俀")
+("txq4" "退蛻駾螁")
+("ty " "偷媮")
+("ty1" "頭")
+("ty2" "頭投牏酘")
+("ty3" "黈妵紏鈄蘣")
+("ty4" "透斢")
+("tz " "掏濤滔饕韜弢絛縚搯慆槄幍翢嫍蜪")
+("tz2" "逃桃陶萄淘濤啕洮燾檮匋咷綯鞀醄騊錭駣祹鋾")
+("tz3" "討")
+("tz4" "套")
+("u " "淤迂瘀紆ㄩ毹箊扜穻盓")
+("u- " "傭庸雍擁壅癰臃墉鏞慵饔邕廱雝嗈灉鄘噰澭蕹滽郺")
+("u-2" "傭喁顒傛槦嫆嵱嫞")
+("u-3" "永泳詠勇擁踴湧蛹甬壅恿臃俑踊埇塎禜涌悀銢")
+("u-4" "用佣醟")
+("u2" "於愉魚娛餘于漁予愚余竽榆逾虞俞輿瑜渝隅臾腴盂諛踰舁圩歟覦畬萸嵎窬妤揄歈禺轝隃雩杅楰玗緰羭蝓褕瘐艅狳邘璵硢籅釪崳湡鄃腧睮雓澞蕍螸謣鮽鵌蘛鸆鸒衧唹堣堬雽歶旟鰅齵")
+("u3" "與語雨予羽嶼宇禹庾齬噢圄圉窳傴俁敔噳楀瑀与萭貐偊祤斞鄅寙篽蘌斔螤")
+("u4" "育遇預玉欲域喻愈譽獄慾浴裕煜寓禦與鈺豫御鬱籲諭癒郁馭昱毓芋尉熨俞峪聿嫗彧飫鬻谷鷸燠蜮堉語瘉棫澦矞禺罭蕷遹閾隩鵒棜淢燏獝繘魊薁驈悆鴥鋊淯黦栯砡礜欥軉輍悇稢蒮噊鳿醧饇爩灪戫袬緎蓹錥")
+("u8 " "冤淵鴛鳶宛眢蜎鵷肙鋺惌棩蒬裷鼘葾蜵裫駌嬽灁")
+("u82" "原元員園圓緣源援媛袁猿垣沅轅爰圜黿嫄櫞芫湲騵笎羱蝯邧蝝妧萲螈蚖杬榞溒媴猭獂榬蒝鎱邍鶢")
+("u83" "遠妴")
+("u84" "院願怨苑遠媛瑗愿掾褑夗謜禐噮")
+("u9 " "暈氳縕贇奫蝹")
+("u92" "雲云勻昀耘芸紜熅筠溳澐畇篔沄熉鋆蕓妘伝縜荺鄖枃眃")
+("u93" "允隕殞狁霣褞抎賱輑鈗阭")
+("u94" "運韻孕熨蘊慍醞惲暈韞鄆薀枟緷鶤員")
+("uw " "約曰噦箹焥")
+("uw4" "月越樂悅閱粵躍岳嶽耀鑰曜藥鉞說刖瀹籥樾爚礿禴趯軏鸑龠狘玥戉泧鈅抈蚎蘥鸙")
+("v " "ㄍ")
+("v- " "更耕庚粳羹賡浭緪鶊菮揯")
+("v-3" "梗耿哽綆鯁埂骾郠挭")
+("v-4" "更亙堩")
+("v0 " "剛鋼缸崗綱岡肛扛杠罡疘舡釭堽碙棡笐堈犅")
+("v03" "港崗")
+("v04" "槓")
+("v8 " "乾甘干竿肝尷柑坩泔咁疳玕杆矸虷筸蜬鳱嵅")
+("v83" "敢感趕桿橄稈澉皯盰赶")
+("v84" "幹贛凎淦紺旰骭詌榦灨涻簳嵅")
+("v9 " "跟根")
+("v92" "哏")
+("v93" "艮")
+("v94" "亙艮茛")
+("va " "嘎旮")
+("va1" "價")
+("va2" "軋噶釓")
+("va4" "尬")
+("vi " "該垓陔賅荄侅峐胲祴絯豥賌隑")
+("vi3" "改")
+("vi4" "概蓋丐鈣溉戤摡瓂")
+("vq3" "給")
+("vr " "哥歌割鴿擱胳戈肐疙渮牁菏滒麧")
+("vr1" "個")
+("vr2" "格革隔閣葛骼蛤咯膈轕嗝搿郃韐塥觡鬲閤挌佮輵鮯敆茖愅獦鎘鞷齃")
+("vr3" "葛哿舸擖魺騔笴")
+("vr4" "個各鉻虼箇")
+("vx " "姑孤辜咕沽估菇菰呱蛄痼箍鴣觚酤泒罛箛鈷鮕夃柧鈲軱家嫴橭")
+("vx- " "工公功供攻宮恭躬弓蚣紅龔肱觥疘釭篢塨愩匑共幊")
+("vx-3" "鞏拱汞共珙礦栱廾拲蛬穬")
+("vx-4" "共供貢羾摃")
+("vx0 " "光胱洸桄珖炚茪銧垙烡")
+("vx03" "廣獷")
+("vx04" "逛桄臩臦矌")
+("vx2" "骨鶻")
+("vx3" "股古鼓骨谷穀賈凸蠱汩牯滑罟嘏詁轂鵠瞽臌盬羖蛌扢鈷杚淈狜唃尳榖蓇濲瀔愲縎薣")
+("vx4" "故固顧雇僱錮告估痼梏榾牿堌崮凅棝稒")
+("vx8 " "官關觀冠棺矜鰥綸倌莞瘝毌鱞")
+("vx83" "管館莞琯筦脘痯錧")
+("vx84" "慣貫灌罐摜盥鸛冠觀丱爟瓘祼矔鑵涫悺悹雚鱹")
+("vx93" "滾袞鯀緄輥掍蔉")
+("vx94" "棍璭")
+("vxa " "瓜括刮蝸颳呱聒鴰栝适騧胍腡筈葀劀瘑緺懖趏膼")
+("vxa3" "寡剮")
+("vxa4" "掛卦褂罫罣絓詿挂髺")
+("vxi " "乖")
+("vxi3" "拐柺枴")
+("vxi4" "怪旝夬廥癐")
+("vxo " "郭鍋蟈堝嘓崞埻墎濄")
+("vxo2" "國幗虢馘摑聝膕漍慖簂")
+("vxo3" "果裹槨蜾輠粿猓淉惈鐹錁")
+("vxo4" "過")
+("vxq " "歸規龜瑰閨圭珪皈傀媯槻鮭槼邽窐溈嫢摫")
+("vxq3" "鬼軌詭癸匭晷宄簋佹垝氿姽蟡庪祪蛫觤厬")
+("vxq4" "貴桂櫃跪劌溎鱖昋炔筀柜嶡襘暩")
+("vy " "句溝勾鉤枸泃篝緱构芶耩")
+("vy3" "狗茍岣枸苟笱耇茩蚼")
+("vy4" "夠購垢構媾彀搆詬遘覯冓姤雊傋瞉簼韝唦")
+("vz " "高糕膏篙羔皋櫜睪鼛槔睾滜韟")
+("vz3" "稿攪搞槁縞杲暠檺筶")
+("vz4" "告誥郜鋯祰煰")
+("w " "ㄝ")
+("w4" "誒")
+("x " "屋烏污汙圬誣嗚巫鎢鄔洿歍ㄨ惡於杇陓剭窏腛鴮螐")
+("x- " "翁嗡螉鶲霐")
+("x-3" "蓊滃暡浻瞈聬塕")
+("x-4" "甕瓮齆罋")
+("x0 " "汪尪尢")
+("x02" "王亡")
+("x03" "往網枉罔惘魍輞瀇网暀菵臦")
+("x04" "忘妄望旺王朢迋莣")
+("x2" "無吳吾梧巫蕪唔蜈誣毋亡牾膴麌鼯郚鋘鋙峿浯珸俉鯃莁鷡洖瞴譕")
+("x3" "五午武舞侮伍鵡憮嫵潕廡仵忤碔甒摀啎捂嵨玝倵橆躌")
+("x4" "勿物務惡誤悟晤霧戊鎢塢兀兀騖寤軏杌婺鶩堊沕迕遻鋈屼扤煟卼焐靰阢粅矹芴埡逜痦齀蘁岉噁蓩")
+("x8 " "灣彎豌剜莞蜿刓潫")
+("x82" "完玩頑丸汍紈芄烷婠岏抏")
+("x83" "晚碗挽宛婉娩皖輓莞浣蜿畹菀琬鞔綰晼綩鯇倇脕睕鋄睌葂")
+("x84" "萬玩腕惋卍翫忨仴綄万蟃捥踠")
+("x9 " "溫瘟轀塭馧瞃豱殟")
+("x92" "文聞紋蚊玟雯閿炆芠琝閺闅鼤駇魰鳼")
+("x93" "穩吻刎呡桽")
+("x94" "問聞紊文汶抆免搵璺妏")
+("xa " "哇蛙挖窪呱媧洼穵溛窊窐漥")
+("xa2" "娃")
+("xa3" "瓦佤")
+("xa4" "襪嗢膃")
+("xi " "歪")
+("xi3" "舀")
+("xi4" "外")
+("xo " "窩倭渦萵猧踒")
+("xo3" "我婐捰")
+("xo4" "握臥沃渥斡齷幄涴偓濣焥")
+("xq " "威崴偎煨葳隈萎委逶烓椳渨碨愄揋葨隇溾詴蝛覣燰")
+("xq2" "為圍微危唯維惟違韋薇巍桅闈濰帷嵬幃囗湋溦鄬鍏鮠潿洈覹醀霺瀢濻癓欈")
+("xq3" "委尾偉緯萎諉葦痿猥煒亹隗娓韙寪洧瑋薳蘤韡鮪磈蒍頠暐痏骫椲浘艉芛鍡峗壝喡徫腲蜲儰蓶崣硊踓斖")
+("xq4" "為位未魏衛味偽謂胃喂慰餵尉渭畏蔚蘶蝟犩遺亹霨磑罻褽薉媦蜼藯鏏菋犚餧贀讆躗穌鮇徻")
+("y " "歐甌毆嘔謳鷗ㄡ慪區熰蓲櫙")
+("y2" "吽")
+("y3" "偶藕嘔耦吘湡腢蕅")
+("y4" "嘔漚噢")
+("z " "凹ㄠ坳柪")
+("z2" "熬敖遨翱嗷螯鰲鼇鏖驁廒獒璈聱鏊滶磝隞摮蔜簢謷爊")
+("z3" "襖媼芺镺")
+("z4" "傲澳奧懊墺奡扷擙拗詏嶴")
+)
+;; Local Variables:
+;; version-control: never
+;; no-update-autoloads: t
+;; End:
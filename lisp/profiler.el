@@ -41,6 +41,12 @@ profiler-sampling-interval
   :type 'integer
   :group 'profiler)
 
+(defcustom profiler-alloc-sampling-interval 65536
+  "Default sampling interval of the allocation profiler, in bytes."
+  :type 'integer
+  :version "27.1"
+  :group 'profiler)
+
 
 ;;; Utilities
 
@@ -161,7 +167,8 @@ profiler-fixup-log
                                 (:constructor profiler-make-profile))
   (tag 'profiler-profile)
   (version profiler-version)
-  ;; - `type' has a value indicating the kind of profile (`memory' or `cpu').
+  ;; - `type' has a value indicating the kind of profile (`memory', `cpu',
+  ;;   `allocation' or `survival').
   ;; - `log' indicates the profile log.
   ;; - `timestamp' has a value giving the time when the profile was obtained.
   ;; - `diff-p' indicates if this profile represents a diff between two profiles.
@@ -206,15 +213,20 @@ profiler-read-profile
 
 (defun profiler-running-p (&optional mode)
   "Return non-nil if the profiler is running.
-Optional argument MODE means only check for the specified mode (cpu or mem)."
+Optional argument MODE means only check for the specified mode (cpu,
+mem or alloc)."
   (cond ((eq mode 'cpu) (and (fboundp 'profiler-cpu-running-p)
                              (profiler-cpu-running-p)))
         ((eq mode 'mem) (profiler-memory-running-p))
+        ((eq mode 'alloc) (profiler-alloc-running-p))
         (t (or (profiler-running-p 'cpu)
-               (profiler-running-p 'mem)))))
+               (profiler-running-p 'mem)
+               (profiler-running-p 'alloc)))))
 
 (defvar profiler-cpu-log nil)
 (defvar profiler-memory-log nil)
+(defvar profiler-alloc-log nil
+  "The logs of the allocation profiler, as returned by `profiler-alloc-log'.")
 
 (defun profiler-cpu-profile ()
   "Return CPU profile."
@@ -230,6 +242,20 @@ profiler-memory-profile
    :timestamp (current-time)
    :log profiler-memory-log))
 
+(defun profiler-alloc-profile ()
+  "Return allocation profile."
+  (profiler-make-profile
+   :type 'allocation
+   :timestamp (current-time)
+   :log (nth 0 profiler-alloc-log)))
+
+(defun profiler-survival-profile ()
+  "Return profile of the allocations that survived a garbage collection."
+  (profiler-make-profile
+   :type 'survival
+   :timestamp (current-time)
+   :log (nth 1 profiler-alloc-log)))
+
 
 ;;; Calltrees
 
@@ -504,7 +530,8 @@ profiler-report-line-format
 	(count-percent (profiler-calltree-count-percent tree)))
     (profiler-format (cl-ecase (profiler-profile-type profiler-report-profile)
 		       (cpu profiler-report-cpu-line-format)
-		       (memory profiler-report-memory-line-format))
+		       ((memory allocation survival)
+			profiler-report-memory-line-format))
 		     name-part
 		     (if diff-p
 			 (list (if (> count 0)
@@ -593,7 +620,9 @@ profiler-report-mode-map
 
 (defun profiler-report-make-buffer-name (profile)
   (format "*%s-Profiler-Report %s*"
-          (cl-ecase (profiler-profile-type profile) (cpu 'CPU) (memory 'Memory))
+          (cl-ecase (profiler-profile-type profile)
+            (cpu 'CPU) (memory 'Memory)
+            (allocation 'Allocation) (survival 'Survival))
           (format-time-string "%Y-%m-%d %T" (profiler-profile-timestamp profile))))
 
 (defun profiler-report-setup-buffer-1 (profile)
@@ -739,7 +768,15 @@ profiler-report-render-calltree-1
 	    (memory
 	     (profiler-report-header-line-format
 	      profiler-report-memory-line-format
-	      "Function" (list "Bytes" "%")))))
+	      "Function" (list "Bytes" "%")))
+	    ((allocation survival)
+	     (profiler-report-header-line-format
+	      profiler-report-memory-line-format
+	      "Function" (list (if (eq (profiler-profile-type profile)
+				       'survival)
+				   "Bytes kept"
+				 "Bytes")
+			       "%")))))
     (let ((predicate (cl-ecase order
 		       (ascending #'profiler-calltree-count<)
 		       (descending #'profiler-calltree-count>))))
@@ -811,14 +848,22 @@ profiler-report-write-profile
 ;;;###autoload
 (defun profiler-start (mode)
   "Start/restart profilers.
-MODE can be one of `cpu', `mem', or `cpu+mem'.
+MODE can be one of `cpu', `mem', `cpu+mem' or `alloc'.
 If MODE is `cpu' or `cpu+mem', time-based profiler will be started.
-Also, if MODE is `mem' or `cpu+mem', then memory profiler will be started."
+Also, if MODE is `mem' or `cpu+mem', then memory profiler will be started.
+If MODE is `alloc', the allocation profiler is started, which reports
+the type of objects allocated and how many of them survive garbage
+collection."
   (interactive
-   (list (if (not (fboundp 'profiler-cpu-start)) 'mem
-           (intern (completing-read "Mode (default cpu): "
-                                    '("cpu" "mem" "cpu+mem")
-                                    nil t nil nil "cpu")))))
+   (list (intern (completing-read (if (fboundp 'profiler-cpu-start)
+                                      "Mode (default cpu): "
+                                    "Mode (default mem): ")
+                                  (if (fboundp 'profiler-cpu-start)
+                                      '("cpu" "mem" "cpu+mem" "alloc")
+                                    '("mem" "alloc"))
+                                  nil t nil nil
+                                  (if (fboundp 'profiler-cpu-start)
+                                      "cpu" "mem")))))
   (cl-ecase mode
     (cpu
      (profiler-cpu-start profiler-sampling-interval)
@@ -829,7 +874,10 @@ profiler-start
     (cpu+mem
      (profiler-cpu-start profiler-sampling-interval)
      (profiler-memory-start)
-     (message "CPU and memory profiler started"))))
+     (message "CPU and memory profiler started"))
+    (alloc
+     (profiler-alloc-start profiler-alloc-sampling-interval)
+     (message "Allocation profiler started"))))
 
 (defun profiler-stop ()
   "Stop started profilers.  Profiler logs will be kept."
@@ -839,13 +887,22 @@ profiler-stop
     (setq profiler-cpu-log (profiler-cpu-log)))
   (when (profiler-memory-running-p)
     (setq profiler-memory-log (profiler-memory-log)))
-  (let ((cpu (when (fboundp 'profiler-cpu-stop) (profiler-cpu-stop)))
-        (mem (profiler-memory-stop)))
+  (when (profiler-alloc-running-p)
+    (setq profiler-alloc-log (profiler-alloc-log)))
+  (let* ((cpu (when (fboundp 'profiler-cpu-stop) (profiler-cpu-stop)))
+         (mem (profiler-memory-stop))
+         (alloc (profiler-alloc-stop))
+         (stopped (delq nil (list (and cpu "CPU")
+                                  (and mem "memory")
+                                  (and alloc "allocation"))))
+         (names (if (cdr stopped)
+                    (concat (mapconcat #'identity (butlast stopped) ", ")
+                            " and " (car (last stopped)))
+                  (car stopped))))
     (message "%s profiler stopped"
-             (cond ((and mem cpu) "CPU and memory")
-                   (mem "Memory")
-                   (cpu "CPU")
-                   (t "No")))))
+             (if names
+                 (concat (upcase (substring names 0 1)) (substring names 1))
+               "No"))))
 
 (defun profiler-reset ()
   "Reset profiler logs."
@@ -854,8 +911,11 @@ profiler-reset
     (profiler-cpu-stop))
   (when (profiler-memory-running-p)
     (profiler-memory-stop))
+  (when (profiler-alloc-running-p)
+    (profiler-alloc-stop))
   (setq profiler-cpu-log nil
-        profiler-memory-log nil))
+        profiler-memory-log nil
+        profiler-alloc-log nil))
 
 (defun profiler-report-cpu ()
   (when profiler-cpu-log
@@ -865,6 +925,11 @@ profiler-report-memory
   (when profiler-memory-log
     (profiler-report-profile-other-window (profiler-memory-profile))))
 
+(defun profiler-report-alloc ()
+  (when profiler-alloc-log
+    (profiler-report-profile-other-window (profiler-survival-profile))
+    (profiler-report-profile-other-window (profiler-alloc-profile))))
+
 (defun profiler-report ()
   "Report profiling results."
   (interactive)
@@ -872,10 +937,14 @@ profiler-report
     (setq profiler-cpu-log (profiler-cpu-log)))
   (when (profiler-memory-running-p)
     (setq profiler-memory-log (profiler-memory-log)))
-  (if (and (not profiler-cpu-log) (not profiler-memory-log))
+  (when (profiler-alloc-running-p)
+    (setq profiler-alloc-log (profiler-alloc-log)))
+  (if (and (not profiler-cpu-log) (not profiler-memory-log)
+           (not profiler-alloc-log))
       (user-error "No profiler run recorded")
     (profiler-report-cpu)
-    (profiler-report-memory)))
+    (profiler-report-memory)
+    (profiler-report-alloc)))
 
 ;;;###autoload
 (defun profiler-find-profile (filename)
@@ -40,6 +40,7 @@ Copyright (C) 1985-1986, 1988, 1993-1995, 1997-2019 Free Software
 #include "sysstdio.h"
 #include "systime.h"
 #include "character.h"
+#include "coding.h"
 #include "buffer.h"
 #include "window.h"
 #include "keyboard.h"
@@ -226,6 +227,19 @@ #define GC_DEFAULT_THRESHOLD (100000 * word_size)
 
 intmax_t consing_until_gc;
 
+/* The value consing_until_gc was set to after the last collection.  */
+
+static intmax_t gc_threshold;
+
+/* Estimated seconds of GC pause per byte of heap, used for pacing
+   collections with `gc-pause-budget'.  Zero if not yet known.  */
+
+static double gc_pause_cost;
+
+/* True if there was a collection since memory was last trimmed.  */
+
+static bool gc_trim_pending;
+
 #ifdef HAVE_PDUMPER
 /* Number of finalizers run: used to loop over GC until we stop
    generating garbage.  */
@@ -255,6 +269,89 @@ #define GC_DEFAULT_THRESHOLD (100000 * word_size)
   object_ct total_buffers;
 } gcstat;
 
+/* The phases of a garbage collection that are timed separately, as
+   reported by `gc-trace'.  */
+
+enum gc_phase
+  {
+    GC_PHASE_FINISH_SWEEP,
+    GC_PHASE_COMPACT_BUFFERS,
+    GC_PHASE_ROOTS,
+    GC_PHASE_STACK,
+    GC_PHASE_BUFFERS,
+    GC_PHASE_FINALIZERS,
+    GC_PHASE_WEAK_TABLES,
+    GC_PHASE_SWEEP_STRINGS,
+    GC_PHASE_SWEEP_CONSES,
+    GC_PHASE_SWEEP_FLOATS,
+    GC_PHASE_SWEEP_INTERVALS,
+    GC_PHASE_SWEEP_SYMBOLS,
+    GC_PHASE_SWEEP_BUFFERS,
+    GC_PHASE_SWEEP_VECTORS,
+    GC_PHASES
+  };
+
+static char const *const gc_phase_names[GC_PHASES] =
+  {
+    "finish-sweep", "compact-buffers", "roots", "stack", "buffers",
+    "finalizers", "weak-tables", "sweep-strings", "sweep-conses",
+    "sweep-floats", "sweep-intervals", "sweep-symbols", "sweep-buffers",
+    "sweep-vectors"
+  };
+
+/* The types of objects for which `gc-trace' reports the bytes freed.  */
+
+enum gc_trace_type
+  {
+    GC_TYPE_CONSES,
+    GC_TYPE_FLOATS,
+    GC_TYPE_SYMBOLS,
+    GC_TYPE_STRINGS,
+    GC_TYPE_VECTORS,
+    GC_TYPE_INTERVALS,
+    GC_TYPES
+  };
+
+static char const *const gc_type_names[GC_TYPES] =
+  {
+    "conses", "floats", "symbols", "strings", "vectors", "intervals"
+  };
+
+/* What is known about one garbage collection.  */
+
+struct gc_trace_record
+{
+  /* When the collection started, and how long it took.  */
+  struct timespec start, elapsed;
+
+  /* Time spent in each phase.  */
+  struct timespec phase[GC_PHASES];
+
+  /* Number of bytes freed for each type of object.  */
+  byte_ct freed[GC_TYPES];
+};
+
+/* The last GC_TRACE_SIZE garbage collections, in a ring buffer.
+   GC_TRACE_NEXT is the slot for the next collection, and GC_TRACE_USED
+   the number of slots filled so far.  */
+
+enum { GC_TRACE_SIZE = 64 };
+static struct gc_trace_record gc_trace[GC_TRACE_SIZE];
+static int gc_trace_next, gc_trace_used;
+
+/* The record of the collection in progress, and when its current
+   phase started.  */
+
+static struct gc_trace_record *gc_trace_current;
+static struct timespec gc_phase_start;
+
+/* Allocation counters and the number of live objects at the end of
+   the previous collection, to compute the bytes freed by the next
+   one for the types not counted while sweeping.  */
+
+static EMACS_INT gc_prev_consed[GC_TYPES];
+static object_ct gc_prev_live[GC_TYPES];
+
 /* Points to memory space allocated as "spare", to be freed if we run
    out of memory.  We keep one large block, four cons-blocks, and
    two string blocks.  */
@@ -974,10 +1071,10 @@ lisp_free (void *block)
     return;
 
   MALLOC_BLOCK_INPUT;
-  free (block);
 #ifndef GC_MALLOC_CHECK
   mem_delete (mem_find (block));
 #endif
+  free (block);
   MALLOC_UNBLOCK_INPUT;
 }
 
@@ -1378,6 +1475,8 @@ make_interval (void)
   gcstat.total_free_intervals--;
   RESET_INTERVAL (val);
   val->gcmarkbit = 0;
+  if (profiler_alloc_running)
+    alloc_probe (Qintervals, Qnil, sizeof (struct interval));
   return val;
 }
 
@@ -1866,6 +1965,13 @@ allocate_string_data (struct Lisp_String *s,
     }
 
   consing_until_gc -= needed;
+
+  if (profiler_alloc_running)
+    {
+      Lisp_Object string;
+      XSETSTRING (string, s);
+      alloc_probe (Qstrings, string, needed);
+    }
 }
 
 
@@ -1913,6 +2019,9 @@ sweep_strings (void)
 		  /* String is dead.  Put it on the free-list.  */
 		  sdata *data = SDATA_OF_STRING (s);
 
+		  gc_trace_current->freed[GC_TYPE_STRINGS]
+		    += sizeof *s + STRING_BYTES (s);
+
 		  /* Save the size of S in its sdata so that we know
 		     how large that is.  Reset the sdata's string
 		     back-pointer so that we know it's free.  */
@@ -2437,6 +2546,14 @@ #define XFLOAT_UNMARK(fptr) \
 
 static struct Lisp_Float *float_free_list;
 
+/* Float blocks are swept lazily after GC, like cons blocks.  */
+
+static struct float_block **float_sweep_prev;
+static int float_sweep_lim;
+static object_ct float_sweep_free;
+
+static void sweep_float_block (void);
+
 /* Return a new float object with value FLOAT_VALUE.  */
 
 Lisp_Object
@@ -2446,6 +2563,9 @@ make_float (double float_value)
 
   MALLOC_BLOCK_INPUT;
 
+  while (!float_free_list && float_sweep_prev)
+    sweep_float_block ();
+
   if (float_free_list)
     {
       XSETFLOAT (val, float_free_list);
@@ -2460,6 +2580,8 @@ make_float (double float_value)
 	  new->next = float_block;
 	  memset (new->gcmarkbits, 0, sizeof new->gcmarkbits);
 	  float_block = new;
+	  if (float_sweep_prev == &float_block)
+	    float_sweep_prev = &new->next;
 	  float_block_index = 0;
 	  gcstat.total_free_floats += FLOAT_BLOCK_SIZE;
 	}
@@ -2474,6 +2596,8 @@ make_float (double float_value)
   consing_until_gc -= sizeof (struct Lisp_Float);
   floats_consed++;
   gcstat.total_free_floats--;
+  if (profiler_alloc_running)
+    alloc_probe (Qfloats, val, sizeof (struct Lisp_Float));
   return val;
 }
 
@@ -2491,8 +2615,8 @@ make_float (double float_value)
 #define CONS_BLOCK_SIZE						\
   (((BLOCK_BYTES - sizeof (struct cons_block *)			\
      /* The compiler might add padding at the end.  */		\
-     - (sizeof (struct Lisp_Cons) - sizeof (bits_word))) * CHAR_BIT)	\
-   / (sizeof (struct Lisp_Cons) * CHAR_BIT + 1))
+     - 2 * (sizeof (struct Lisp_Cons) - sizeof (bits_word))) * CHAR_BIT) \
+   / (sizeof (struct Lisp_Cons) * CHAR_BIT + 2))
 
 #define CONS_BLOCK(fptr) \
   (eassert (!pdumper_object_p (fptr)),                                  \
@@ -2535,11 +2659,30 @@ #define XUNMARK_CONS(fptr) \
 
 static struct Lisp_Cons *cons_free_list;
 
+/* Cons blocks are swept lazily after GC.  If non-null, this is the
+   link to the next cons block that still needs sweeping.  */
+
+static struct cons_block **cons_sweep_prev;
+
+/* Number of conses to sweep in that block, and number of free conses
+   found by sweeping so far.  */
+
+static int cons_sweep_lim;
+static object_ct cons_sweep_free;
+
+static void sweep_cons_block (void);
+
 /* Explicitly free a cons cell by putting it on the free-list.  */
 
 void
 free_cons (struct Lisp_Cons *ptr)
 {
+  /* A cons that survived the last GC in a block not swept yet still
+     has its mark bit, so Fcons would hand it out marked.  Unmarking
+     it would not do either, as the sweep would then put it on the
+     free list a second time.  Leave it for the next GC.  */
+  if (XCONS_MARKED_P (ptr))
+    return;
   ptr->u.s.u.chain = cons_free_list;
   ptr->u.s.car = dead_object ();
   cons_free_list = ptr;
@@ -2559,6 +2702,9 @@ DEFUN ("cons", Fcons, Scons, 2, 2, 0,
 
   MALLOC_BLOCK_INPUT;
 
+  while (!cons_free_list && cons_sweep_prev)
+    sweep_cons_block ();
+
   if (cons_free_list)
     {
       XSETCONS (val, cons_free_list);
@@ -2586,6 +2732,8 @@ DEFUN ("cons", Fcons, Scons, 2, 2, 0,
 	  memset (new->gcmarkbits, 0, sizeof new->gcmarkbits);
 	  new->next = cons_block;
 	  cons_block = new;
+	  if (cons_sweep_prev == &cons_block)
+	    cons_sweep_prev = &new->next;
 	  cons_block_index = 0;
 	  gcstat.total_free_conses += CONS_BLOCK_SIZE;
 	}
@@ -2601,6 +2749,8 @@ DEFUN ("cons", Fcons, Scons, 2, 2, 0,
   consing_until_gc -= sizeof (struct Lisp_Cons);
   gcstat.total_free_conses--;
   cons_cells_consed++;
+  if (profiler_alloc_running)
+    alloc_probe (Qconses, val, sizeof (struct Lisp_Cons));
   return val;
 }
 
@@ -3082,6 +3232,8 @@ sweep_vectors (void)
 		{
 		  cleanup_vector (next);
 		  ptrdiff_t nbytes = vector_nbytes (next);
+		  if (!PSEUDOVECTOR_TYPEP (&next->header, PVEC_FREE))
+		    gc_trace_current->freed[GC_TYPE_VECTORS] += nbytes;
 		  total_bytes += nbytes;
 		  next = ADVANCE (next, nbytes);
 		}
@@ -3128,6 +3280,10 @@ sweep_vectors (void)
 	}
       else
 	{
+	  gc_trace_current->freed[GC_TYPE_VECTORS]
+	    += (vector->header.size & PSEUDOVECTOR_FLAG
+		? vector_nbytes (vector)
+		: header_size + vector->header.size * word_size);
 	  *lvprev = lv->next;
 	  lisp_free (lv);
 	}
@@ -3185,6 +3341,15 @@ allocate_vectorlike (ptrdiff_t len)
 
   MALLOC_UNBLOCK_INPUT;
 
+  if (profiler_alloc_running)
+    {
+      /* The caller has yet to initialize the vector, but it cannot be
+	 examined by the GC before that.  */
+      Lisp_Object vector;
+      XSETVECTOR (vector, p);
+      alloc_probe (Qvectors, vector, nbytes);
+    }
+
   return ptr_bounds_clip (p, nbytes);
 }
 
@@ -3430,6 +3595,8 @@ init_symbol (Lisp_Object val, Lisp_Object name)
   p->u.s.trapped_write = SYMBOL_UNTRAPPED_WRITE;
   p->u.s.declared_special = false;
   p->u.s.pinned = false;
+  p->u.s.name_hash = symbol_name_hash (hash_string (SSDATA (name),
+						    SBYTES (name)));
 }
 
 DEFUN ("make-symbol", Fmake_symbol, Smake_symbol, 1, 1, 0,
@@ -3494,7 +3661,8 @@ build_overlay (Lisp_Object start, Lisp_Object end, Lisp_Object plist)
   OVERLAY_START (overlay) = start;
   OVERLAY_END (overlay) = end;
   set_overlay_plist (overlay, plist);
-  p->next = NULL;
+  p->left = p->right = p->parent = p->maxend = NULL;
+  p->red = false;
   return overlay;
 }
 
@@ -3508,7 +3676,9 @@ DEFUN ("make-marker", Fmake_marker, Smake_marker, 0, 0, 0,
   p->bytepos = 0;
   p->charpos = 0;
   p->next = NULL;
+  p->block = NULL;
   p->insertion_type = 0;
+  p->overlay_bound = 0;
   p->need_adjustment = 0;
   return make_lisp_ptr (p, Lisp_Vectorlike);
 }
@@ -3531,9 +3701,12 @@ build_marker (struct buffer *buf, ptrdiff_t charpos, ptrdiff_t bytepos)
   m->charpos = charpos;
   m->bytepos = bytepos;
   m->insertion_type = 0;
+  m->overlay_bound = 0;
   m->need_adjustment = 0;
   m->next = BUF_MARKERS (buf);
+  m->block = NULL;
   BUF_MARKERS (buf) = m;
+  index_marker (m);
   return make_lisp_ptr (m, Lisp_Vectorlike);
 }
 
@@ -3936,7 +4109,62 @@ refill_memory_reserve (void)
    lisp_free removes it with mem_delete.  Functions live_string_p etc
    call mem_find to lookup information about a given pointer in the
    tree, and use that to determine if the pointer points into a Lisp
-   object or not.  */
+   object or not.
+
+   Since every word on the C stack that looks like a pointer into the
+   heap is looked up this way, mem_find first consults a page index
+   and walks the tree only when that is inconclusive.  The address
+   space is divided into pages of BLOCK_ALIGN bytes, which are grouped
+   into regions of MEM_REGION_PAGES pages.  A small hash table maps
+   the number of each region containing Lisp data to a mem_region,
+   which records for each of its pages how many blocks of Lisp data
+   overlap the page, and which block that is if there is only one.
+   A pointer into a page that no block overlaps is thus rejected
+   without looking at the tree, and a pointer into a page with a
+   single owner needs only a bounds check.  Blocks allocated by
+   lisp_align_malloc are aligned on BLOCK_ALIGN and never share a
+   page, so the tree is only needed for the pages at the borders of
+   blocks allocated by lisp_malloc.  */
+
+/* Number of address bits within a page, and within a region.  */
+
+enum { MEM_PAGE_BITS = 10 };
+verify (BLOCK_ALIGN == 1 << MEM_PAGE_BITS);
+enum { MEM_REGION_BITS = 10, MEM_REGION_PAGES = 1 << MEM_REGION_BITS };
+
+/* Number of buckets in the hash table of regions.  Consecutive
+   regions go to consecutive buckets, so the chains stay short until
+   the heap spans MEM_REGION_BUCKETS regions.  */
+
+enum { MEM_REGION_BUCKETS = 1 << 10 };
+
+struct mem_page
+{
+  /* Number of blocks of Lisp data overlapping this page.  */
+  unsigned int nblocks;
+
+  /* The block overlapping this page if NBLOCKS is 1 and that block is
+     known, else null.  */
+  struct mem_node *node;
+};
+
+struct mem_region
+{
+  /* Next region in the same bucket.  */
+  struct mem_region *next;
+
+  /* Number of this region, i.e., the addresses it covers shifted
+     right by MEM_PAGE_BITS + MEM_REGION_BITS.  */
+  uintptr_t number;
+
+  /* Number of pages in this region with a nonzero NBLOCKS.  The
+     region is freed when this drops to zero.  */
+  int npages;
+
+  struct mem_page page[MEM_REGION_PAGES];
+};
+
+static struct mem_region *mem_regions[MEM_REGION_BUCKETS];
 
 /* Initialize this part of alloc.c.  */
 
@@ -3951,17 +4179,36 @@ mem_init (void)
 }
 
 
-/* Value is a pointer to the mem_node containing START.  Value is
-   MEM_NIL if there is no node in the tree containing START.  */
+/* Return the region numbered NUMBER, or null if there is none.  */
+
+static struct mem_region *
+mem_region_find (uintptr_t number)
+{
+  struct mem_region *r = mem_regions[number % MEM_REGION_BUCKETS];
+  while (r && r->number != number)
+    r = r->next;
+  return r;
+}
+
+/* Return the page index entry for the page containing P, or null if
+   no block of Lisp data is near P.  */
+
+static struct mem_page *
+mem_page_find (void *p)
+{
+  uintptr_t page = (uintptr_t) p >> MEM_PAGE_BITS;
+  struct mem_region *r = mem_region_find (page >> MEM_REGION_BITS);
+  return r ? &r->page[page % MEM_REGION_PAGES] : NULL;
+}
+
+/* Search the tree for the mem_node containing START.  Value is
+   MEM_NIL if there is none.  */
 
 static struct mem_node *
-mem_find (void *start)
+mem_tree_find (void *start)
 {
   struct mem_node *p;
 
-  if (start < min_heap_address || start > max_heap_address)
-    return MEM_NIL;
-
   /* Make the search always successful to speed up the loop below.  */
   mem_z.start = start;
   mem_z.end = (char *) start + 1;
@@ -3973,6 +4220,133 @@ mem_find (void *start)
 }
 
 
+/* Value is a pointer to the mem_node containing START.  Value is
+   MEM_NIL if there is no node in the tree containing START.  */
+
+static struct mem_node *
+mem_find (void *start)
+{
+  if (start < min_heap_address || start > max_heap_address)
+    return MEM_NIL;
+
+  struct mem_page *pg = mem_page_find (start);
+  if (!pg || pg->nblocks == 0)
+    return MEM_NIL;
+  if (pg->node)
+    return (pg->node->start <= start && start < pg->node->end
+	    ? pg->node : MEM_NIL);
+  return mem_tree_find (start);
+}
+
+
+/* Record in the page index that block X overlaps its pages.  */
+
+static void
+mem_index_insert (struct mem_node *x)
+{
+  uintptr_t first = (uintptr_t) x->start >> MEM_PAGE_BITS;
+  uintptr_t last = ((uintptr_t) x->end - 1) >> MEM_PAGE_BITS;
+  struct mem_region *r = NULL;
+
+  for (uintptr_t page = first; page <= last; page++)
+    {
+      uintptr_t number = page >> MEM_REGION_BITS;
+      if (!r || r->number != number)
+	{
+	  r = mem_region_find (number);
+	  if (!r)
+	    {
+#ifdef GC_MALLOC_CHECK
+	      r = calloc (1, sizeof *r);
+	      if (r == NULL)
+		emacs_abort ();
+#else
+	      r = xzalloc (sizeof *r);
+#endif
+	      r->number = number;
+	      r->next = mem_regions[number % MEM_REGION_BUCKETS];
+	      mem_regions[number % MEM_REGION_BUCKETS] = r;
+	    }
+	}
+
+      struct mem_page *pg = &r->page[page % MEM_REGION_PAGES];
+      if (pg->nblocks++ == 0)
+	{
+	  r->npages++;
+	  pg->node = x;
+	}
+      else
+	pg->node = NULL;
+    }
+}
+
+/* Remove the block from START to END from the page index.  This must
+   be called after the block has been removed from the tree.  */
+
+static void
+mem_index_delete (void *start, void *end)
+{
+  uintptr_t first = (uintptr_t) start >> MEM_PAGE_BITS;
+  uintptr_t last = ((uintptr_t) end - 1) >> MEM_PAGE_BITS;
+  struct mem_region *r = NULL;
+
+  for (uintptr_t page = first; page <= last; page++)
+    {
+      uintptr_t number = page >> MEM_REGION_BITS;
+      if (!r || r->number != number)
+	r = mem_region_find (number);
+      eassume (r);
+
+      struct mem_page *pg = &r->page[page % MEM_REGION_PAGES];
+      eassert (pg->nblocks > 0);
+      pg->node = NULL;
+      if (--pg->nblocks == 1)
+	{
+	  /* Find the remaining block if it reaches the start or end
+	     of the page; otherwise leave it to the tree.  */
+	  char *p = (char *) (page << MEM_PAGE_BITS);
+	  struct mem_node *m = mem_tree_find (p);
+	  if (m == MEM_NIL)
+	    m = mem_tree_find (p + BLOCK_ALIGN - 1);
+	  if (m != MEM_NIL)
+	    pg->node = m;
+	}
+      else if (pg->nblocks == 0 && --r->npages == 0)
+	{
+	  struct mem_region **prev = &mem_regions[number % MEM_REGION_BUCKETS];
+	  while (*prev != r)
+	    prev = &(*prev)->next;
+	  *prev = r->next;
+#ifdef GC_MALLOC_CHECK
+	  free (r);
+#else
+	  xfree (r);
+#endif
+	  r = NULL;
+	}
+    }
+}
+
+/* Make the pages of block Z, which was recorded with node Y in the
+   page index, refer to Z instead.  */
+
+static void
+mem_index_move (struct mem_node *y, struct mem_node *z)
+{
+  for (char *p = z->start; p < (char *) z->end; p += BLOCK_ALIGN)
+    {
+      struct mem_page *pg = mem_page_find (p);
+      eassume (pg);
+      if (pg->node == y)
+	pg->node = z;
+    }
+  struct mem_page *pg = mem_page_find ((char *) z->end - 1);
+  eassume (pg);
+  if (pg->node == y)
+    pg->node = z;
+}
+
+
 /* Insert a new node into the tree for a block of memory with start
    address START, end address END, and type TYPE.  Value is a
    pointer to the node that was inserted.  */
@@ -4028,6 +4402,7 @@ mem_insert (void *start, void *end, enum mem_type type)
   /* Re-establish red-black tree properties.  */
   mem_insert_fixup (x);
 
+  mem_index_insert (x);
   return x;
 }
 
@@ -4189,6 +4564,8 @@ mem_delete (struct mem_node *z)
   if (!z || z == MEM_NIL)
     return;
 
+  void *start = z->start, *end = z->end;
+
   if (z->left == MEM_NIL || z->right == MEM_NIL)
     y = z;
   else
@@ -4224,6 +4601,10 @@ mem_delete (struct mem_node *z)
   if (y->color == MEM_BLACK)
     mem_delete_fixup (x);
 
+  if (y != z)
+    mem_index_move (y, z);
+  mem_index_delete (start, end);
+
 #ifdef GC_MALLOC_CHECK
   free (y);
 #else
@@ -5358,6 +5739,8 @@ purecopy_hash_table (struct Lisp_Hash_Table *table)
   eassert (!pure->mutable);
   pure->rehash_threshold = table->rehash_threshold;
   pure->rehash_size = table->rehash_size;
+  pure->index_groups = table->index_groups;
+  pure->index_deleted = table->index_deleted;
   pure->key_and_value = purecopy (table->key_and_value);
   pure->test = pure_test;
 
@@ -5710,8 +6093,7 @@ visit_buffer_root (struct gc_root_visitor visitor,
   /* Buffers that are roots don't have intervals, an undo list, or
      other constructs that real buffers have.  */
   eassert (buffer->base_buffer == NULL);
-  eassert (buffer->overlays_before == NULL);
-  eassert (buffer->overlays_after == NULL);
+  eassert (buffer->overlays == NULL);
 
   /* Visit the buffer-locals.  */
   visit_vectorlike_root (visitor, (struct Lisp_Vector *) buffer, type);
@@ -5756,26 +6138,202 @@ mark_object_root_visitor (Lisp_Object const *root_ptr,
    returns.  */
 static struct Lisp_Hash_Table *weak_hash_tables;
 
+/* Entries of weak hash tables that survive only if some object not
+   yet marked turns out to be reachable.  An entry whose table is
+   NULL has been decided since it was queued.  These arrays are kept
+   between collections so that they need not be regrown every
+   time.  */
+static struct weak_entry
+{
+  struct Lisp_Hash_Table *h;
+  ptrdiff_t i;
+} *weak_entries;
+static ptrdiff_t weak_entries_size, nweak_entries;
+
+/* The objects the queued entries wait for, indexed by a hash table
+   chained through NEXT: a key-weak entry waits for its key, a
+   value-weak entry for its value and a key-or-value entry for both.
+   When marking reaches an object, its waiters are moved to
+   weak_ready, so that each entry is looked at again only when it can
+   have changed.  */
+static struct weak_waiter
+{
+  Lisp_Object obj;
+  ptrdiff_t entry;
+  ptrdiff_t next;
+} *weak_waiters;
+static ptrdiff_t weak_waiters_size, nweak_waiters;
+static ptrdiff_t *weak_waiter_index;
+static ptrdiff_t weak_waiter_index_size;
+
+/* Indices in weak_entries of the entries whose waited-for object has
+   been marked.  */
+static ptrdiff_t *weak_ready;
+static ptrdiff_t weak_ready_size, nweak_ready;
+
+static ptrdiff_t
+weak_waiter_bucket (Lisp_Object obj)
+{
+  EMACS_UINT u = XLI (obj);
+  u ^= u >> 5 ^ u >> 17;
+  return u & (weak_waiter_index_size - 1);
+}
+
+/* Make entry E wait for OBJ to be marked.  */
+
+static void
+add_weak_waiter (ptrdiff_t e, Lisp_Object obj)
+{
+  if (nweak_waiters == weak_waiters_size)
+    weak_waiters = xpalloc (weak_waiters, &weak_waiters_size, 1, -1,
+			    sizeof *weak_waiters);
+  if (2 * nweak_waiters >= weak_waiter_index_size)
+    {
+      /* Grow the index, and put the waiters that are still waiting
+	 back into it.  */
+      xfree (weak_waiter_index);
+      weak_waiter_index_size = max (64, 2 * weak_waiter_index_size);
+      weak_waiter_index = xnmalloc (weak_waiter_index_size,
+				    sizeof *weak_waiter_index);
+      for (ptrdiff_t b = 0; b < weak_waiter_index_size; b++)
+	weak_waiter_index[b] = -1;
+      for (ptrdiff_t w = 0; w < nweak_waiters; w++)
+	if (weak_waiters[w].entry >= 0)
+	  {
+	    ptrdiff_t b = weak_waiter_bucket (weak_waiters[w].obj);
+	    weak_waiters[w].next = weak_waiter_index[b];
+	    weak_waiter_index[b] = w;
+	  }
+    }
+  ptrdiff_t b = weak_waiter_bucket (obj);
+  weak_waiters[nweak_waiters] = (struct weak_waiter) { obj, e,
+						       weak_waiter_index[b] };
+  weak_waiter_index[b] = nweak_waiters++;
+}
+
+/* OBJ is being marked.  Move the entries waiting for it to
+   weak_ready.  */
+
+static void
+wake_weak_waiters (Lisp_Object obj)
+{
+  ptrdiff_t *p = &weak_waiter_index[weak_waiter_bucket (obj)];
+  while (*p >= 0)
+    {
+      struct weak_waiter *w = &weak_waiters[*p];
+      if (EQ (w->obj, obj))
+	{
+	  if (nweak_ready == weak_ready_size)
+	    weak_ready = xpalloc (weak_ready, &weak_ready_size, 1, -1,
+				  sizeof *weak_ready);
+	  weak_ready[nweak_ready++] = w->entry;
+	  w->entry = -1;
+	  *p = w->next;
+	}
+      else
+	p = &w->next;
+    }
+}
+
+/* If entry I of weak hash table H survives given what has been marked
+   so far, mark its key and value and return true.  Otherwise return
+   false.  */
+
+static bool
+mark_weak_entry (struct Lisp_Hash_Table *h, ptrdiff_t i)
+{
+  Lisp_Object key = HASH_KEY (h, i);
+  Lisp_Object value = HASH_VALUE (h, i);
+  bool key_survives = survives_gc_p (key);
+  bool value_survives = survives_gc_p (value);
+
+  if (!weak_entry_survives_p (h->weak, key_survives, value_survives))
+    return false;
+  if (!key_survives)
+    mark_object (key);
+  if (!value_survives)
+    mark_object (value);
+  return true;
+}
+
+/* Queue entry I of weak hash table H, whose fate is still open.  */
+
+static void
+queue_weak_entry (struct Lisp_Hash_Table *h, ptrdiff_t i)
+{
+  if (nweak_entries == weak_entries_size)
+    weak_entries = xpalloc (weak_entries, &weak_entries_size, 1, -1,
+			    sizeof *weak_entries);
+  ptrdiff_t e = nweak_entries++;
+  weak_entries[e] = (struct weak_entry) { h, i };
+  if (!EQ (h->weak, Qvalue))
+    add_weak_waiter (e, HASH_KEY (h, i));
+  if (!EQ (h->weak, Qkey))
+    add_weak_waiter (e, HASH_VALUE (h, i));
+}
+
 NO_INLINE /* For better stack traces */
 static void
 mark_and_sweep_weak_table_contents (void)
 {
   struct Lisp_Hash_Table *h;
-  bool marked;
-
-  /* Mark all keys and values that are in use.  Keep on marking until
-     there is no more change.  This is necessary for cases like
-     value-weak table A containing an entry X -> Y, where Y is used in a
-     key-weak table B, Z -> Y.  If B comes after A in the list of weak
-     tables, X -> Y might be removed from A, although when looking at B
-     one finds that it shouldn't.  */
+  struct Lisp_Hash_Table *scanned = NULL;
+  bool progress;
+
+  /* Mark all keys and values that are in use.  This is necessary for
+     cases like value-weak table A containing an entry X -> Y, where Y
+     is used in a key-weak table B, Z -> Y.  If B comes after A in the
+     list of weak tables, X -> Y might be removed from A, although
+     when looking at B one finds that it shouldn't.
+
+     Each table is scanned once, when it is first found.  The entries
+     whose fate is still open are queued, and looked at again only
+     when process_mark_stack reaches an object they wait for.  Thus a
+     chain of N entries, each keeping the key of the next alive, takes
+     N steps rather than N rounds over all the entries.  Entries of
+     key-and-value weak tables never make anything else survive, so
+     these tables need not be scanned at all.  */
   do
     {
-      marked = false;
-      for (h = weak_hash_tables; h; h = h->next_weak)
-        marked |= sweep_weak_table (h, false);
+      do
+	{
+	  /* Tables found since the previous round are at the front
+	     of the list.  */
+	  struct Lisp_Hash_Table *first = weak_hash_tables;
+	  for (h = first; h != scanned; h = h->next_weak)
+	    if (!EQ (h->weak, Qkey_and_value))
+	      for (ptrdiff_t i = 0, n = gc_asize (h->next); i < n; i++)
+		if (!EQ (HASH_KEY (h, i), Qunbound)
+		    && !mark_weak_entry (h, i))
+		  queue_weak_entry (h, i);
+	  scanned = first;
+
+	  while (nweak_ready > 0)
+	    {
+	      struct weak_entry *e = &weak_entries[weak_ready[--nweak_ready]];
+	      if (e->h && mark_weak_entry (e->h, e->i))
+		e->h = NULL;
+	    }
+	}
+      while (scanned != weak_hash_tables);
+
+      /* A few objects, such as the names of symbols, are marked
+	 without going through process_mark_stack, so that their
+	 waiters are never woken.  Catch these with a last pass.  */
+      progress = false;
+      for (ptrdiff_t e = 0; e < nweak_entries; e++)
+	if (weak_entries[e].h
+	    && mark_weak_entry (weak_entries[e].h, weak_entries[e].i))
+	  {
+	    weak_entries[e].h = NULL;
+	    progress = true;
+	  }
     }
-  while (marked);
+  while (progress);
+
+  nweak_entries = nweak_waiters = 0;
+  for (ptrdiff_t b = 0; b < weak_waiter_index_size; b++)
+    weak_waiter_index[b] = -1;
 
   /* Remove hash table entries that aren't used.  */
   while (weak_hash_tables)
@@ -5783,10 +6341,154 @@ mark_and_sweep_weak_table_contents (void)
       h = weak_hash_tables;
       weak_hash_tables = h->next_weak;
       h->next_weak = NULL;
-      sweep_weak_table (h, true);
+      sweep_weak_table (h);
     }
 }
 
+/* Start recording a garbage collection in the trace, and start
+   timing its first phase.  */
+
+static void
+gc_trace_begin (void)
+{
+  gc_trace_current = &gc_trace[gc_trace_next];
+  memset (gc_trace_current, 0, sizeof *gc_trace_current);
+  gc_trace_current->start = gc_phase_start = current_timespec ();
+}
+
+/* Start timing a phase of garbage collection, ignoring the time since
+   the previous phase ended.  */
+
+static void
+gc_phase_begin (void)
+{
+  gc_phase_start = current_timespec ();
+}
+
+/* Add the time since the current phase started to PHASE, and start
+   timing the next phase.  */
+
+static void
+gc_phase_end (enum gc_phase phase)
+{
+  struct timespec now = current_timespec ();
+  struct timespec *t = &gc_trace_current->phase[phase];
+  *t = timespec_add (*t, timespec_sub (now, gc_phase_start));
+  gc_phase_start = now;
+}
+
+/* Record the bytes of TYPE freed by this collection, given that
+   CONSED objects of SIZE bytes have been allocated so far and LIVE of
+   them survived.  */
+
+static void
+gc_trace_count_freed (enum gc_trace_type type, EMACS_INT consed,
+		      object_ct live, ptrdiff_t size)
+{
+  intmax_t freed = gc_prev_live[type] + (consed - gc_prev_consed[type]) - live;
+  gc_trace_current->freed[type] = max (freed, 0) * size;
+  gc_prev_consed[type] = consed;
+  gc_prev_live[type] = live;
+}
+
+/* Return REC as a list as described for `gc-trace'.  */
+
+static Lisp_Object
+gc_trace_record_to_lisp (struct gc_trace_record const *rec)
+{
+  Lisp_Object phases = Qnil, freed = Qnil;
+  for (int i = GC_PHASES - 1; 0 <= i; i--)
+    phases = Fcons (Fcons (intern (gc_phase_names[i]),
+			   make_float (timespectod (rec->phase[i]))),
+		    phases);
+  for (int i = GC_TYPES - 1; 0 <= i; i--)
+    freed = Fcons (Fcons (intern (gc_type_names[i]),
+			  make_uint (rec->freed[i])),
+		   freed);
+  return list4 (make_lisp_time (rec->start),
+		make_float (timespectod (rec->elapsed)), phases, freed);
+}
+
+/* Finish recording the current garbage collection, and return its
+   record.  The record is complete except for the time spent running
+   finalizers, which may collect garbage themselves.  */
+
+static struct gc_trace_record *
+gc_trace_end (void)
+{
+  struct gc_trace_record *rec = gc_trace_current;
+
+  rec->elapsed = timespec_sub (current_timespec (), rec->start);
+  gc_trace_count_freed (GC_TYPE_CONSES, cons_cells_consed,
+			gcstat.total_conses, sizeof (struct Lisp_Cons));
+  gc_trace_count_freed (GC_TYPE_FLOATS, floats_consed,
+			gcstat.total_floats, sizeof (struct Lisp_Float));
+  gc_trace_count_freed (GC_TYPE_SYMBOLS, symbols_consed,
+			gcstat.total_symbols, sizeof (struct Lisp_Symbol));
+  gc_trace_count_freed (GC_TYPE_INTERVALS, intervals_consed,
+			gcstat.total_intervals, sizeof (struct interval));
+
+  gc_trace_current = NULL;
+  gc_trace_next = (gc_trace_next + 1) % GC_TRACE_SIZE;
+  if (gc_trace_used < GC_TRACE_SIZE)
+    gc_trace_used++;
+  return rec;
+}
+
+/* The encoded absolute name of `gc-trace-file', or nil.  It is
+   computed when the variable is set, so that logging a collection
+   need not expand the file name or run file name handlers.  */
+
+static Lisp_Object gc_trace_file_name;
+
+/* Append REC to `gc-trace-file' if that is set.  */
+
+static void
+gc_trace_write (struct gc_trace_record const *rec)
+{
+  if (STRINGP (gc_trace_file_name) && NILP (Vmemory_full))
+    {
+      Lisp_Object line = Fprin1_to_string (gc_trace_record_to_lisp (rec),
+					   Qnil);
+      FILE *stream = emacs_fopen (SSDATA (gc_trace_file_name), "a");
+      if (stream)
+	{
+	  fwrite (SDATA (line), 1, SBYTES (line), stream);
+	  putc ('\n', stream);
+	  fclose (stream);
+	}
+    }
+}
+
+/* Return the number of bytes to allocate before the next collection
+   when pacing with `gc-pause-budget', given that this collection took
+   PAUSE seconds after CONSED bytes were allocated since the previous
+   one.  A pause is taken to last in proportion to the size of the
+   heap: marking visits the live objects and sweeping visits these and
+   the garbage.  So the threshold is the amount of garbage that would
+   make the next pause use up the budget, but at most
+   `gc-max-heap-overhead' times the live heap.  */
+
+static intmax_t
+gc_paced_threshold (double pause, intmax_t consed)
+{
+  double live = total_bytes_of_live_objects ();
+  double cost = pause / max (live + max (consed, 0), 1);
+
+  /* Smooth the estimate so that a single unusual pause does not make
+     the threshold swing.  */
+  gc_pause_cost = gc_pause_cost ? (gc_pause_cost + cost) / 2 : cost;
+
+  double threshold = (gc_pause_cost
+		      ? XFLOATINT (Vgc_pause_budget) / gc_pause_cost - live
+		      : INTMAX_MAX);
+  if (NUMBERP (Vgc_max_heap_overhead))
+    threshold = min (threshold, XFLOATINT (Vgc_max_heap_overhead) * live);
+  threshold = max (threshold, max (gc_cons_threshold,
+				   GC_DEFAULT_THRESHOLD / 10));
+  return threshold < INTMAX_MAX ? threshold : INTMAX_MAX;
+}
+
 /* Subroutine of Fgarbage_collect that does most of the work.  */
 static bool
 garbage_collect_1 (struct gcstat *gcst)
@@ -5797,12 +6499,22 @@ garbage_collect_1 (struct gcstat *gcst)
   ptrdiff_t count = SPECPDL_INDEX ();
   struct timespec start;
   byte_ct tot_before = 0;
+  intmax_t consed;
 
   eassert (weak_hash_tables == NULL);
 
   if (garbage_collection_inhibited)
     return false;
 
+  if (INT_SUBTRACT_WRAPV (gc_threshold, consing_until_gc, &consed))
+    consed = INTMAX_MAX;
+
+  gc_trace_begin ();
+
+  /* Marking needs the mark bits left over from the last GC cleared.  */
+  gc_finish_sweep ();
+  gc_phase_end (GC_PHASE_FINISH_SWEEP);
+
   /* Record this function, so it appears on the profiler's backtraces.  */
   record_in_backtrace (QAutomatic_GC, 0, 0);
 
@@ -5810,6 +6522,7 @@ garbage_collect_1 (struct gcstat *gcst)
      Do this early on, so it is no problem if the user quits.  */
   FOR_EACH_BUFFER (nextb)
     compact_buffer (nextb);
+  gc_phase_end (GC_PHASE_COMPACT_BUFFERS);
 
   if (profiler_memory_running)
     tot_before = total_bytes_of_live_objects ();
@@ -5871,6 +6584,7 @@ garbage_collect_1 (struct gcstat *gcst)
 
   /* Mark all the special slots that serve as the roots of accessibility.  */
 
+  gc_phase_begin ();
   struct gc_root_visitor visitor = { .visit = mark_object_root_visitor };
   visit_static_gc_roots (visitor);
 
@@ -5878,7 +6592,9 @@ garbage_collect_1 (struct gcstat *gcst)
   mark_pinned_symbols ();
   mark_terminals ();
   mark_kboards ();
+  gc_phase_end (GC_PHASE_ROOTS);
   mark_threads ();
+  gc_phase_end (GC_PHASE_STACK);
 
 #ifdef USE_GTK
   xg_mark_data ();
@@ -5891,6 +6607,7 @@ garbage_collect_1 (struct gcstat *gcst)
 #ifdef HAVE_MODULES
   mark_modules ();
 #endif
+  gc_phase_end (GC_PHASE_ROOTS);
 
   /* Everything is now marked, except for the data in font caches,
      undo lists, and finalizers.  The first two are compacted by
@@ -5905,7 +6622,10 @@ garbage_collect_1 (struct gcstat *gcst)
       /* Now that we have stripped the elements that need not be
 	 in the undo_list any more, we can finally mark the list.  */
       mark_object (BVAR (nextb, undo_list));
+      if (nextb->undo_log)
+	mark_undo_log (nextb);
     }
+  gc_phase_end (GC_PHASE_BUFFERS);
 
   /* Now pre-sweep finalizers.  Here, we add any unmarked finalizers
      to doomed_finalizers so we can run their associated functions
@@ -5916,10 +6636,12 @@ garbage_collect_1 (struct gcstat *gcst)
 
   queue_doomed_finalizers (&doomed_finalizers, &finalizers);
   mark_finalizer_list (&doomed_finalizers);
+  gc_phase_end (GC_PHASE_FINALIZERS);
 
   /* Must happen after all other marking and before gc_sweep.  */
   mark_and_sweep_weak_table_contents ();
   eassert (weak_hash_tables == NULL);
+  gc_phase_end (GC_PHASE_WEAK_TABLES);
 
   gc_sweep ();
 
@@ -5931,6 +6653,12 @@ garbage_collect_1 (struct gcstat *gcst)
 
   if (!NILP (Vmemory_full))
     consing_until_gc = memory_full_cons_threshold;
+  else if (NUMBERP (Vgc_pause_budget))
+    {
+      struct timespec pause = timespec_sub (current_timespec (),
+					    gc_trace_current->start);
+      consing_until_gc = gc_paced_threshold (timespectod (pause), consed);
+    }
   else
     {
       intmax_t threshold = max (gc_cons_threshold, GC_DEFAULT_THRESHOLD / 10);
@@ -5948,6 +6676,8 @@ garbage_collect_1 (struct gcstat *gcst)
 	}
       consing_until_gc = threshold;
     }
+  gc_threshold = consing_until_gc;
+  gc_trim_pending = true;
 
   if (garbage_collection_messages && NILP (Vmemory_full))
     {
@@ -5961,8 +6691,23 @@ garbage_collect_1 (struct gcstat *gcst)
 
   *gcst = gcstat;
 
-  /* GC is complete: now we can run our finalizer callbacks.  */
+  /* GC is complete: now we can run our finalizer callbacks.  They
+     may collect garbage themselves, so finish this collection's
+     record first and time them separately.  The record stays in the
+     ring unless they did so GC_TRACE_SIZE times.  */
+  struct gc_trace_record *rec = gc_trace_end ();
+  EMACS_INT gcs = gcs_done;
+  struct timespec finalizers_start = current_timespec ();
   run_finalizers (&doomed_finalizers);
+  if (gcs_done - gcs < GC_TRACE_SIZE)
+    {
+      struct timespec finalizers = timespec_sub (current_timespec (),
+						 finalizers_start);
+      rec->phase[GC_PHASE_FINALIZERS]
+	= timespec_add (rec->phase[GC_PHASE_FINALIZERS], finalizers);
+      rec->elapsed = timespec_add (rec->elapsed, finalizers);
+      gc_trace_write (rec);
+    }
 
   if (!NILP (Vpost_gc_hook))
     {
@@ -5988,6 +6733,8 @@ garbage_collect_1 (struct gcstat *gcst)
       byte_ct swept = tot_before <= tot_after ? 0 : tot_before - tot_after;
       malloc_probe (min (swept, SIZE_MAX));
     }
+  if (profiler_alloc_running)
+    alloc_probe_survivors ();
 
   return true;
 }
@@ -5999,6 +6746,66 @@ garbage_collect (void)
   garbage_collect_1 (&gcst);
 }
 
+/* Return the resident set size of Emacs in bytes, or -1 if unknown.  */
+
+static intmax_t
+resident_set_size (void)
+{
+#ifdef GNU_LINUX
+  FILE *stream = emacs_fopen ("/proc/self/statm", "r");
+  if (stream)
+    {
+      intmax_t size, resident;
+      int n = fscanf (stream, "%"SCNdMAX" %"SCNdMAX, &size, &resident);
+      fclose (stream);
+      if (n == 2)
+	return resident * getpagesize ();
+    }
+#endif
+  return -1;
+}
+
+/* Give memory that is no longer used back to the operating system,
+   keeping RETAIN bytes of free memory at the top of the heap.  Value
+   is the number of bytes by which the resident set shrank, or -1 if
+   that is unknown.  */
+
+static intmax_t
+gc_trim (size_t retain)
+{
+  gc_trim_pending = false;
+
+  /* Free the empty cons and float blocks that the lazy sweep has not
+     reached yet, so that the C library can release them.  */
+  gc_finish_sweep ();
+
+#ifdef HAVE_MALLOC_TRIM
+  intmax_t before = resident_set_size ();
+  malloc_trim (retain);
+  intmax_t after = resident_set_size ();
+  return before < 0 || after < 0 ? -1 : max (before - after, 0);
+#else
+  return -1;
+#endif
+}
+
+/* Called when Emacs is idle.  Collect garbage if a collection is
+   due or, when pacing with `gc-pause-budget', if at least half the
+   allowance for the next one has been used, so that pauses fall into
+   idle time rather than into commands.  Then finish sweeping.  */
+
+void
+gc_when_idle (void)
+{
+  if (consing_until_gc < 0
+      || (NUMBERP (Vgc_pause_budget) && consing_until_gc < gc_threshold / 2))
+    garbage_collect ();
+  if (gc_trim_pending && FIXNATP (Vgc_trim_retain))
+    gc_trim (XFIXNAT (Vgc_trim_retain));
+  else
+    gc_finish_sweep ();
+}
+
 DEFUN ("garbage-collect", Fgarbage_collect, Sgarbage_collect, 0, 0, "",
        doc: /* Reclaim storage for Lisp objects no longer needed.
 Garbage collection happens automatically if you cons more than
@@ -6092,12 +6899,102 @@ mark_glyph_matrix (struct glyph_matrix *matrix)
    Normally this is zero and the check never goes off.  */
 ptrdiff_t mark_object_loop_halt EXTERNALLY_VISIBLE;
 
+/* An entry of the mark stack: either a single object still to be
+   marked (N == 0), or N consecutive objects starting at VALUES, such
+   as the contents of a vector.  */
+struct mark_entry
+{
+  ptrdiff_t n;
+  union
+  {
+    Lisp_Object value;
+    Lisp_Object *values;
+  } u;
+};
+
+/* Objects reached but not yet marked are kept on this explicit stack
+   instead of on the C stack, so that marking a long chain of nested
+   objects does not recurse deeply.  The stack is kept between
+   collections so that it need not be regrown every time.  */
+static struct mark_stack
+{
+  struct mark_entry *stack;	/* Base of the stack.  */
+  ptrdiff_t size;		/* Allocated size, in entries.  */
+  ptrdiff_t sp;			/* Number of entries in use.  */
+} mark_stk;
+
+/* Make room for at least one more entry on the mark stack.  */
+
+static void
+grow_mark_stack (void)
+{
+  mark_stk.stack = xpalloc (mark_stk.stack, &mark_stk.size, 1, -1,
+			    sizeof *mark_stk.stack);
+  eassert (mark_stk.sp < mark_stk.size);
+}
+
+/* Push the single object VALUE onto the mark stack.  */
+
+static void
+mark_stack_push_value (Lisp_Object value)
+{
+  if (mark_stk.sp >= mark_stk.size)
+    grow_mark_stack ();
+  mark_stk.stack[mark_stk.sp++] = (struct mark_entry) {.n = 0,
+						       .u.value = value};
+}
+
+/* Push the N objects starting at VALUES onto the mark stack.  */
+
+static void
+mark_stack_push_values (Lisp_Object *values, ptrdiff_t n)
+{
+  if (n > 0)
+    {
+      if (mark_stk.sp >= mark_stk.size)
+	grow_mark_stack ();
+      mark_stk.stack[mark_stk.sp++] = (struct mark_entry) {.n = n,
+							   .u.values = values};
+    }
+}
+
+/* Pop and return the next object to mark.  The stack must not be
+   empty.  */
+
+static Lisp_Object
+mark_stack_pop (void)
+{
+  eassume (mark_stk.sp > 0);
+  struct mark_entry *e = &mark_stk.stack[mark_stk.sp - 1];
+  if (e->n == 0)
+    {
+      mark_stk.sp--;
+      return e->u.value;
+    }
+  /* Take the first object of a run, leaving the rest for later.  */
+  e->n--;
+  if (e->n == 0)
+    mark_stk.sp--;
+  return (++e->u.values)[-1];
+}
+
+static void process_mark_stack (ptrdiff_t);
+
+/* Mark the N objects starting at OBJS.  */
+
+static void
+mark_objects (Lisp_Object *objs, ptrdiff_t n)
+{
+  ptrdiff_t sp = mark_stk.sp;
+  mark_stack_push_values (objs, n);
+  process_mark_stack (sp);
+}
+
 static void
 mark_vectorlike (union vectorlike_header *header)
 {
   struct Lisp_Vector *ptr = (struct Lisp_Vector *) header;
   ptrdiff_t size = ptr->header.size;
-  ptrdiff_t i;
 
   eassert (!vector_marked_p (ptr));
 
@@ -6112,8 +7009,7 @@ mark_vectorlike (union vectorlike_header *header)
      the number of Lisp_Object fields that we should trace.
      The distinction is used e.g. by Lisp_Process which places extra
      non-Lisp_Object fields at the end of the structure...  */
-  for (i = 0; i < size; i++) /* ...and then mark its elements.  */
-    mark_object (ptr->contents[i]);
+  mark_objects (ptr->contents, size); /* ...and then mark its elements.  */
 }
 
 /* Like mark_vectorlike but optimized for char-tables (and
@@ -6142,35 +7038,36 @@ mark_char_table (struct Lisp_Vector *ptr, enum pvec_type pvectype)
 	    mark_char_table (XVECTOR (val), PVEC_SUB_CHAR_TABLE);
 	}
       else
-	mark_object (val);
+	mark_stack_push_value (val);
     }
 }
 
-NO_INLINE /* To reduce stack depth in mark_object.  */
-static Lisp_Object
-mark_compiled (struct Lisp_Vector *ptr)
-{
-  int i, size = ptr->header.size & PSEUDOVECTOR_SIZE_MASK;
+/* Mark the overlay PTR.  Its tree links are not followed here; the
+   buffer that owns the tree marks all of its nodes.  */
 
-  set_vector_marked (ptr);
-  for (i = 0; i < size; i++)
-    if (i != COMPILED_CONSTANTS)
-      mark_object (ptr->contents[i]);
-  return size > COMPILED_CONSTANTS ? ptr->contents[COMPILED_CONSTANTS] : Qnil;
+static void
+mark_overlay (struct Lisp_Overlay *ptr)
+{
+  set_vectorlike_marked (&ptr->header);
+  /* These two are always markers and can be marked fast.  */
+  set_vectorlike_marked (&XMARKER (ptr->start)->header);
+  set_vectorlike_marked (&XMARKER (ptr->end)->header);
+  mark_object (ptr->plist);
 }
 
-/* Mark the chain of overlays starting at PTR.  */
+/* Mark every overlay in the tree rooted at PTR.  An overlay that is
+   already marked may still have unmarked descendants, so the whole
+   tree is walked.  Its depth is logarithmic in the number of overlays,
+   so the recursion is shallow.  */
 
 static void
-mark_overlay (struct Lisp_Overlay *ptr)
+mark_overlay_tree (struct Lisp_Overlay *ptr)
 {
-  for (; ptr && !vectorlike_marked_p (&ptr->header); ptr = ptr->next)
+  for (; ptr; ptr = ptr->right)
     {
-      set_vectorlike_marked (&ptr->header);
-      /* These two are always markers and can be marked fast.  */
-      set_vectorlike_marked (&XMARKER (ptr->start)->header);
-      set_vectorlike_marked (&XMARKER (ptr->end)->header);
-      mark_object (ptr->plist);
+      if (!vectorlike_marked_p (&ptr->header))
+	mark_overlay (ptr);
+      mark_overlay_tree (ptr->left);
     }
 }
 
@@ -6190,8 +7087,7 @@ mark_buffer (struct buffer *buffer)
      a special way just before the sweep phase, and after stripping
      some of its elements that are not needed any more.  */
 
-  mark_overlay (buffer->overlays_before);
-  mark_overlay (buffer->overlays_after);
+  mark_overlay_tree (buffer->overlays);
 
   /* If this is an indirect buffer, mark its base buffer.  */
   if (buffer->base_buffer &&
@@ -6313,15 +7209,20 @@ mark_hash_table (struct Lisp_Vector *ptr)
 {
   struct Lisp_Hash_Table *h = (struct Lisp_Hash_Table *) ptr;
 
-  mark_vectorlike (&h->header);
-  mark_object (h->test.name);
-  mark_object (h->test.user_hash_function);
-  mark_object (h->test.user_cmp_function);
+  /* Push the contents onto the mark stack rather than recursing, as
+     hash tables can be nested deeply.  */
+  eassert (!vector_marked_p (ptr));
+  set_vector_marked (ptr);
+  mark_stack_push_values (ptr->contents,
+			  ptr->header.size & PSEUDOVECTOR_SIZE_MASK);
+  mark_stack_push_value (h->test.name);
+  mark_stack_push_value (h->test.user_hash_function);
+  mark_stack_push_value (h->test.user_cmp_function);
   /* If hash table is not weak, mark all keys and values.  For weak
      tables, mark only the vector and not its contents --- that's what
      makes it weak.  */
   if (NILP (h->weak))
-    mark_object (h->key_and_value);
+    mark_stack_push_value (h->key_and_value);
   else
     {
       eassert (h->next_weak == NULL);
@@ -6331,80 +7232,89 @@ mark_hash_table (struct Lisp_Vector *ptr)
     }
 }
 
-/* Determine type of generic Lisp_Object and mark it accordingly.
+/* Mark the objects on the mark stack above BASE_SP, and everything
+   reachable from them, until the stack is back down to BASE_SP.
 
-   This function implements a straightforward depth-first marking
-   algorithm and so the recursion depth may be very high (a few
-   tens of thousands is not uncommon).  To minimize stack usage,
-   a few cold paths are moved out to NO_INLINE functions above.
-   In general, inlining them doesn't help you to gain more speed.  */
+   This implements a depth-first marking algorithm using the explicit
+   mark stack above.  Conses, symbols, vectors, hash tables and the
+   values in char-tables are pushed onto that stack, so the C stack
+   depth does not depend on how deeply they are nested.  Buffers,
+   frames and windows are still marked by helper functions that call
+   mark_object, and so recurse on the C stack when one of them refers
+   to another; that nesting is at most as deep as there are such
+   objects.  Sub-char-tables are marked recursively too, but they are
+   nested at most three deep.  */
 
-void
-mark_object (Lisp_Object arg)
+static void
+process_mark_stack (ptrdiff_t base_sp)
 {
-  register Lisp_Object obj;
-  void *po;
 #if GC_CHECK_MARKED_OBJECTS
   struct mem_node *m = NULL;
 #endif
   ptrdiff_t cdr_count = 0;
 
-  obj = arg;
- loop:
+  eassume (mark_stk.sp >= base_sp && base_sp >= 0);
 
-  po = XPNTR (obj);
-  if (PURE_P (po))
-    return;
+  while (mark_stk.sp > base_sp)
+    {
+      Lisp_Object obj = mark_stack_pop ();
+    mark_obj: ;
+      void *po = XPNTR (obj);
+      if (PURE_P (po))
+	continue;
+
+      if (nweak_waiters > 0)
+	wake_weak_waiters (obj);
 
-  last_marked[last_marked_index++] = obj;
-  last_marked_index &= LAST_MARKED_SIZE - 1;
+      last_marked[last_marked_index++] = obj;
+      last_marked_index &= LAST_MARKED_SIZE - 1;
 
-  /* Perform some sanity checks on the objects marked here.  Abort if
-     we encounter an object we know is bogus.  This increases GC time
-     by ~80%.  */
+      /* Perform some sanity checks on the objects marked here.  Abort if
+	 we encounter an object we know is bogus.  This increases GC time
+	 by ~80%.  */
 #if GC_CHECK_MARKED_OBJECTS
 
-  /* Check that the object pointed to by PO is known to be a Lisp
-     structure allocated from the heap.  */
+      /* Check that the object pointed to by PO is known to be a Lisp
+	 structure allocated from the heap.  */
 #define CHECK_ALLOCATED()			\
-  do {						\
-    if (pdumper_object_p(po))                   \
-      {                                         \
-        if (!pdumper_object_p_precise (po))     \
-          emacs_abort ();                       \
-        break;                                  \
-      }                                         \
-    m = mem_find (po);				\
-    if (m == MEM_NIL)				\
-      emacs_abort ();				\
-  } while (0)
-
-  /* Check that the object pointed to by PO is live, using predicate
-     function LIVEP.  */
+      do {					\
+	if (pdumper_object_p (po))		\
+	  {					\
+	    if (!pdumper_object_p_precise (po))	\
+	      emacs_abort ();			\
+	    break;				\
+	  }					\
+	m = mem_find (po);			\
+	if (m == MEM_NIL)			\
+	  emacs_abort ();			\
+      } while (0)
+
+      /* Check that the object pointed to by PO is live, using predicate
+	 function LIVEP.  */
 #define CHECK_LIVE(LIVEP)			\
-  do {						\
-    if (pdumper_object_p(po))                   \
-      break;                                    \
-    if (!LIVEP (m, po))				\
-      emacs_abort ();				\
-  } while (0)
-
-  /* Check both of the above conditions, for non-symbols.  */
+      do {					\
+	if (pdumper_object_p (po))		\
+	  break;				\
+	if (!LIVEP (m, po))			\
+	  emacs_abort ();			\
+      } while (0)
+
+      /* Check both of the above conditions, for non-symbols.  */
 #define CHECK_ALLOCATED_AND_LIVE(LIVEP)		\
-  do {						\
-    CHECK_ALLOCATED ();				\
-    CHECK_LIVE (LIVEP);				\
-  } while (false)
+      do {					\
+	CHECK_ALLOCATED ();			\
+	CHECK_LIVE (LIVEP);			\
+      } while (false)
 
-  /* Check both of the above conditions, for symbols.  */
+      /* Check both of the above conditions, for symbols.  */
 #define CHECK_ALLOCATED_AND_LIVE_SYMBOL()	\
-  do {						\
-    if (!c_symbol_p (ptr))			\
-      {						\
-	CHECK_ALLOCATED ();			\
-	CHECK_LIVE (live_symbol_p);		\
-      }						\
-  } while (false)
+      do {					\
+	if (!c_symbol_p (ptr))			\
+	  {					\
+	    CHECK_ALLOCATED ();			\
+	    CHECK_LIVE (live_symbol_p);		\
+	  }					\
+      } while (false)
 
 #else /* not GC_CHECK_MARKED_OBJECTS */
 
@@ -6414,204 +7324,221 @@ #define CHECK_ALLOCATED_AND_LIVE_SYMBOL()	((void) 0)
 
 #endif /* not GC_CHECK_MARKED_OBJECTS */
 
-  switch (XTYPE (obj))
-    {
-    case Lisp_String:
-      {
-	register struct Lisp_String *ptr = XSTRING (obj);
-        if (string_marked_p (ptr))
-          break;
-	CHECK_ALLOCATED_AND_LIVE (live_string_p);
-        set_string_marked (ptr);
-        mark_interval_tree (ptr->u.s.intervals);
+      switch (XTYPE (obj))
+	{
+	case Lisp_String:
+	  {
+	    register struct Lisp_String *ptr = XSTRING (obj);
+	    if (string_marked_p (ptr))
+	      break;
+	    CHECK_ALLOCATED_AND_LIVE (live_string_p);
+	    set_string_marked (ptr);
+	    mark_interval_tree (ptr->u.s.intervals);
 #ifdef GC_CHECK_STRING_BYTES
-	/* Check that the string size recorded in the string is the
-	   same as the one recorded in the sdata structure.  */
-	string_bytes (ptr);
+	    /* Check that the string size recorded in the string is the
+	       same as the one recorded in the sdata structure.  */
+	    string_bytes (ptr);
 #endif /* GC_CHECK_STRING_BYTES */
-      }
-      break;
+	  }
+	  break;
 
-    case Lisp_Vectorlike:
-      {
-	register struct Lisp_Vector *ptr = XVECTOR (obj);
+	case Lisp_Vectorlike:
+	  {
+	    register struct Lisp_Vector *ptr = XVECTOR (obj);
 
-	if (vector_marked_p (ptr))
-	  break;
+	    if (vector_marked_p (ptr))
+	      break;
 
 #ifdef GC_CHECK_MARKED_OBJECTS
-        if (!pdumper_object_p(po))
-          {
-	    m = mem_find (po);
-            if (m == MEM_NIL && !SUBRP (obj) && !main_thread_p (po))
-	      emacs_abort ();
-          }
+	    if (!pdumper_object_p (po))
+	      {
+		m = mem_find (po);
+		if (m == MEM_NIL && !SUBRP (obj) && !main_thread_p (po))
+		  emacs_abort ();
+	      }
 #endif /* GC_CHECK_MARKED_OBJECTS */
 
-        enum pvec_type pvectype
-          = PSEUDOVECTOR_TYPE (ptr);
+	    enum pvec_type pvectype
+	      = PSEUDOVECTOR_TYPE (ptr);
 
-        if (pvectype != PVEC_SUBR &&
-            pvectype != PVEC_BUFFER &&
-            !main_thread_p (po))
-          CHECK_LIVE (live_vector_p);
+	    if (pvectype != PVEC_SUBR &&
+		pvectype != PVEC_BUFFER &&
+		!main_thread_p (po))
+	      CHECK_LIVE (live_vector_p);
 
-	switch (pvectype)
-	  {
-	  case PVEC_BUFFER:
+	    switch (pvectype)
+	      {
+	      case PVEC_BUFFER:
 #if GC_CHECK_MARKED_OBJECTS
-	    {
-	      struct buffer *b;
-	      FOR_EACH_BUFFER (b)
-		if (b == po)
-		  break;
-	      if (b == NULL)
-		emacs_abort ();
-	    }
+		{
+		  struct buffer *b;
+		  FOR_EACH_BUFFER (b)
+		    if (b == po)
+		      break;
+		  if (b == NULL)
+		    emacs_abort ();
+		}
 #endif /* GC_CHECK_MARKED_OBJECTS */
-	    mark_buffer ((struct buffer *) ptr);
-            break;
-
-          case PVEC_COMPILED:
-            /* Although we could treat this just like a vector, mark_compiled
-               returns the COMPILED_CONSTANTS element, which is marked at the
-               next iteration of goto-loop here.  This is done to avoid a few
-               recursive calls to mark_object.  */
-            obj = mark_compiled (ptr);
-            if (!NILP (obj))
-              goto loop;
-            break;
-
-          case PVEC_FRAME:
-            mark_frame (ptr);
-            break;
-
-          case PVEC_WINDOW:
-            mark_window (ptr);
-            break;
-
-	  case PVEC_HASH_TABLE:
-            mark_hash_table (ptr);
-	    break;
-
-	  case PVEC_CHAR_TABLE:
-	  case PVEC_SUB_CHAR_TABLE:
-	    mark_char_table (ptr, (enum pvec_type) pvectype);
-	    break;
-
-          case PVEC_BOOL_VECTOR:
-            /* bool vectors in a dump are permanently "marked", since
-               they're in the old section and don't have mark bits.
-               If we're looking at a dumped bool vector, we should
-               have aborted above when we called vector_marked_p(), so
-               we should never get here.  */
-            eassert (!pdumper_object_p (ptr));
-            set_vector_marked (ptr);
-            break;
-
-          case PVEC_OVERLAY:
-	    mark_overlay (XOVERLAY (obj));
-	    break;
-
-	  case PVEC_SUBR:
-	    break;
-
-	  case PVEC_FREE:
-	    emacs_abort ();
-
-	  default:
-	    /* A regular vector, or a pseudovector needing no special
-	       treatment.  */
-	    mark_vectorlike (&ptr->header);
+		mark_buffer ((struct buffer *) ptr);
+		break;
+
+	      case PVEC_FRAME:
+		mark_frame (ptr);
+		break;
+
+	      case PVEC_WINDOW:
+		mark_window (ptr);
+		break;
+
+	      case PVEC_HASH_TABLE:
+		mark_hash_table (ptr);
+		break;
+
+	      case PVEC_CHAR_TABLE:
+	      case PVEC_SUB_CHAR_TABLE:
+		mark_char_table (ptr, (enum pvec_type) pvectype);
+		break;
+
+	      case PVEC_BOOL_VECTOR:
+		/* bool vectors in a dump are permanently "marked", since
+		   they're in the old section and don't have mark bits.
+		   If we're looking at a dumped bool vector, we should
+		   have aborted above when we called vector_marked_p(), so
+		   we should never get here.  */
+		eassert (!pdumper_object_p (ptr));
+		set_vector_marked (ptr);
+		break;
+
+	      case PVEC_OVERLAY:
+		mark_overlay (XOVERLAY (obj));
+		break;
+
+	      case PVEC_SUBR:
+		break;
+
+	      case PVEC_FREE:
+		emacs_abort ();
+
+	      default:
+		{
+		  /* A regular vector, or a pseudovector needing no
+		     special treatment (including byte-code objects).
+		     Push its contents rather than recursing into
+		     mark_vectorlike.  */
+		  ptrdiff_t size = ptr->header.size;
+		  if (size & PSEUDOVECTOR_FLAG)
+		    size &= PSEUDOVECTOR_SIZE_MASK;
+		  set_vector_marked (ptr);
+		  mark_stack_push_values (ptr->contents, size);
+		}
+		break;
+	      }
 	  }
-      }
-      break;
+	  break;
 
-    case Lisp_Symbol:
-      {
-	struct Lisp_Symbol *ptr = XSYMBOL (obj);
-      nextsym:
-        if (symbol_marked_p (ptr))
-          break;
-        CHECK_ALLOCATED_AND_LIVE_SYMBOL ();
-        set_symbol_marked(ptr);
-	/* Attempt to catch bogus objects.  */
-	eassert (valid_lisp_object_p (ptr->u.s.function));
-	mark_object (ptr->u.s.function);
-	mark_object (ptr->u.s.plist);
-	switch (ptr->u.s.redirect)
+	case Lisp_Symbol:
 	  {
-	  case SYMBOL_PLAINVAL: mark_object (SYMBOL_VAL (ptr)); break;
-	  case SYMBOL_VARALIAS:
-	    {
-	      Lisp_Object tem;
-	      XSETSYMBOL (tem, SYMBOL_ALIAS (ptr));
-	      mark_object (tem);
+	    struct Lisp_Symbol *ptr = XSYMBOL (obj);
+	  nextsym:
+	    if (symbol_marked_p (ptr))
 	      break;
-	    }
-	  case SYMBOL_LOCALIZED:
-	    mark_localized_symbol (ptr);
-	    break;
-	  case SYMBOL_FORWARDED:
-	    /* If the value is forwarded to a buffer or keyboard field,
-	       these are marked when we see the corresponding object.
-	       And if it's forwarded to a C variable, either it's not
-	       a Lisp_Object var, or it's staticpro'd already.  */
-	    break;
-	  default: emacs_abort ();
+	    CHECK_ALLOCATED_AND_LIVE_SYMBOL ();
+	    set_symbol_marked (ptr);
+	    /* Attempt to catch bogus objects.  */
+	    eassert (valid_lisp_object_p (ptr->u.s.function));
+	    mark_stack_push_value (ptr->u.s.function);
+	    mark_stack_push_value (ptr->u.s.plist);
+	    switch (ptr->u.s.redirect)
+	      {
+	      case SYMBOL_PLAINVAL:
+		mark_stack_push_value (SYMBOL_VAL (ptr));
+		break;
+	      case SYMBOL_VARALIAS:
+		{
+		  Lisp_Object tem;
+		  XSETSYMBOL (tem, SYMBOL_ALIAS (ptr));
+		  mark_stack_push_value (tem);
+		  break;
+		}
+	      case SYMBOL_LOCALIZED:
+		mark_localized_symbol (ptr);
+		break;
+	      case SYMBOL_FORWARDED:
+		/* If the value is forwarded to a buffer or keyboard field,
+		   these are marked when we see the corresponding object.
+		   And if it's forwarded to a C variable, either it's not
+		   a Lisp_Object var, or it's staticpro'd already.  */
+		break;
+	      default: emacs_abort ();
+	      }
+	    if (!PURE_P (XSTRING (ptr->u.s.name)))
+	      set_string_marked (XSTRING (ptr->u.s.name));
+	    mark_interval_tree (string_intervals (ptr->u.s.name));
+	    /* Inner loop to mark next symbol in this bucket, if any.  */
+	    po = ptr = ptr->u.s.next;
+	    if (ptr)
+	      {
+		if (nweak_waiters > 0)
+		  wake_weak_waiters (make_lisp_symbol (ptr));
+		goto nextsym;
+	      }
 	  }
-	if (!PURE_P (XSTRING (ptr->u.s.name)))
-          set_string_marked (XSTRING (ptr->u.s.name));
-        mark_interval_tree (string_intervals (ptr->u.s.name));
-	/* Inner loop to mark next symbol in this bucket, if any.  */
-	po = ptr = ptr->u.s.next;
-	if (ptr)
-	  goto nextsym;
-      }
-      break;
-
-    case Lisp_Cons:
-      {
-	struct Lisp_Cons *ptr = XCONS (obj);
-	if (cons_marked_p (ptr))
 	  break;
-	CHECK_ALLOCATED_AND_LIVE (live_cons_p);
-        set_cons_marked (ptr);
-	/* If the cdr is nil, avoid recursion for the car.  */
-	if (NILP (ptr->u.s.u.cdr))
+
+	case Lisp_Cons:
 	  {
+	    struct Lisp_Cons *ptr = XCONS (obj);
+	    if (cons_marked_p (ptr))
+	      break;
+	    CHECK_ALLOCATED_AND_LIVE (live_cons_p);
+	    set_cons_marked (ptr);
+	    /* Leave the cdr for later and mark the car right away.  For
+	       a list of atoms this keeps the mark stack shallow.  */
+	    if (!NILP (ptr->u.s.u.cdr))
+	      {
+		mark_stack_push_value (ptr->u.s.u.cdr);
+		cdr_count++;
+		if (cdr_count == mark_object_loop_halt)
+		  emacs_abort ();
+	      }
+	    else
+	      cdr_count = 0;
 	    obj = ptr->u.s.car;
-	    cdr_count = 0;
-	    goto loop;
+	    goto mark_obj;
 	  }
-	mark_object (ptr->u.s.car);
-	obj = ptr->u.s.u.cdr;
-	cdr_count++;
-	if (cdr_count == mark_object_loop_halt)
-	  emacs_abort ();
-	goto loop;
-      }
 
-    case Lisp_Float:
-      CHECK_ALLOCATED_AND_LIVE (live_float_p);
-      /* Do not mark floats stored in a dump image: these floats are
-         "cold" and do not have mark bits.  */
-      if (pdumper_object_p (XFLOAT (obj)))
-        eassert (pdumper_cold_object_p (XFLOAT (obj)));
-      else if (!XFLOAT_MARKED_P (XFLOAT (obj)))
-        XFLOAT_MARK (XFLOAT (obj));
-      break;
+	case Lisp_Float:
+	  CHECK_ALLOCATED_AND_LIVE (live_float_p);
+	  /* Do not mark floats stored in a dump image: these floats are
+	     "cold" and do not have mark bits.  */
+	  if (pdumper_object_p (XFLOAT (obj)))
+	    eassert (pdumper_cold_object_p (XFLOAT (obj)));
+	  else if (!XFLOAT_MARKED_P (XFLOAT (obj)))
+	    XFLOAT_MARK (XFLOAT (obj));
+	  break;
 
-    case_Lisp_Int:
-      break;
+	case_Lisp_Int:
+	  break;
 
-    default:
-      emacs_abort ();
+	default:
+	  emacs_abort ();
+	}
     }
 
 #undef CHECK_LIVE
 #undef CHECK_ALLOCATED
 #undef CHECK_ALLOCATED_AND_LIVE
+#undef CHECK_ALLOCATED_AND_LIVE_SYMBOL
+}
+
+/* Mark OBJ and everything reachable from it.  */
+
+void
+mark_object (Lisp_Object obj)
+{
+  ptrdiff_t sp = mark_stk.sp;
+  mark_stack_push_value (obj);
+  process_mark_stack (sp);
 }
 
 /* Mark the Lisp pointers in the terminal objects.
@@ -6681,131 +7608,194 @@ survives_gc_p (Lisp_Object obj)
 
 
 
+/* Sweep the next cons block that is still unswept since the last GC,
+   putting its unmarked conses on the free list and clearing its mark
+   bits.  */
+
+static void
+sweep_cons_block (void)
+{
+  struct cons_block *cblk = *cons_sweep_prev;
+  int lim = cons_sweep_lim;
+  int this_free = 0;
+  int ilim = (lim + BITS_PER_BITS_WORD - 1) / BITS_PER_BITS_WORD;
+
+  /* Scan the mark bits an int at a time.  */
+  for (int i = 0; i < ilim; i++)
+    {
+      if (cblk->gcmarkbits[i] == BITS_WORD_MAX)
+	{
+	  /* Fast path - all cons cells for this int are marked.  */
+	  cblk->gcmarkbits[i] = 0;
+	}
+      else
+	{
+	  /* Some cons cells for this int are not marked.
+	     Find which ones, and free them.  */
+	  int start, pos, stop;
+
+	  start = i * BITS_PER_BITS_WORD;
+	  stop = lim - start;
+	  if (stop > BITS_PER_BITS_WORD)
+	    stop = BITS_PER_BITS_WORD;
+	  stop += start;
+
+	  for (pos = start; pos < stop; pos++)
+	    {
+	      struct Lisp_Cons *acons
+		= ptr_bounds_copy (&cblk->conses[pos], cblk);
+	      if (!XCONS_MARKED_P (acons))
+		{
+		  this_free++;
+		  cblk->conses[pos].u.s.u.chain = cons_free_list;
+		  cons_free_list = &cblk->conses[pos];
+		  cons_free_list->u.s.car = dead_object ();
+		}
+	      else
+		XUNMARK_CONS (acons);
+	    }
+	}
+    }
+
+  cons_sweep_lim = CONS_BLOCK_SIZE;
+  /* If this block contains only free conses and we have already
+     seen more than two blocks worth of free conses then deallocate
+     this block.  */
+  if (this_free == CONS_BLOCK_SIZE && cons_sweep_free > CONS_BLOCK_SIZE)
+    {
+      *cons_sweep_prev = cblk->next;
+      /* Unhook from the free list.  */
+      cons_free_list = cblk->conses[0].u.s.u.chain;
+      lisp_align_free (cblk);
+      gcstat.total_free_conses -= CONS_BLOCK_SIZE;
+    }
+  else
+    {
+      cons_sweep_free += this_free;
+      cons_sweep_prev = &cblk->next;
+    }
+  if (!*cons_sweep_prev)
+    cons_sweep_prev = NULL;
+}
+
+/* Account for the conses that survived marking, and arrange for the
+   cons blocks to be swept lazily: Fcons sweeps one block at a time
+   whenever it runs out of free conses, and gc_finish_sweep sweeps
+   whatever is left.  Only the mark bitmaps are read here, so this is
+   much cheaper than touching every cons.  */
+
 NO_INLINE /* For better stack traces */
 static void
 sweep_conses (void)
 {
-  struct cons_block **cprev = &cons_block;
   int lim = cons_block_index;
-  object_ct num_free = 0, num_used = 0;
+  object_ct num_slots = 0, num_used = 0;
 
-  cons_free_list = 0;
+  eassert (!cons_sweep_prev);
 
-  for (struct cons_block *cblk; (cblk = *cprev); )
+  for (struct cons_block *cblk = cons_block; cblk; cblk = cblk->next)
     {
-      int i = 0;
-      int this_free = 0;
       int ilim = (lim + BITS_PER_BITS_WORD - 1) / BITS_PER_BITS_WORD;
+      for (int i = 0; i < ilim; i++)
+	num_used += count_one_bits_word (cblk->gcmarkbits[i]);
+      num_slots += lim;
+      lim = CONS_BLOCK_SIZE;
+    }
 
-      /* Scan the mark bits an int at a time.  */
-      for (i = 0; i < ilim; i++)
-        {
-          if (cblk->gcmarkbits[i] == BITS_WORD_MAX)
-            {
-              /* Fast path - all cons cells for this int are marked.  */
-              cblk->gcmarkbits[i] = 0;
-              num_used += BITS_PER_BITS_WORD;
-            }
-          else
-            {
-              /* Some cons cells for this int are not marked.
-                 Find which ones, and free them.  */
-              int start, pos, stop;
+  /* Every free cons, old or new, is unmarked and will be put back on
+     the free list when its block is swept.  */
+  cons_free_list = 0;
+  cons_sweep_prev = cons_block ? &cons_block : NULL;
+  cons_sweep_lim = cons_block_index;
+  cons_sweep_free = 0;
 
-              start = i * BITS_PER_BITS_WORD;
-              stop = lim - start;
-              if (stop > BITS_PER_BITS_WORD)
-                stop = BITS_PER_BITS_WORD;
-              stop += start;
+  gcstat.total_conses = num_used;
+  gcstat.total_free_conses = num_slots - num_used;
+}
 
-              for (pos = start; pos < stop; pos++)
-                {
-		  struct Lisp_Cons *acons
-		    = ptr_bounds_copy (&cblk->conses[pos], cblk);
-		  if (!XCONS_MARKED_P (acons))
-                    {
-                      this_free++;
-                      cblk->conses[pos].u.s.u.chain = cons_free_list;
-                      cons_free_list = &cblk->conses[pos];
-                      cons_free_list->u.s.car = dead_object ();
-                    }
-                  else
-                    {
-                      num_used++;
-		      XUNMARK_CONS (acons);
-                    }
-                }
-            }
-        }
+/* Like sweep_cons_block, for float blocks.  */
 
-      lim = CONS_BLOCK_SIZE;
-      /* If this block contains only free conses and we have already
-         seen more than two blocks worth of free conses then deallocate
-         this block.  */
-      if (this_free == CONS_BLOCK_SIZE && num_free > CONS_BLOCK_SIZE)
-        {
-          *cprev = cblk->next;
-          /* Unhook from the free list.  */
-          cons_free_list = cblk->conses[0].u.s.u.chain;
-          lisp_align_free (cblk);
-        }
+static void
+sweep_float_block (void)
+{
+  struct float_block *fblk = *float_sweep_prev;
+  int lim = float_sweep_lim;
+  int this_free = 0;
+
+  for (int i = 0; i < lim; i++)
+    {
+      struct Lisp_Float *afloat = ptr_bounds_copy (&fblk->floats[i], fblk);
+      if (!XFLOAT_MARKED_P (afloat))
+	{
+	  this_free++;
+	  fblk->floats[i].u.chain = float_free_list;
+	  float_free_list = &fblk->floats[i];
+	}
       else
-        {
-          num_free += this_free;
-          cprev = &cblk->next;
-        }
+	XFLOAT_UNMARK (afloat);
     }
-  gcstat.total_conses = num_used;
-  gcstat.total_free_conses = num_free;
+
+  float_sweep_lim = FLOAT_BLOCK_SIZE;
+  /* If this block contains only free floats and we have already
+     seen more than two blocks worth of free floats then deallocate
+     this block.  */
+  if (this_free == FLOAT_BLOCK_SIZE && float_sweep_free > FLOAT_BLOCK_SIZE)
+    {
+      *float_sweep_prev = fblk->next;
+      /* Unhook from the free list.  */
+      float_free_list = fblk->floats[0].u.chain;
+      lisp_align_free (fblk);
+      gcstat.total_free_floats -= FLOAT_BLOCK_SIZE;
+    }
+  else
+    {
+      float_sweep_free += this_free;
+      float_sweep_prev = &fblk->next;
+    }
+  if (!*float_sweep_prev)
+    float_sweep_prev = NULL;
 }
 
+/* Like sweep_conses, for floats.  */
+
 NO_INLINE /* For better stack traces */
 static void
 sweep_floats (void)
 {
-  struct float_block **fprev = &float_block;
   int lim = float_block_index;
-  object_ct num_free = 0, num_used = 0;
+  object_ct num_slots = 0, num_used = 0;
 
-  float_free_list = 0;
+  eassert (!float_sweep_prev);
 
-  for (struct float_block *fblk; (fblk = *fprev); )
+  for (struct float_block *fblk = float_block; fblk; fblk = fblk->next)
     {
-      int this_free = 0;
-      for (int i = 0; i < lim; i++)
-	{
-	  struct Lisp_Float *afloat = ptr_bounds_copy (&fblk->floats[i], fblk);
-	  if (!XFLOAT_MARKED_P (afloat))
-	    {
-	      this_free++;
-	      fblk->floats[i].u.chain = float_free_list;
-	      float_free_list = &fblk->floats[i];
-	    }
-	  else
-	    {
-	      num_used++;
-	      XFLOAT_UNMARK (afloat);
-	    }
-	}
+      int ilim = (lim + BITS_PER_BITS_WORD - 1) / BITS_PER_BITS_WORD;
+      for (int i = 0; i < ilim; i++)
+	num_used += count_one_bits_word (fblk->gcmarkbits[i]);
+      num_slots += lim;
       lim = FLOAT_BLOCK_SIZE;
-      /* If this block contains only free floats and we have already
-         seen more than two blocks worth of free floats then deallocate
-         this block.  */
-      if (this_free == FLOAT_BLOCK_SIZE && num_free > FLOAT_BLOCK_SIZE)
-        {
-          *fprev = fblk->next;
-          /* Unhook from the free list.  */
-          float_free_list = fblk->floats[0].u.chain;
-          lisp_align_free (fblk);
-        }
-      else
-        {
-          num_free += this_free;
-          fprev = &fblk->next;
-        }
     }
+
+  float_free_list = 0;
+  float_sweep_prev = float_block ? &float_block : NULL;
+  float_sweep_lim = float_block_index;
+  float_sweep_free = 0;
+
   gcstat.total_floats = num_used;
-  gcstat.total_free_floats = num_free;
+  gcstat.total_free_floats = num_slots - num_used;
+}
+
+/* Sweep the cons and float blocks left unswept by the last GC.  This
+   must be done before marking starts again, and is also done when
+   Emacs is idle so that the work is not left for the next GC.  */
+
+void
+gc_finish_sweep (void)
+{
+  while (cons_sweep_prev)
+    sweep_cons_block ();
+  while (float_sweep_prev)
+    sweep_float_block ();
 }
 
 NO_INLINE /* For better stack traces */
@@ -6938,6 +7928,7 @@ unchain_dead_markers (struct buffer *buffer)
       prev = &this->next;
     else
       {
+        unindex_marker (this);
         this->buffer = NULL;
         *prev = this->next;
       }
@@ -6974,14 +7965,39 @@ gc_sweep (void)
 {
   sweep_strings ();
   check_string_bytes (!noninteractive);
+  gc_phase_end (GC_PHASE_SWEEP_STRINGS);
   sweep_conses ();
+  gc_phase_end (GC_PHASE_SWEEP_CONSES);
   sweep_floats ();
+  gc_phase_end (GC_PHASE_SWEEP_FLOATS);
   sweep_intervals ();
+  gc_phase_end (GC_PHASE_SWEEP_INTERVALS);
   sweep_symbols ();
+  gc_phase_end (GC_PHASE_SWEEP_SYMBOLS);
   sweep_buffers ();
+  gc_phase_end (GC_PHASE_SWEEP_BUFFERS);
   sweep_vectors ();
   pdumper_clear_marks ();
   check_string_bytes (!noninteractive);
+  gc_phase_end (GC_PHASE_SWEEP_VECTORS);
+}
+
+DEFUN ("gc-trim", Fgc_trim, Sgc_trim, 0, 1, 0,
+       doc: /* Give memory that Emacs no longer uses back to the operating system.
+Memory freed by garbage collection normally stays allocated to the
+Emacs process, to be reused for later allocation.  This function
+frees the remaining empty blocks of Lisp data and asks the C library
+to release free pages of its heap, keeping RETAIN bytes of free memory
+at the top of the heap; RETAIN defaults to zero.
+Return the number of bytes by which the resident memory of Emacs
+shrank, or nil if that cannot be determined on this system.
+See also `gc-trim-retain'.  */)
+  (Lisp_Object retain)
+{
+  if (!NILP (retain))
+    CHECK_FIXNAT (retain);
+  intmax_t reclaimed = gc_trim (NILP (retain) ? 0 : XFIXNAT (retain));
+  return reclaimed < 0 ? Qnil : make_int (reclaimed);
 }
 
 DEFUN ("memory-info", Fmemory_info, Smemory_info, 0, 0, 0,
@@ -7032,6 +8048,44 @@ DEFUN ("memory-info", Fmemory_info, Smemory_info, 0, 0, 0,
 #endif /* HAVE_LINUX_SYSINFO, not WINDOWSNT, not MSDOS */
 }
 
+DEFUN ("gc--set-trace-file", Fgc__set_trace_file, Sgc__set_trace_file,
+       4, 4, 0,
+       doc: /* Note the new value of `gc-trace-file'.
+This function is a watcher of that variable; see `add-variable-watcher'.  */)
+  (Lisp_Object symbol, Lisp_Object newval, Lisp_Object operation,
+   Lisp_Object where)
+{
+  if (NILP (where))
+    gc_trace_file_name = (STRINGP (newval)
+			  ? ENCODE_FILE (Fexpand_file_name (newval, Qnil))
+			  : Qnil);
+  return Qnil;
+}
+
+DEFUN ("gc-trace", Fgc_trace, Sgc_trace, 0, 0, 0,
+       doc: /* Return a list describing recent garbage collections.
+The list has one element for each of the last 64 collections, most
+recent first.  Each element has the form (START ELAPSED PHASES FREED),
+where:
+- START is the time when the collection started, as a Lisp timestamp,
+- ELAPSED is how long it took, in seconds, not counting `post-gc-hook',
+- PHASES is an alist of (PHASE . SECONDS) giving the time spent in
+  each phase of the collection,
+- FREED is an alist of (TYPE . BYTES) giving the number of bytes of
+  each type of object that the collection freed.
+See also `gc-trace-file'.  */)
+  (void)
+{
+  Lisp_Object result = Qnil;
+  for (int i = 0; i < gc_trace_used; i++)
+    {
+      int slot = (gc_trace_next - gc_trace_used + i + GC_TRACE_SIZE)
+		 % GC_TRACE_SIZE;
+      result = Fcons (gc_trace_record_to_lisp (&gc_trace[slot]), result);
+    }
+  return result;
+}
+
 /* Debugging aids.  */
 
 DEFUN ("memory-use-counts", Fmemory_use_counts, Smemory_use_counts, 0, 0, 0,
@@ -7279,6 +8333,11 @@ init_alloc (void)
 {
   Vgc_elapsed = make_float (0.0);
   gcs_done = 0;
+
+  gc_prev_consed[GC_TYPE_CONSES] = cons_cells_consed;
+  gc_prev_consed[GC_TYPE_FLOATS] = floats_consed;
+  gc_prev_consed[GC_TYPE_SYMBOLS] = symbols_consed;
+  gc_prev_consed[GC_TYPE_INTERVALS] = intervals_consed;
 }
 
 void
@@ -7374,6 +8433,43 @@ syms_of_alloc (void)
   DEFVAR_LISP ("gc-elapsed", Vgc_elapsed,
 	       doc: /* Accumulated time elapsed in garbage collections.
 The time is in seconds as a floating point value.  */);
+  DEFVAR_LISP ("gc-pause-budget", Vgc_pause_budget,
+	       doc: /* If non-nil, target duration of garbage collection pauses, in seconds.
+Then the amount of allocation between collections is adjusted after
+each collection, based on how long it took for the size of the heap,
+so that collections take about this long.  `gc-cons-threshold' is
+still a lower bound, `gc-max-heap-overhead' an upper bound, and
+`gc-cons-percentage' is ignored.  When Emacs is idle, a collection is
+also started as soon as half of the allowance has been used up.
+If nil, collections are triggered by `gc-cons-threshold' and
+`gc-cons-percentage' alone.  */);
+  Vgc_pause_budget = Qnil;
+
+  DEFVAR_LISP ("gc-max-heap-overhead", Vgc_max_heap_overhead,
+	       doc: /* Maximum garbage between collections when pacing them.
+When `gc-pause-budget' is non-nil, at most this portion of the live
+heap is allocated between garbage collections, whatever the budget.
+If nil, there is no such limit.  */);
+  Vgc_max_heap_overhead = make_float (1.0);
+
+  DEFVAR_LISP ("gc-trim-retain", Vgc_trim_retain,
+	       doc: /* If non-nil, give unused memory back to the system when idle.
+If this is a natural number, then whenever Emacs is idle after a
+garbage collection, it calls `gc-trim' with this number of bytes to
+retain.  This keeps long-running sessions, such as a daemon, from
+holding on to their peak memory use.  If nil, this is not done.  */);
+  Vgc_trim_retain = Qnil;
+
+  DEFVAR_LISP ("gc-trace-file", Vgc_trace_file,
+	       doc: /* If non-nil, file to which each garbage collection is logged.
+After each collection, its description as returned by `gc-trace' is
+appended to this file on a line of its own.  A relative file name is
+expanded against `default-directory' when the variable is set.  */);
+  Vgc_trace_file = Qnil;
+  DEFSYM (Qgc_trace_file, "gc-trace-file");
+  gc_trace_file_name = Qnil;
+  staticpro (&gc_trace_file_name);
+
   DEFVAR_INT ("gcs-done", gcs_done,
               doc: /* Accumulated number of garbage collections done.  */);
 
@@ -7398,9 +8494,15 @@ syms_of_alloc (void)
   defsubr (&Smake_finalizer);
   defsubr (&Spurecopy);
   defsubr (&Sgarbage_collect);
+  defsubr (&Sgc_trim);
   defsubr (&Smemory_info);
   defsubr (&Smemory_use_counts);
+  defsubr (&Sgc__set_trace_file);
+  defsubr (&Sgc_trace);
   defsubr (&Ssuspicious_object);
+
+  DEFSYM (Qgc__set_trace_file, "gc--set-trace-file");
+  Fadd_variable_watcher (Qgc_trace_file, Qgc__set_trace_file);
 }
 
 #ifdef HAVE_X_WINDOWS
@@ -51,6 +51,16 @@ Copyright (C) 1985-1989, 1993-1995, 1997-2019 Free Software Foundation,
 #include "w32heap.h"		/* for mmap_* */
 #endif
 
+#if defined HAVE_MMAP && !defined WINDOWSNT
+# include <sys/mman.h>
+# if defined MAP_ANONYMOUS || defined MAP_ANON
+#  define MAP_BUFFER_TEXT 1
+#  ifndef MAP_ANONYMOUS
+#   define MAP_ANONYMOUS MAP_ANON
+#  endif
+# endif
+#endif
+
 /* First buffer in chain of all buffers (in reverse order of creation).
    Threaded through ->header.next.buffer.  */
 
@@ -121,7 +131,10 @@ #define OVERLAY_COUNT_MAX						\
 
 static void alloc_buffer_text (struct buffer *, ptrdiff_t);
 static void free_buffer_text (struct buffer *b);
-static struct Lisp_Overlay * copy_overlays (struct buffer *, struct Lisp_Overlay *);
+static void copy_overlays (struct buffer *, struct buffer *);
+static void drop_overlay (struct buffer *, struct Lisp_Overlay *);
+static void overlay_tree_insert (struct buffer *, struct Lisp_Overlay *);
+static void clear_overlay_tree (struct buffer *, bool);
 static void modify_overlay (struct buffer *, ptrdiff_t, ptrdiff_t);
 static Lisp_Object buffer_lisp_local_variables (struct buffer *, bool);
 
@@ -567,10 +580,12 @@ DEFUN ("get-buffer-create", Fget_buffer_create, Sget_buffer_create, 1, 1, 0,
   *(BUF_GPT_ADDR (b)) = *(BUF_Z_ADDR (b)) = 0; /* Put an anchor '\0'.  */
   b->text->inhibit_shrinking = false;
   b->text->redisplay = false;
+  b->text->mapped_size = 0;
 
   b->newline_cache = 0;
   b->width_run_cache = 0;
   b->bidi_paragraph_cache = 0;
+  b->undo_log = NULL;
   bset_width_table (b, Qnil);
   b->prevent_redisplay_optimizations_p = 1;
 
@@ -596,6 +611,8 @@ DEFUN ("get-buffer-create", Fget_buffer_create, Sget_buffer_create, 1, 1, 0,
 
   bset_mark (b, Fmake_marker ());
   BUF_MARKERS (b) = NULL;
+  BUF_MARKER_INDEX (b) = NULL;
+  b->text->charpos_checkpoints = NULL;
 
   /* Put this in the alist of all live buffers.  */
   XSETBUFFER (buffer, b);
@@ -608,58 +625,36 @@ DEFUN ("get-buffer-create", Fget_buffer_create, Sget_buffer_create, 1, 1, 0,
 }
 
 
-/* Return a list of overlays which is a copy of the overlay list
-   LIST, but for buffer B.  */
+/* Give buffer TO a copy of each overlay of buffer FROM.  */
 
-static struct Lisp_Overlay *
-copy_overlays (struct buffer *b, struct Lisp_Overlay *list)
+static void
+copy_overlays (struct buffer *from, struct buffer *to)
 {
-  struct Lisp_Overlay *result = NULL, *tail = NULL;
-
-  for (; list; list = list->next)
+  FOR_EACH_OVERLAY_IN (ov, from, PTRDIFF_MIN, PTRDIFF_MAX)
     {
       Lisp_Object overlay, start, end;
       struct Lisp_Marker *m;
 
-      eassert (MARKERP (list->start));
-      m = XMARKER (list->start);
-      start = build_marker (b, m->charpos, m->bytepos);
+      eassert (MARKERP (ov->start));
+      m = XMARKER (ov->start);
+      start = build_marker (to, marker_charpos (m), marker_bytepos (m));
       XMARKER (start)->insertion_type = m->insertion_type;
 
-      eassert (MARKERP (list->end));
-      m = XMARKER (list->end);
-      end = build_marker (b, m->charpos, m->bytepos);
+      eassert (MARKERP (ov->end));
+      m = XMARKER (ov->end);
+      end = build_marker (to, marker_charpos (m), marker_bytepos (m));
       XMARKER (end)->insertion_type = m->insertion_type;
 
-      overlay = build_overlay (start, end, Fcopy_sequence (list->plist));
-      if (tail)
-	tail = tail->next = XOVERLAY (overlay);
-      else
-	result = tail = XOVERLAY (overlay);
+      overlay = build_overlay (start, end, Fcopy_sequence (ov->plist));
+      overlay_tree_insert (to, XOVERLAY (overlay));
     }
-
-  return result;
-}
-
-/* Set an appropriate overlay of B.  */
-
-static void
-set_buffer_overlays_before (struct buffer *b, struct Lisp_Overlay *o)
-{
-  b->overlays_before = o;
-}
-
-static void
-set_buffer_overlays_after (struct buffer *b, struct Lisp_Overlay *o)
-{
-  b->overlays_after = o;
 }
 
 /* Clone per-buffer values of buffer FROM.
 
    Buffer TO gets the same per-buffer values as FROM, with the
    following exceptions: (1) TO's name is left untouched, (2) markers
-   are copied and made to refer to TO, and (3) overlay lists are
+   are copied and made to refer to TO, and (3) overlays are
    copied.  */
 
 static void
@@ -680,7 +675,7 @@ clone_per_buffer_values (struct buffer *from, struct buffer *to)
 	{
 	  struct Lisp_Marker *m = XMARKER (obj);
 
-	  obj = build_marker (to, m->charpos, m->bytepos);
+	  obj = build_marker (to, marker_charpos (m), marker_bytepos (m));
 	  XMARKER (obj)->insertion_type = m->insertion_type;
 	}
 
@@ -689,8 +684,7 @@ clone_per_buffer_values (struct buffer *from, struct buffer *to)
 
   memcpy (to->local_flags, from->local_flags, sizeof to->local_flags);
 
-  set_buffer_overlays_before (to, copy_overlays (to, from->overlays_before));
-  set_buffer_overlays_after (to, copy_overlays (to, from->overlays_after));
+  copy_overlays (from, to);
 
   /* Get (a copy of) the alist of Lisp-level local variables of FROM
      and install that in TO.  */
@@ -802,6 +796,7 @@ DEFUN ("make-indirect-buffer", Fmake_indirect_buffer, Smake_indirect_buffer,
   b->newline_cache = 0;
   b->width_run_cache = 0;
   b->bidi_paragraph_cache = 0;
+  b->undo_log = NULL;
   bset_width_table (b, Qnil);
 
   name = Fcopy_sequence (name);
@@ -809,7 +804,7 @@ DEFUN ("make-indirect-buffer", Fmake_indirect_buffer, Smake_indirect_buffer,
   bset_name (b, name);
 
   /* An indirect buffer shares undo list of its base (Bug#18180).  */
-  bset_undo_list (b, BVAR (b->base_buffer, undo_list));
+  bset_undo_list (b, buffer_undo_list (b->base_buffer));
 
   reset_buffer (b);
   reset_buffer_local_variables (b, 1);
@@ -890,31 +885,12 @@ drop_overlay (struct buffer *b, struct Lisp_Overlay *ov)
 
 }
 
-/* Delete all overlays of B and reset its overlay lists.  */
+/* Delete all overlays of B.  */
 
 void
 delete_all_overlays (struct buffer *b)
 {
-  struct Lisp_Overlay *ov, *next;
-
-  /* FIXME: Since each drop_overlay will scan BUF_MARKERS to unlink its
-     markers, we have an unneeded O(N^2) behavior here.  */
-  for (ov = b->overlays_before; ov; ov = next)
-    {
-      drop_overlay (b, ov);
-      next = ov->next;
-      ov->next = NULL;
-    }
-
-  for (ov = b->overlays_after; ov; ov = next)
-    {
-      drop_overlay (b, ov);
-      next = ov->next;
-      ov->next = NULL;
-    }
-
-  set_buffer_overlays_before (b, NULL);
-  set_buffer_overlays_after (b, NULL);
+  clear_overlay_tree (b, true);
 }
 
 /* Reinitialize everything about a buffer except its name and contents
@@ -942,9 +918,7 @@ reset_buffer (register struct buffer *b)
   b->auto_save_failure_time = 0;
   bset_auto_save_file_name (b, Qnil);
   bset_read_only (b, Qnil);
-  set_buffer_overlays_before (b, NULL);
-  set_buffer_overlays_after (b, NULL);
-  b->overlay_center = BEG;
+  b->overlays = NULL;
   bset_mark_active (b, Qnil);
   bset_point_before_scroll (b, Qnil);
   bset_file_format (b, Qnil);
@@ -1230,7 +1204,13 @@ buffer_local_value (Lisp_Object variable, Lisp_Object buffer)
       {
 	lispfwd fwd = SYMBOL_FWD (sym);
 	if (BUFFER_OBJFWDP (fwd))
-	  result = per_buffer_value (buf, XBUFFER_OBJFWD (fwd)->offset);
+	  {
+	    int offset = XBUFFER_OBJFWD (fwd)->offset;
+	    if (offset == PER_BUFFER_VAR_OFFSET (undo_list))
+	      result = buffer_undo_list (buf);
+	    else
+	      result = per_buffer_value (buf, offset);
+	  }
 	else
 	  result = Fdefault_value (variable);
 	break;
@@ -1289,6 +1269,9 @@ DEFUN ("buffer-local-variables", Fbuffer_local_variables,
   struct buffer *buf = decode_buffer (buffer);
   Lisp_Object result = buffer_lisp_local_variables (buf, 0);
 
+  /* Bring the undo list up to date.  */
+  buffer_undo_list (buf);
+
   /* Add on all the variables stored in special slots.  */
   {
     int offset, idx;
@@ -1856,6 +1839,7 @@ DEFUN ("kill-buffer", Fkill_buffer, Skill_buffer, 0, 1, "bKill buffer: ",
 	{
 	  if (m->buffer == b)
 	    {
+	      unindex_marker (m);
 	      m->buffer = NULL;
 	      *mp = m->next;
 	    }
@@ -1875,6 +1859,7 @@ DEFUN ("kill-buffer", Fkill_buffer, Skill_buffer, 0, 1, "bKill buffer: ",
     {
       /* Unchain all markers of this buffer and its indirect buffers.
 	 and leave them pointing nowhere.  */
+      free_marker_index (b);
       for (m = BUF_MARKERS (b); m; )
 	{
 	  struct Lisp_Marker *next = m->next;
@@ -1889,8 +1874,7 @@ DEFUN ("kill-buffer", Fkill_buffer, Skill_buffer, 0, 1, "bKill buffer: ",
     }
   /* Since we've unlinked the markers, the overlays can't be here any more
      either.  */
-  b->overlays_before = NULL;
-  b->overlays_after = NULL;
+  clear_overlay_tree (b, false);
 
   /* Reset the local variables, so that this buffer's local values
      won't be protected from GC.  They would be protected
@@ -1915,6 +1899,7 @@ DEFUN ("kill-buffer", Fkill_buffer, Skill_buffer, 0, 1, "bKill buffer: ",
       /* Make sure that no one shows us.  */
       eassert (b->window_count == 0);
       /* No one shares our buffer text, can free it.  */
+      free_charpos_checkpoints (b);
       free_buffer_text (b);
     }
 
@@ -1935,6 +1920,7 @@ DEFUN ("kill-buffer", Fkill_buffer, Skill_buffer, 0, 1, "bKill buffer: ",
     }
   bset_width_table (b, Qnil);
   unblock_input ();
+  discard_undo_log (b);
   bset_undo_list (b, Qnil);
 
   /* Run buffer-list-update-hook.  */
@@ -2367,9 +2353,8 @@ #define swapfield_(field, type) \
   swapfield (bidi_paragraph_cache, struct region_cache *);
   current_buffer->prevent_redisplay_optimizations_p = 1;
   other_buffer->prevent_redisplay_optimizations_p = 1;
-  swapfield (overlays_before, struct Lisp_Overlay *);
-  swapfield (overlays_after, struct Lisp_Overlay *);
-  swapfield (overlay_center, ptrdiff_t);
+  swapfield (overlays, struct Lisp_Overlay *);
+  swapfield (undo_log, struct undo_log *);
   swapfield_ (undo_list, Lisp_Object);
   swapfield_ (mark, Lisp_Object);
   swapfield_ (enable_multibyte_characters, Lisp_Object);
@@ -2477,7 +2462,7 @@ DEFUN ("set-buffer-multibyte", Fset_buffer_multibyte, Sset_buffer_multibyte,
   ptrdiff_t begv, zv;
   bool narrowed = (BEG != BEGV || Z != ZV);
   bool modified_p = !NILP (Fbuffer_modified_p (Qnil));
-  Lisp_Object old_undo = BVAR (current_buffer, undo_list);
+  Lisp_Object old_undo = buffer_undo_list (current_buffer);
 
   if (current_buffer->base_buffer)
     error ("Cannot do `set-buffer-multibyte' on an indirect buffer");
@@ -2492,6 +2477,7 @@ DEFUN ("set-buffer-multibyte", Fset_buffer_multibyte, Sset_buffer_multibyte,
 
   /* If the cached position is for this buffer, clear it out.  */
   clear_charpos_cache (current_buffer);
+  free_charpos_checkpoints (current_buffer);
 
   if (NILP (flag))
     begv = BEGV_BYTE, zv = ZV_BYTE;
@@ -2520,7 +2506,7 @@ DEFUN ("set-buffer-multibyte", Fset_buffer_multibyte, Sset_buffer_multibyte,
       GPT = GPT_BYTE;
       TEMP_SET_PT_BOTH (PT_BYTE, PT_BYTE);
 
-
+      free_marker_index (current_buffer);
       for (tail = BUF_MARKERS (current_buffer); tail; tail = tail->next)
 	tail->charpos = tail->bytepos;
 
@@ -2680,6 +2666,7 @@ DEFUN ("set-buffer-multibyte", Fset_buffer_multibyte, Sset_buffer_multibyte,
 	TEMP_SET_PT_BOTH (position, byte);
       }
 
+      free_marker_index (current_buffer);
       tail = markers = BUF_MARKERS (current_buffer);
 
       /* This prevents BYTE_TO_CHAR (that is, buf_bytepos_to_charpos) from
@@ -2708,6 +2695,10 @@ DEFUN ("set-buffer-multibyte", Fset_buffer_multibyte, Sset_buffer_multibyte,
       set_intervals_multibyte (1);
     }
 
+  /* Conversions may have made checkpoints while the text was being
+     converted.  */
+  free_charpos_checkpoints (current_buffer);
+
   if (!EQ (old_undo, Qt))
     {
       /* Represent all the above changes by a special undo entry.  */
@@ -2783,15 +2774,494 @@ DEFUN ("kill-all-local-variables", Fkill_all_local_variables,
 }
 
 
+/* The overlays of a buffer form a red-black tree, linked through the
+   LEFT, RIGHT and PARENT fields of struct Lisp_Overlay and ordered by
+   start position, with overlays that start together in no particular
+   order.  The MAXEND field of each node is the overlay that ends last
+   in the subtree rooted there, so that a search for the overlays
+   around some position can skip every subtree whose overlays all end
+   before it; such searches take logarithmic time.
+
+   The tree does not record positions: it reads them from the start
+   and end markers, which the marker code keeps up to date on every
+   insertion and deletion.  Such an edit moves all positions by one
+   and the same nondecreasing function, so it preserves both the order
+   of the starts and which overlay of a subtree ends last, and the
+   tree needs no work at all.  The exceptions are an insertion where
+   markers of both insertion types meet, a transposition of text, and
+   moving a single marker: the first two call
+   fix_start_end_in_overlays afterwards, and the last takes the
+   overlay out of the tree meanwhile, see unlink_marker_overlay.  */
+
+static ptrdiff_t
+overlay_start (struct Lisp_Overlay *ov)
+{
+  return marker_charpos (XMARKER (ov->start));
+}
+
+static ptrdiff_t
+overlay_end (struct Lisp_Overlay *ov)
+{
+  return marker_charpos (XMARKER (ov->end));
+}
+
+/* Recompute the MAXEND field of OV from those of its children.  */
+
+static void
+update_overlay_maxend (struct Lisp_Overlay *ov)
+{
+  struct Lisp_Overlay *max = ov;
+  ptrdiff_t end = overlay_end (ov);
+
+  if (ov->left && overlay_end (ov->left->maxend) > end)
+    {
+      max = ov->left->maxend;
+      end = overlay_end (max);
+    }
+  if (ov->right && overlay_end (ov->right->maxend) > end)
+    max = ov->right->maxend;
+  ov->maxend = max;
+}
+
+/* Make NEW take the place of OLD as a child of PARENT, or as the root
+   of the overlay tree of B if PARENT is NULL.  */
+
+static void
+replace_overlay_child (struct buffer *b, struct Lisp_Overlay *parent,
+		       struct Lisp_Overlay *old, struct Lisp_Overlay *new)
+{
+  if (!parent)
+    b->overlays = new;
+  else if (parent->left == old)
+    parent->left = new;
+  else
+    parent->right = new;
+  if (new)
+    new->parent = parent;
+}
+
+/* Rotate the subtree of B's overlay tree rooted at X to the left, so
+   that its right child becomes its root.  */
+
+static void
+rotate_overlays_left (struct buffer *b, struct Lisp_Overlay *x)
+{
+  struct Lisp_Overlay *y = x->right;
+
+  x->right = y->left;
+  if (y->left)
+    y->left->parent = x;
+  replace_overlay_child (b, x->parent, x, y);
+  y->left = x;
+  x->parent = y;
+  y->maxend = x->maxend;
+  update_overlay_maxend (x);
+}
+
+/* Likewise, to the right.  */
+
+static void
+rotate_overlays_right (struct buffer *b, struct Lisp_Overlay *x)
+{
+  struct Lisp_Overlay *y = x->left;
+
+  x->left = y->right;
+  if (y->right)
+    y->right->parent = x;
+  replace_overlay_child (b, x->parent, x, y);
+  y->right = x;
+  x->parent = y;
+  y->maxend = x->maxend;
+  update_overlay_maxend (x);
+}
+
+/* Add OV, whose markers point into B, to the overlay tree of B.
+   OV goes before the overlays that start where it does, so that of
+   overlays with the same start the one added last comes first, as
+   it did when the overlays were kept in lists.  */
+
+static void
+overlay_tree_insert (struct buffer *b, struct Lisp_Overlay *ov)
+{
+  ptrdiff_t start = overlay_start (ov);
+  ptrdiff_t end = overlay_end (ov);
+  struct Lisp_Overlay *parent = NULL, **link = &b->overlays;
+
+  while (*link)
+    {
+      parent = *link;
+      link = (start <= overlay_start (parent)
+	      ? &parent->left : &parent->right);
+    }
+  *link = ov;
+  ov->left = ov->right = NULL;
+  ov->parent = parent;
+  ov->maxend = ov;
+  ov->red = true;
+  XMARKER (ov->start)->overlay_bound = true;
+  XMARKER (ov->end)->overlay_bound = true;
+
+  for (; parent && overlay_end (parent->maxend) < end;
+       parent = parent->parent)
+    parent->maxend = ov;
+
+  /* Restore the balance.  */
+  while (ov->parent && ov->parent->red)
+    {
+      struct Lisp_Overlay *p = ov->parent, *g = p->parent;
+
+      if (p == g->left)
+	{
+	  struct Lisp_Overlay *u = g->right;
+	  if (u && u->red)
+	    {
+	      p->red = u->red = false;
+	      g->red = true;
+	      ov = g;
+	      continue;
+	    }
+	  if (ov == p->right)
+	    {
+	      rotate_overlays_left (b, p);
+	      p = ov;
+	    }
+	  rotate_overlays_right (b, g);
+	}
+      else
+	{
+	  struct Lisp_Overlay *u = g->left;
+	  if (u && u->red)
+	    {
+	      p->red = u->red = false;
+	      g->red = true;
+	      ov = g;
+	      continue;
+	    }
+	  if (ov == p->left)
+	    {
+	      rotate_overlays_right (b, p);
+	      p = ov;
+	    }
+	  rotate_overlays_left (b, g);
+	}
+      p->red = false;
+      g->red = true;
+      break;
+    }
+  b->overlays->red = false;
+}
+
+/* Forget that OV was in an overlay tree.  */
+
+static void
+clear_overlay_links (struct Lisp_Overlay *ov)
+{
+  ov->left = ov->right = ov->parent = ov->maxend = NULL;
+  XMARKER (ov->start)->overlay_bound = false;
+  XMARKER (ov->end)->overlay_bound = false;
+}
+
+/* Remove OV from the overlay tree of B.  This does not look at the
+   positions of any overlays but those of the ancestors of OV, so it
+   works even when other parts of the tree are out of order.  */
+
+static void
+overlay_tree_remove (struct buffer *b, struct Lisp_Overlay *ov)
+{
+  struct Lisp_Overlay *x, *parent;
+  bool removed_red = ov->red;
+
+  if (!ov->left || !ov->right)
+    {
+      x = ov->left ? ov->left : ov->right;
+      parent = ov->parent;
+      replace_overlay_child (b, parent, ov, x);
+    }
+  else
+    {
+      /* Put the successor of OV in its place.  */
+      struct Lisp_Overlay *y = ov->right;
+      while (y->left)
+	y = y->left;
+      removed_red = y->red;
+      x = y->right;
+      if (y->parent == ov)
+	parent = y;
+      else
+	{
+	  parent = y->parent;
+	  replace_overlay_child (b, parent, y, x);
+	  y->right = ov->right;
+	  y->right->parent = y;
+	}
+      replace_overlay_child (b, ov->parent, ov, y);
+      y->left = ov->left;
+      y->left->parent = y;
+      y->red = ov->red;
+    }
+
+  for (struct Lisp_Overlay *p = parent; p; p = p->parent)
+    update_overlay_maxend (p);
+
+  /* Restore the balance, which is off by one black node on the path
+     to X, if OV took a black node away.  */
+  if (!removed_red)
+    {
+      while (x != b->overlays && !(x && x->red))
+	{
+	  if (x == parent->left)
+	    {
+	      struct Lisp_Overlay *w = parent->right;
+	      if (w->red)
+		{
+		  w->red = false;
+		  parent->red = true;
+		  rotate_overlays_left (b, parent);
+		  w = parent->right;
+		}
+	      if (!(w->left && w->left->red) && !(w->right && w->right->red))
+		{
+		  w->red = true;
+		  x = parent;
+		  parent = x->parent;
+		  continue;
+		}
+	      if (!(w->right && w->right->red))
+		{
+		  w->left->red = false;
+		  w->red = true;
+		  rotate_overlays_right (b, w);
+		  w = parent->right;
+		}
+	      w->red = parent->red;
+	      parent->red = false;
+	      w->right->red = false;
+	      rotate_overlays_left (b, parent);
+	    }
+	  else
+	    {
+	      struct Lisp_Overlay *w = parent->left;
+	      if (w->red)
+		{
+		  w->red = false;
+		  parent->red = true;
+		  rotate_overlays_right (b, parent);
+		  w = parent->left;
+		}
+	      if (!(w->left && w->left->red) && !(w->right && w->right->red))
+		{
+		  w->red = true;
+		  x = parent;
+		  parent = x->parent;
+		  continue;
+		}
+	      if (!(w->left && w->left->red))
+		{
+		  w->right->red = false;
+		  w->red = true;
+		  rotate_overlays_left (b, w);
+		  w = parent->left;
+		}
+	      w->red = parent->red;
+	      parent->red = false;
+	      w->left->red = false;
+	      rotate_overlays_right (b, parent);
+	    }
+	  x = b->overlays;
+	}
+      if (x)
+	x->red = false;
+    }
+
+  clear_overlay_links (ov);
+}
+
+/* Take all the overlays out of the overlay tree of B, without
+   rebalancing it on the way.  If DROP, also detach each of them from
+   B with drop_overlay.  */
+
+static void
+clear_overlay_tree (struct buffer *b, bool drop)
+{
+  struct Lisp_Overlay *ov = b->overlays;
+
+  b->overlays = NULL;
+  while (ov)
+    if (ov->left)
+      ov = ov->left;
+    else if (ov->right)
+      ov = ov->right;
+    else
+      {
+	struct Lisp_Overlay *parent = ov->parent;
+	if (parent && parent->left == ov)
+	  parent->left = NULL;
+	else if (parent)
+	  parent->right = NULL;
+	clear_overlay_links (ov);
+	if (drop)
+	  drop_overlay (b, ov);
+	ov = parent;
+      }
+}
+
+/* Return the first overlay in order of start in the subtree rooted at
+   OV that ends at or after BEG, given that there is one.  */
+
+static struct Lisp_Overlay *
+leftmost_overlay_ending_after (struct Lisp_Overlay *ov, ptrdiff_t beg)
+{
+  while (true)
+    if (ov->left && overlay_end (ov->left->maxend) >= beg)
+      ov = ov->left;
+    else if (overlay_end (ov) >= beg)
+      return ov;
+    else
+      ov = ov->right;
+}
+
+/* Return the first overlay of B, in order of start, that ends at or
+   after BEG and starts at or before END, or NULL if there is none.
+   Use next_overlay_in to get the others.  */
+
+struct Lisp_Overlay *
+first_overlay_in (struct buffer *b, ptrdiff_t beg, ptrdiff_t end)
+{
+  struct Lisp_Overlay *ov = b->overlays;
+
+  if (!ov || overlay_end (ov->maxend) < beg)
+    return NULL;
+  ov = leftmost_overlay_ending_after (ov, beg);
+  return overlay_start (ov) <= end ? ov : NULL;
+}
+
+/* Return the overlay that follows OV in the sequence of overlays that
+   first_overlay_in returns the first of, given the same BEG and END,
+   or NULL if OV is the last.  */
+
+struct Lisp_Overlay *
+next_overlay_in (struct Lisp_Overlay *ov, ptrdiff_t beg, ptrdiff_t end)
+{
+  if (ov->right && overlay_end (ov->right->maxend) >= beg)
+    ov = leftmost_overlay_ending_after (ov->right, beg);
+  else
+    /* Climb to the nearest ancestor that has not been visited yet,
+       i.e., the first one that we reach from its left subtree.  */
+    while (true)
+      {
+	struct Lisp_Overlay *child = ov;
+	ov = ov->parent;
+	if (!ov)
+	  return NULL;
+	if (child != ov->left)
+	  continue;
+	if (overlay_start (ov) > end)
+	  return NULL;
+	if (overlay_end (ov) >= beg)
+	  break;
+	if (ov->right && overlay_end (ov->right->maxend) >= beg)
+	  {
+	    ov = leftmost_overlay_ending_after (ov->right, beg);
+	    break;
+	  }
+      }
+  return overlay_start (ov) <= end ? ov : NULL;
+}
+
+/* Return the least start position of an overlay of B that is greater
+   than POS, or LIMIT if none is less than LIMIT.  */
+
+static ptrdiff_t
+next_overlay_start (struct buffer *b, ptrdiff_t pos, ptrdiff_t limit)
+{
+  for (struct Lisp_Overlay *ov = b->overlays; ov; )
+    {
+      ptrdiff_t start = overlay_start (ov);
+      if (start > pos)
+	{
+	  limit = min (limit, start);
+	  ov = ov->left;
+	}
+      else
+	ov = ov->right;
+    }
+  return limit;
+}
+
+/* Return the greatest start position of an overlay of B that is less
+   than POS, or LIMIT if none is greater than LIMIT.  */
+
+static ptrdiff_t
+previous_overlay_start (struct buffer *b, ptrdiff_t pos, ptrdiff_t limit)
+{
+  for (struct Lisp_Overlay *ov = b->overlays; ov; )
+    {
+      ptrdiff_t start = overlay_start (ov);
+      if (start < pos)
+	{
+	  limit = max (limit, start);
+	  ov = ov->right;
+	}
+      else
+	ov = ov->left;
+    }
+  return limit;
+}
+
+/* M is the start or end of an overlay that is in the overlay tree of
+   M's buffer, and is about to move.  Take that overlay out of the
+   tree, and return it so that relink_overlay can put it back.  */
+
+struct Lisp_Overlay *
+unlink_marker_overlay (struct Lisp_Marker *m)
+{
+  struct buffer *b = m->buffer;
+  ptrdiff_t pos = marker_charpos (m);
+  struct Lisp_Overlay *found = NULL;
+
+  FOR_EACH_OVERLAY_IN (ov, b, pos, pos)
+    if (XMARKER (ov->start) == m || XMARKER (ov->end) == m)
+      {
+	found = ov;
+	break;
+      }
+
+  /* An overlay that for the moment starts after its end, as happens
+     while undo moves its bounds one at a time, is not among those.  */
+  if (!found)
+    FOR_EACH_OVERLAY_IN (ov, b, PTRDIFF_MIN, PTRDIFF_MAX)
+      if (XMARKER (ov->start) == m || XMARKER (ov->end) == m)
+	{
+	  found = ov;
+	  break;
+	}
+
+  eassert (found);
+  if (found)
+    overlay_tree_remove (b, found);
+  else
+    m->overlay_bound = false;
+  return found;
+}
+
+/* Put OV, which unlink_marker_overlay returned, back into the overlay
+   tree of the buffer that its markers point into now.  */
+
+void
+relink_overlay (struct Lisp_Overlay *ov)
+{
+  struct buffer *b = XMARKER (ov->start)->buffer;
+
+  if (b && b == XMARKER (ov->end)->buffer)
+    overlay_tree_insert (b, ov);
+}
+
 /* Find all the overlays in the current buffer that contain position POS.
    Return the number found, and store them in a vector in *VEC_PTR.
    Store in *LEN_PTR the size allocated for the vector.
    Store in *NEXT_PTR the next position after POS where an overlay starts,
      or ZV if there are no more overlays between POS and ZV.
-   Store in *PREV_PTR the previous position before POS where an overlay ends,
-     or where an overlay starts which ends at or after POS;
-     or BEGV if there are no such overlays from BEGV to POS.
-   NEXT_PTR and/or PREV_PTR may be 0, meaning don't store that info.
+   NEXT_PTR may be 0, meaning don't store that info.
 
    *VEC_PTR and *LEN_PTR should contain a valid vector and size
    when this function is called.
@@ -2799,131 +3269,52 @@ DEFUN ("kill-all-local-variables", Fkill_all_local_variables,
    If EXTEND, make the vector bigger if necessary.
    If not, never extend the vector,
    and store only as many overlays as will fit.
-   But still return the total number of overlays.
-
-   If CHANGE_REQ, any position written into *PREV_PTR or
-   *NEXT_PTR is guaranteed to be not equal to POS, unless it is the
-   default (BEGV or ZV).  */
+   But still return the total number of overlays.  */
 
 ptrdiff_t
 overlays_at (EMACS_INT pos, bool extend, Lisp_Object **vec_ptr,
-	     ptrdiff_t *len_ptr,
-	     ptrdiff_t *next_ptr, ptrdiff_t *prev_ptr, bool change_req)
+	     ptrdiff_t *len_ptr, ptrdiff_t *next_ptr)
 {
   ptrdiff_t idx = 0;
   ptrdiff_t len = *len_ptr;
   Lisp_Object *vec = *vec_ptr;
-  ptrdiff_t next = ZV;
-  ptrdiff_t prev = BEGV;
   bool inhibit_storing = 0;
 
-  for (struct Lisp_Overlay *tail = current_buffer->overlays_before;
-       tail; tail = tail->next)
+  /* The overlays that contain POS end after it.  */
+  FOR_EACH_OVERLAY_IN (ov, current_buffer, pos + 1, pos)
     {
-      Lisp_Object overlay = make_lisp_ptr (tail, Lisp_Vectorlike);
-      Lisp_Object start = OVERLAY_START (overlay);
-      Lisp_Object end = OVERLAY_END (overlay);
-      ptrdiff_t endpos = OVERLAY_POSITION (end);
-      if (endpos < pos)
-	{
-	  if (prev < endpos)
-	    prev = endpos;
-	  break;
-	}
-      ptrdiff_t startpos = OVERLAY_POSITION (start);
-      /* This one ends at or after POS
-	 so its start counts for PREV_PTR if it's before POS.  */
-      if (prev < startpos && startpos < pos)
-	prev = startpos;
-      if (endpos == pos)
-	continue;
-      if (startpos <= pos)
+      if (idx == len)
 	{
-	  if (idx == len)
+	  /* The supplied vector is full.
+	     Either make it bigger, or don't store any more in it.  */
+	  if (extend)
 	    {
-	      /* The supplied vector is full.
-		 Either make it bigger, or don't store any more in it.  */
-	      if (extend)
-		{
-		  vec = xpalloc (vec, len_ptr, 1, OVERLAY_COUNT_MAX,
-				 sizeof *vec);
-		  *vec_ptr = vec;
-		  len = *len_ptr;
-		}
-	      else
-		inhibit_storing = 1;
+	      vec = xpalloc (vec, len_ptr, 1, OVERLAY_COUNT_MAX,
+			     sizeof *vec);
+	      *vec_ptr = vec;
+	      len = *len_ptr;
 	    }
-
-	  if (!inhibit_storing)
-	    vec[idx] = overlay;
-	  /* Keep counting overlays even if we can't return them all.  */
-	  idx++;
-	}
-      else if (startpos < next)
-	next = startpos;
-    }
-
-  for (struct Lisp_Overlay *tail = current_buffer->overlays_after;
-       tail; tail = tail->next)
-    {
-      Lisp_Object overlay = make_lisp_ptr (tail, Lisp_Vectorlike);
-      Lisp_Object start = OVERLAY_START (overlay);
-      Lisp_Object end = OVERLAY_END (overlay);
-      ptrdiff_t startpos = OVERLAY_POSITION (start);
-      if (pos < startpos)
-	{
-	  if (startpos < next)
-	    next = startpos;
-	  break;
+	  else
+	    inhibit_storing = 1;
 	}
-      ptrdiff_t endpos = OVERLAY_POSITION (end);
-      if (pos < endpos)
-	{
-	  if (idx == len)
-	    {
-	      if (extend)
-		{
-		  vec = xpalloc (vec, len_ptr, 1, OVERLAY_COUNT_MAX,
-				 sizeof *vec);
-		  *vec_ptr = vec;
-		  len = *len_ptr;
-		}
-	      else
-		inhibit_storing = 1;
-	    }
 
-	  if (!inhibit_storing)
-	    vec[idx] = overlay;
-	  idx++;
-
-	  if (startpos < pos && startpos > prev)
-	    prev = startpos;
-	}
-      else if (endpos < pos && endpos > prev)
-	prev = endpos;
-      else if (endpos == pos && startpos > prev
-	       && (!change_req || startpos < pos))
-	prev = startpos;
+      if (!inhibit_storing)
+	vec[idx] = make_lisp_ptr (ov, Lisp_Vectorlike);
+      /* Keep counting overlays even if we can't return them all.  */
+      idx++;
     }
 
   if (next_ptr)
-    *next_ptr = next;
-  if (prev_ptr)
-    *prev_ptr = prev;
+    *next_ptr = next_overlay_start (current_buffer, pos, ZV);
   return idx;
 }
-
+
 /* Find all the overlays in the current buffer that overlap the range
    BEG-END, or are empty at BEG, or are empty at END provided END
    denotes the position at the end of the current buffer.
 
    Return the number found, and store them in a vector in *VEC_PTR.
    Store in *LEN_PTR the size allocated for the vector.
-   Store in *NEXT_PTR the next position after POS where an overlay starts,
-     or ZV if there are no more overlays.
-   Store in *PREV_PTR the previous position before POS where an overlay ends,
-     or BEGV if there are no previous overlays.
-   NEXT_PTR and/or PREV_PTR may be 0, meaning don't store that info.
 
    *VEC_PTR and *LEN_PTR should contain a valid vector and size
    when this function is called.
@@ -2935,31 +3326,18 @@ overlays_at (EMACS_INT pos, bool extend, Lisp_Object **vec_ptr,
 
 static ptrdiff_t
 overlays_in (EMACS_INT beg, EMACS_INT end, bool extend,
-	     Lisp_Object **vec_ptr, ptrdiff_t *len_ptr,
-	     ptrdiff_t *next_ptr, ptrdiff_t *prev_ptr)
+	     Lisp_Object **vec_ptr, ptrdiff_t *len_ptr)
 {
   ptrdiff_t idx = 0;
   ptrdiff_t len = *len_ptr;
   Lisp_Object *vec = *vec_ptr;
-  ptrdiff_t next = ZV;
-  ptrdiff_t prev = BEGV;
   bool inhibit_storing = 0;
   bool end_is_Z = end == Z;
 
-  for (struct Lisp_Overlay *tail = current_buffer->overlays_before;
-       tail; tail = tail->next)
+  FOR_EACH_OVERLAY_IN (ov, current_buffer, beg, end)
     {
-      Lisp_Object overlay = make_lisp_ptr (tail, Lisp_Vectorlike);
-      Lisp_Object ostart = OVERLAY_START (overlay);
-      Lisp_Object oend = OVERLAY_END (overlay);
-      ptrdiff_t endpos = OVERLAY_POSITION (oend);
-      if (endpos < beg)
-	{
-	  if (prev < endpos)
-	    prev = endpos;
-	  break;
-	}
-      ptrdiff_t startpos = OVERLAY_POSITION (ostart);
+      ptrdiff_t startpos = overlay_start (ov);
+      ptrdiff_t endpos = overlay_end (ov);
       /* Count an interval if it overlaps the range, is empty at the
 	 start of the range, or is empty at END provided END denotes the
 	 end of the buffer.  */
@@ -2983,61 +3361,48 @@ overlays_in (EMACS_INT beg, EMACS_INT end, bool extend,
 	    }
 
 	  if (!inhibit_storing)
-	    vec[idx] = overlay;
+	    vec[idx] = make_lisp_ptr (ov, Lisp_Vectorlike);
 	  /* Keep counting overlays even if we can't return them all.  */
 	  idx++;
 	}
-      else if (startpos < next)
-	next = startpos;
     }
 
-  for (struct Lisp_Overlay *tail = current_buffer->overlays_after;
-       tail; tail = tail->next)
-    {
-      Lisp_Object overlay = make_lisp_ptr (tail, Lisp_Vectorlike);
-      Lisp_Object ostart = OVERLAY_START (overlay);
-      Lisp_Object oend = OVERLAY_END (overlay);
-      ptrdiff_t startpos = OVERLAY_POSITION (ostart);
-      if (end < startpos)
-	{
-	  if (startpos < next)
-	    next = startpos;
-	  break;
-	}
-      ptrdiff_t endpos = OVERLAY_POSITION (oend);
-      /* Count an interval if it overlaps the range, is empty at the
-	 start of the range, or is empty at END provided END denotes the
-	 end of the buffer.  */
-      if ((beg < endpos && startpos < end)
-	  || (startpos == endpos
-	      && (beg == endpos || (end_is_Z && endpos == end))))
-	{
-	  if (idx == len)
-	    {
-	      if (extend)
-		{
-		  vec = xpalloc (vec, len_ptr, 1, OVERLAY_COUNT_MAX,
-				 sizeof *vec);
-		  *vec_ptr = vec;
-		  len = *len_ptr;
-		}
-	      else
-		inhibit_storing = 1;
-	    }
+  return idx;
+}
 
-	  if (!inhibit_storing)
-	    vec[idx] = overlay;
-	  idx++;
-	}
-      else if (endpos < beg && endpos > prev)
-	prev = endpos;
-    }
+/* Return the next position after POS where an overlay of the current
+   buffer starts or ends, or ZV if there is none before ZV.  */
 
-  if (next_ptr)
-    *next_ptr = next;
-  if (prev_ptr)
-    *prev_ptr = prev;
-  return idx;
+ptrdiff_t
+next_overlay_change (ptrdiff_t pos)
+{
+  ptrdiff_t next = next_overlay_start (current_buffer, pos, ZV);
+
+  /* An overlay that contains POS can end before that.  */
+  FOR_EACH_OVERLAY_IN (ov, current_buffer, pos + 1, pos)
+    next = min (next, overlay_end (ov));
+  return next;
+}
+
+/* Return the previous position before POS where an overlay of the
+   current buffer starts or ends, or BEGV if there is none after
+   BEGV.  */
+
+ptrdiff_t
+previous_overlay_change (ptrdiff_t pos)
+{
+  ptrdiff_t start = previous_overlay_start (current_buffer, pos, BEGV);
+  ptrdiff_t prev = start;
+
+  /* Only an overlay that ends between START and POS can end later
+     than START.  */
+  FOR_EACH_OVERLAY_IN (ov, current_buffer, start, pos - 1)
+    {
+      ptrdiff_t endpos = overlay_end (ov);
+      if (endpos < pos)
+	prev = max (prev, endpos);
+    }
+  return prev;
 }
 
 
@@ -3056,11 +3421,11 @@ mouse_face_overlay_overlaps (Lisp_Object overlay)
 
   size = ARRAYELTS (vbuf);
   v = vbuf;
-  n = overlays_in (start, end, 0, &v, &size, NULL, NULL);
+  n = overlays_in (start, end, 0, &v, &size);
   if (n > size)
     {
       SAFE_NALLOCA (v, 1, n);
-      overlays_in (start, end, 0, &v, &n, NULL, NULL);
+      overlays_in (start, end, 0, &v, &n);
     }
 
   for (i = 0; i < n; ++i)
@@ -3085,11 +3450,11 @@ disable_line_numbers_overlay_at_eob (void)
 
   size = ARRAYELTS (vbuf);
   v = vbuf;
-  n = overlays_in (ZV, ZV, 0, &v, &size, NULL, NULL);
+  n = overlays_in (ZV, ZV, 0, &v, &size);
   if (n > size)
     {
       SAFE_NALLOCA (v, 1, n);
-      overlays_in (ZV, ZV, 0, &v, &n, NULL, NULL);
+      overlays_in (ZV, ZV, 0, &v, &n);
     }
 
   for (i = 0; i < n; ++i)
@@ -3106,34 +3471,12 @@ disable_line_numbers_overlay_at_eob (void)
 bool
 overlay_touches_p (ptrdiff_t pos)
 {
-  for (struct Lisp_Overlay *tail = current_buffer->overlays_before;
-       tail; tail = tail->next)
-    {
-      Lisp_Object overlay = make_lisp_ptr (tail, Lisp_Vectorlike);
-      eassert (OVERLAYP (overlay));
-
-      ptrdiff_t endpos = OVERLAY_POSITION (OVERLAY_END (overlay));
-      if (endpos < pos)
-	break;
-      if (endpos == pos || OVERLAY_POSITION (OVERLAY_START (overlay)) == pos)
-	return 1;
-    }
-
-  for (struct Lisp_Overlay *tail = current_buffer->overlays_after;
-       tail; tail = tail->next)
-    {
-      Lisp_Object overlay = make_lisp_ptr (tail, Lisp_Vectorlike);
-      eassert (OVERLAYP (overlay));
-
-      ptrdiff_t startpos = OVERLAY_POSITION (OVERLAY_START (overlay));
-      if (pos < startpos)
-	break;
-      if (startpos == pos || OVERLAY_POSITION (OVERLAY_END (overlay)) == pos)
-	return 1;
-    }
+  FOR_EACH_OVERLAY_IN (ov, current_buffer, pos, pos)
+    if (overlay_start (ov) == pos || overlay_end (ov) == pos)
+      return 1;
   return 0;
 }
-
+
 struct sortvec
 {
   Lisp_Object overlay;
@@ -3345,46 +3688,13 @@ overlay_strings (ptrdiff_t pos, struct window *w, unsigned char **pstr)
 
   overlay_heads.used = overlay_heads.bytes = 0;
   overlay_tails.used = overlay_tails.bytes = 0;
-  for (struct Lisp_Overlay *ov = current_buffer->overlays_before;
-       ov; ov = ov->next)
+  FOR_EACH_OVERLAY_IN (ov, current_buffer, pos, pos)
     {
       Lisp_Object overlay = make_lisp_ptr (ov, Lisp_Vectorlike);
       eassert (OVERLAYP (overlay));
 
-      ptrdiff_t startpos = OVERLAY_POSITION (OVERLAY_START (overlay));
-      ptrdiff_t endpos = OVERLAY_POSITION (OVERLAY_END (overlay));
-      if (endpos < pos)
-	break;
-      if (endpos != pos && startpos != pos)
-	continue;
-      Lisp_Object window = Foverlay_get (overlay, Qwindow);
-      if (WINDOWP (window) && XWINDOW (window) != w)
-	continue;
-      Lisp_Object str;
-      if (startpos == pos
-	  && (str = Foverlay_get (overlay, Qbefore_string), STRINGP (str)))
-	record_overlay_string (&overlay_heads, str,
-			       (startpos == endpos
-				? Foverlay_get (overlay, Qafter_string)
-				: Qnil),
-			       Foverlay_get (overlay, Qpriority),
-			       endpos - startpos);
-      else if (endpos == pos
-	  && (str = Foverlay_get (overlay, Qafter_string), STRINGP (str)))
-	record_overlay_string (&overlay_tails, str, Qnil,
-			       Foverlay_get (overlay, Qpriority),
-			       endpos - startpos);
-    }
-  for (struct Lisp_Overlay *ov = current_buffer->overlays_after;
-       ov; ov = ov->next)
-    {
-      Lisp_Object overlay = make_lisp_ptr (ov, Lisp_Vectorlike);
-      eassert (OVERLAYP (overlay));
-
-      ptrdiff_t startpos = OVERLAY_POSITION (OVERLAY_START (overlay));
-      ptrdiff_t endpos = OVERLAY_POSITION (OVERLAY_END (overlay));
-      if (startpos > pos)
-	break;
+      ptrdiff_t startpos = overlay_start (ov);
+      ptrdiff_t endpos = overlay_end (ov);
       if (endpos != pos && startpos != pos)
 	continue;
       Lisp_Object window = Foverlay_get (overlay, Qwindow);
@@ -3460,382 +3770,77 @@ overlay_strings (ptrdiff_t pos, struct window *w, unsigned char **pstr)
   return 0;
 }
 
-/* Shift overlays in BUF's overlay lists, to center the lists at POS.  */
-
-void
-recenter_overlay_lists (struct buffer *buf, ptrdiff_t pos)
-{
-  struct Lisp_Overlay *prev, *next;
-
-  /* See if anything in overlays_before should move to overlays_after.  */
-
-  /* We don't strictly need prev in this loop; it should always be nil.
-     But we use it for symmetry and in case that should cease to be true
-     with some future change.  */
-  prev = NULL;
-  for (struct Lisp_Overlay *tail = buf->overlays_before;
-       tail; prev = tail, tail = next)
-    {
-      next = tail->next;
-      Lisp_Object overlay = make_lisp_ptr (tail, Lisp_Vectorlike);
-      eassert (OVERLAYP (overlay));
-
-      Lisp_Object beg = OVERLAY_START (overlay);
-      Lisp_Object end = OVERLAY_END (overlay);
-
-      if (OVERLAY_POSITION (end) > pos)
-	{
-	  /* OVERLAY needs to be moved.  */
-	  ptrdiff_t where = OVERLAY_POSITION (beg);
-	  struct Lisp_Overlay *other, *other_prev;
-
-	  /* Splice the cons cell TAIL out of overlays_before.  */
-	  if (prev)
-	    prev->next = next;
-	  else
-	    set_buffer_overlays_before (buf, next);
-
-	  /* Search thru overlays_after for where to put it.  */
-	  other_prev = NULL;
-	  for (other = buf->overlays_after; other;
-	       other_prev = other, other = other->next)
-	    {
-	      Lisp_Object otheroverlay = make_lisp_ptr (other, Lisp_Vectorlike);
-	      eassert (OVERLAYP (otheroverlay));
-
-	      Lisp_Object otherbeg = OVERLAY_START (otheroverlay);
-	      if (OVERLAY_POSITION (otherbeg) >= where)
-		break;
-	    }
-
-	  /* Add TAIL to overlays_after before OTHER.  */
-	  tail->next = other;
-	  if (other_prev)
-	    other_prev->next = tail;
-	  else
-	    set_buffer_overlays_after (buf, tail);
-	  tail = prev;
-	}
-      else
-	/* We've reached the things that should stay in overlays_before.
-	   All the rest of overlays_before must end even earlier,
-	   so stop now.  */
-	break;
-    }
-
-  /* See if anything in overlays_after should be in overlays_before.  */
-  prev = NULL;
-  for (struct Lisp_Overlay *tail = buf->overlays_after;
-       tail; prev = tail, tail = next)
-    {
-      next = tail->next;
-      Lisp_Object overlay = make_lisp_ptr (tail, Lisp_Vectorlike);
-      eassert (OVERLAYP (overlay));
-
-      Lisp_Object beg = OVERLAY_START (overlay);
-      Lisp_Object end = OVERLAY_END (overlay);
-
-      /* Stop looking, when we know that nothing further
-	 can possibly end before POS.  */
-      if (OVERLAY_POSITION (beg) > pos)
-	break;
-
-      if (OVERLAY_POSITION (end) <= pos)
-	{
-	  /* OVERLAY needs to be moved.  */
-	  ptrdiff_t where = OVERLAY_POSITION (end);
-	  struct Lisp_Overlay *other, *other_prev;
-
-	  /* Splice the cons cell TAIL out of overlays_after.  */
-	  if (prev)
-	    prev->next = next;
-	  else
-	    set_buffer_overlays_after (buf, next);
-
-	  /* Search thru overlays_before for where to put it.  */
-	  other_prev = NULL;
-	  for (other = buf->overlays_before; other;
-	       other_prev = other, other = other->next)
-	    {
-	      Lisp_Object otheroverlay = make_lisp_ptr (other, Lisp_Vectorlike);
-	      eassert (OVERLAYP (otheroverlay));
-
-	      Lisp_Object otherend = OVERLAY_END (otheroverlay);
-	      if (OVERLAY_POSITION (otherend) <= where)
-		break;
-	    }
-
-	  /* Add TAIL to overlays_before before OTHER.  */
-	  tail->next = other;
-	  if (other_prev)
-	    other_prev->next = tail;
-	  else
-	    set_buffer_overlays_before (buf, tail);
-	  tail = prev;
-	}
-    }
-
-  buf->overlay_center = pos;
-}
+/* Fix up the overlay tree of B, which has overlays, after the markers
+   in the range START through END were permuted.  Any overlay with at
+   least one endpoint in this range is taken out of the tree and put
+   back in its proper place.  The tree is still good enough to find
+   these overlays, because the permuted starts are next to each other
+   in it, and the overlay recorded as ending last in a subtree still
+   ends at or after START if any overlay there does.
+   Such an overlay might even have negative size at this point.
+   If so, we'll make the overlay empty.  */
 
-void
-adjust_overlays_for_insert (ptrdiff_t pos, ptrdiff_t length)
+static void
+fix_overlays_in_range (struct buffer *b, ptrdiff_t start, ptrdiff_t end)
 {
-  /* After an insertion, the lists are still sorted properly,
-     but we may need to update the value of the overlay center.  */
-  if (current_buffer->overlay_center >= pos)
-    current_buffer->overlay_center += length;
-}
+  struct Lisp_Overlay *movedbuf[20];
+  struct Lisp_Overlay **moved = movedbuf;
+  ptrdiff_t n = 0, size = ARRAYELTS (movedbuf);
+  USE_SAFE_ALLOCA;
 
-void
-adjust_overlays_for_delete (ptrdiff_t pos, ptrdiff_t length)
-{
-  if (current_buffer->overlay_center < pos)
-    /* The deletion was to our right.  No change needed; the before- and
-       after-lists are still consistent.  */
-    ;
-  else if (current_buffer->overlay_center - pos > length)
-    /* The deletion was to our left.  We need to adjust the center value
-       to account for the change in position, but the lists are consistent
-       given the new value.  */
-    current_buffer->overlay_center -= length;
-  else
-    /* We're right in the middle.  There might be things on the after-list
-       that now belong on the before-list.  Recentering will move them,
-       and also update the center point.  */
-    recenter_overlay_lists (current_buffer, pos);
-}
+  FOR_EACH_OVERLAY_IN (ov, b, start, end)
+    if (start <= overlay_start (ov) || overlay_end (ov) <= end)
+      {
+	if (n == size)
+	  {
+	    struct Lisp_Overlay **old = moved;
+	    SAFE_NALLOCA (moved, 2, size);
+	    memcpy (moved, old, size * sizeof *moved);
+	    size *= 2;
+	  }
+	moved[n++] = ov;
+      }
 
-/* Fix up overlays that were garbled as a result of permuting markers
-   in the range START through END.  Any overlay with at least one
-   endpoint in this range will need to be unlinked from the overlay
-   list and reinserted in its proper place.
-   Such an overlay might even have negative size at this point.
-   If so, we'll make the overlay empty. */
-void
-fix_start_end_in_overlays (register ptrdiff_t start, register ptrdiff_t end)
-{
-  struct Lisp_Overlay *before_list UNINIT;
-  struct Lisp_Overlay *after_list UNINIT;
-  /* These are either nil, indicating that before_list or after_list
-     should be assigned, or the cons cell the cdr of which should be
-     assigned.  */
-  struct Lisp_Overlay *beforep = NULL, *afterp = NULL;
-  /* 'Parent', likewise, indicates a cons cell or
-     current_buffer->overlays_before or overlays_after, depending
-     which loop we're in.  */
-  struct Lisp_Overlay *parent;
-
-  /* This algorithm shifts links around instead of consing and GCing.
-     The loop invariant is that before_list (resp. after_list) is a
-     well-formed list except that its last element, the CDR of beforep
-     (resp. afterp) if beforep (afterp) isn't nil or before_list
-     (after_list) if it is, is still uninitialized.  So it's not a bug
-     that before_list isn't initialized, although it may look
-     strange.  */
-  parent = NULL;
-  for (struct Lisp_Overlay *tail = current_buffer->overlays_before;
-       tail; tail = tail->next)
+  for (ptrdiff_t i = 0; i < n; i++)
+    overlay_tree_remove (b, moved[i]);
+  for (ptrdiff_t i = 0; i < n; i++)
     {
-      Lisp_Object overlay = make_lisp_ptr (tail, Lisp_Vectorlike);
-
-      ptrdiff_t endpos = OVERLAY_POSITION (OVERLAY_END (overlay));
-      ptrdiff_t startpos = OVERLAY_POSITION (OVERLAY_START (overlay));
+      struct Lisp_Marker *m = XMARKER (moved[i]->end);
 
       /* If the overlay is backwards, make it empty.  */
-      if (endpos < startpos)
-	{
-	  startpos = endpos;
-	  Fset_marker (OVERLAY_START (overlay), make_fixnum (startpos),
-		       Qnil);
-	}
-
-      if (endpos < start)
-	break;
-
-      if (endpos < end
-	  || (startpos >= start && startpos < end))
-	{
-	  /* Add it to the end of the wrong list.  Later on,
-	     recenter_overlay_lists will move it to the right place.  */
-	  if (endpos < current_buffer->overlay_center)
-	    {
-	      if (!afterp)
-		after_list = tail;
-	      else
-		afterp->next = tail;
-	      afterp = tail;
-	    }
-	  else
-	    {
-	      if (!beforep)
-		before_list = tail;
-	      else
-		beforep->next = tail;
-	      beforep = tail;
-	    }
-	  if (!parent)
-	    set_buffer_overlays_before (current_buffer, tail->next);
-	  else
-	    parent->next = tail->next;
-	}
-      else
-	parent = tail;
+      if (marker_charpos (m) < overlay_start (moved[i]))
+	attach_marker (XMARKER (moved[i]->start), b,
+		       marker_charpos (m), marker_bytepos (m));
+      overlay_tree_insert (b, moved[i]);
     }
-  parent = NULL;
-  for (struct Lisp_Overlay *tail = current_buffer->overlays_after;
-       tail; tail = tail->next)
-    {
-      Lisp_Object overlay = make_lisp_ptr (tail, Lisp_Vectorlike);
-
-      ptrdiff_t startpos = OVERLAY_POSITION (OVERLAY_START (overlay));
-      ptrdiff_t endpos = OVERLAY_POSITION (OVERLAY_END (overlay));
 
-      /* If the overlay is backwards, make it empty.  */
-      if (endpos < startpos)
-	{
-	  startpos = endpos;
-	  Fset_marker (OVERLAY_START (overlay), make_fixnum (startpos),
-		       Qnil);
-	}
-
-      if (startpos >= end)
-	break;
-
-      if (startpos >= start
-	  || (endpos >= start && endpos < end))
-	{
-	  if (endpos < current_buffer->overlay_center)
-	    {
-	      if (!afterp)
-		after_list = tail;
-	      else
-		afterp->next = tail;
-	      afterp = tail;
-	    }
-	  else
-	    {
-	      if (!beforep)
-		before_list = tail;
-	      else
-		beforep->next = tail;
-	      beforep = tail;
-	    }
-	  if (!parent)
-	    set_buffer_overlays_after (current_buffer, tail->next);
-	  else
-	    parent->next = tail->next;
-	}
-      else
-	parent = tail;
-    }
-
-  /* Splice the constructed (wrong) lists into the buffer's lists,
-     and let the recenter function make it sane again.  */
-  if (beforep)
-    {
-      beforep->next = current_buffer->overlays_before;
-      set_buffer_overlays_before (current_buffer, before_list);
-    }
-
-  if (afterp)
-    {
-      afterp->next = current_buffer->overlays_after;
-      set_buffer_overlays_after (current_buffer, after_list);
-    }
-  recenter_overlay_lists (current_buffer, current_buffer->overlay_center);
+  SAFE_FREE ();
 }
 
-/* We have two types of overlay: the one whose ending marker is
-   after-insertion-marker (this is the usual case) and the one whose
-   ending marker is before-insertion-marker.  When `overlays_before'
-   contains overlays of the latter type and the former type in this
-   order and both overlays end at inserting position, inserting a text
-   increases only the ending marker of the latter type, which results
-   in incorrect ordering of `overlays_before'.
-
-   This function fixes ordering of overlays in the slot
-   `overlays_before' of the buffer *BP.  Before the insertion, `point'
-   was at PREV, and now is at POS.  */
+/* Fix up the overlays of the current buffer, and of the other buffers
+   that share its text, after the markers in the range START through
+   END were permuted.  This happens when an insertion advances only
+   some of the markers at START, and in `transpose-regions'.  */
 
 void
-fix_overlays_before (struct buffer *bp, ptrdiff_t prev, ptrdiff_t pos)
+fix_start_end_in_overlays (ptrdiff_t start, ptrdiff_t end)
 {
-  /* If parent is nil, replace overlays_before; otherwise, parent->next.  */
-  struct Lisp_Overlay *tail = bp->overlays_before, *parent = NULL, *right_pair;
-  Lisp_Object tem;
-  ptrdiff_t end UNINIT;
-
-  /* After the insertion, the several overlays may be in incorrect
-     order.  The possibility is that, in the list `overlays_before',
-     an overlay which ends at POS appears after an overlay which ends
-     at PREV.  Since POS is greater than PREV, we must fix the
-     ordering of these overlays, by moving overlays ends at POS before
-     the overlays ends at PREV.  */
-
-  /* At first, find a place where disordered overlays should be linked
-     in.  It is where an overlay which end before POS exists. (i.e. an
-     overlay whose ending marker is after-insertion-marker if disorder
-     exists).  */
-  while (tail
-	 && (tem = make_lisp_ptr (tail, Lisp_Vectorlike),
-	     (end = OVERLAY_POSITION (OVERLAY_END (tem))) >= pos))
-    {
-      parent = tail;
-      tail = tail->next;
-    }
-
-  /* If we don't find such an overlay,
-     or the found one ends before PREV,
-     or the found one is the last one in the list,
-     we don't have to fix anything.  */
-  if (!tail || end < prev || !tail->next)
-    return;
+  struct buffer *base = (current_buffer->base_buffer
+			 ? current_buffer->base_buffer : current_buffer);
 
-  right_pair = parent;
-  parent = tail;
-  tail = tail->next;
-
-  /* Now, end position of overlays in the list TAIL should be before
-     or equal to PREV.  In the loop, an overlay which ends at POS is
-     moved ahead to the place indicated by the CDR of RIGHT_PAIR.  If
-     we found an overlay which ends before PREV, the remaining
-     overlays are in correct order.  */
-  while (tail)
+  if (base->indirections > 0)
     {
-      tem = make_lisp_ptr (tail, Lisp_Vectorlike);
-      end = OVERLAY_POSITION (OVERLAY_END (tem));
-
-      if (end == pos)
-	{			/* This overlay is disordered. */
-	  struct Lisp_Overlay *found = tail;
-
-	  /* Unlink the found overlay.  */
-	  tail = found->next;
-	  parent->next = tail;
-	  /* Move an overlay at RIGHT_PLACE to the next of the found one,
-	     and link it into the right place.  */
-	  if (!right_pair)
-	    {
-	      found->next = bp->overlays_before;
-	      set_buffer_overlays_before (bp, found);
-	    }
-	  else
-	    {
-	      found->next = right_pair->next;
-	      right_pair->next = found;
-	    }
-	}
-      else if (end == prev)
-	{
-	  parent = tail;
-	  tail = tail->next;
-	}
-      else			/* No more disordered overlay. */
-	break;
+      Lisp_Object tail, buffer;
+
+      FOR_EACH_LIVE_BUFFER (tail, buffer)
+	if (XBUFFER (buffer)->text == current_buffer->text
+	    && XBUFFER (buffer)->overlays)
+	  fix_overlays_in_range (XBUFFER (buffer), start, end);
     }
+  else if (current_buffer->overlays)
+    fix_overlays_in_range (current_buffer, start, end);
 }
-
+
 DEFUN ("overlayp", Foverlayp, Soverlayp, 1, 1, 0,
        doc: /* Return t if OBJECT is an overlay.  */)
   (Lisp_Object object)
@@ -3889,23 +3894,7 @@ DEFUN ("make-overlay", Fmake_overlay, Smake_overlay, 2, 5, 0,
     XMARKER (end)->insertion_type = 1;
 
   overlay = build_overlay (beg, end, Qnil);
-
-  /* Put the new overlay on the wrong list.  */
-  end = OVERLAY_END (overlay);
-  if (OVERLAY_POSITION (end) < b->overlay_center)
-    {
-      eassert (b->overlays_after || (XOVERLAY (overlay)->next == NULL));
-      XOVERLAY (overlay)->next = b->overlays_after;
-      set_buffer_overlays_after (b, XOVERLAY (overlay));
-    }
-  else
-    {
-      eassert (b->overlays_before || (XOVERLAY (overlay)->next == NULL));
-      XOVERLAY (overlay)->next = b->overlays_before;
-      set_buffer_overlays_before (b, XOVERLAY (overlay));
-    }
-  /* This puts it in the right list, and in the right order.  */
-  recenter_overlay_lists (b, b->overlay_center);
+  overlay_tree_insert (b, XOVERLAY (overlay));
 
   /* We don't need to redisplay the region covered by the overlay, because
      the overlay has no properties at the moment.  */
@@ -3932,35 +3921,6 @@ modify_overlay (struct buffer *buf, ptrdiff_t start, ptrdiff_t end)
   modiff_incr (&BUF_OVERLAY_MODIFF (buf));
 }
 
-/* Remove OVERLAY from LIST.  */
-
-static struct Lisp_Overlay *
-unchain_overlay (struct Lisp_Overlay *list, struct Lisp_Overlay *overlay)
-{
-  register struct Lisp_Overlay *tail, **prev = &list;
-
-  for (tail = list; tail; prev = &tail->next, tail = *prev)
-    if (tail == overlay)
-      {
-	*prev = overlay->next;
-	overlay->next = NULL;
-	break;
-      }
-  return list;
-}
-
-/* Remove OVERLAY from both overlay lists of B.  */
-
-static void
-unchain_both (struct buffer *b, Lisp_Object overlay)
-{
-  struct Lisp_Overlay *ov = XOVERLAY (overlay);
-
-  set_buffer_overlays_before (b, unchain_overlay (b->overlays_before, ov));
-  set_buffer_overlays_after (b, unchain_overlay (b->overlays_after, ov));
-  eassert (XOVERLAY (overlay)->next == NULL);
-}
-
 DEFUN ("move-overlay", Fmove_overlay, Smove_overlay, 3, 4, 0,
        doc: /* Set the endpoints of OVERLAY to BEG and END in BUFFER.
 If BUFFER is omitted, leave OVERLAY in the same buffer it inhabits now.
@@ -4010,18 +3970,10 @@ DEFUN ("move-overlay", Fmove_overlay, Smove_overlay, 3, 4, 0,
       o_beg = OVERLAY_POSITION (OVERLAY_START (overlay));
       o_end = OVERLAY_POSITION (OVERLAY_END (overlay));
 
-      unchain_both (ob, overlay);
+      overlay_tree_remove (ob, XOVERLAY (overlay));
     }
-  else
-    /* An overlay not associated with any buffer will normally have its
-       `next' field set to NULL, but not always: when killing a buffer,
-       we just set its overlays_after and overlays_before to NULL without
-       manually setting each overlay's `next' field to NULL.
-       Let's correct it here, to simplify subsequent assertions.
-       FIXME: Maybe the better fix is to change `kill-buffer'!?  */
-    XOVERLAY (overlay)->next = NULL;
 
-  eassert (XOVERLAY (overlay)->next == NULL);
+  eassert (XOVERLAY (overlay)->maxend == NULL);
 
   /* Set the overlay boundaries, which may clip them.  */
   Fset_marker (OVERLAY_START (overlay), beg, buffer);
@@ -4051,13 +4003,11 @@ DEFUN ("move-overlay", Fmove_overlay, Smove_overlay, 3, 4, 0,
 	modify_overlay (b, min (o_beg, n_beg), max (o_end, n_end));
     }
 
-  eassert (XOVERLAY (overlay)->next == NULL);
-
   /* Delete the overlay if it is empty after clipping and has the
      evaporate property.  */
   if (n_beg == n_end && !NILP (Foverlay_get (overlay, Qevaporate)))
     { /* We used to call `Fdelete_overlay' here, but it causes problems:
-         - At this stage, `overlay' is not included in its buffer's lists
+         - At this stage, `overlay' is not included in its buffer's tree
            of overlays (the data-structure is in an inconsistent state),
            contrary to `Fdelete_overlay's assumptions.
          - Most of the work done by Fdelete_overlay has already been done
@@ -4066,21 +4016,8 @@ DEFUN ("move-overlay", Fmove_overlay, Smove_overlay, 3, 4, 0,
       return unbind_to (count, overlay);
     }
 
-  /* Put the overlay into the new buffer's overlay lists, first on the
-     wrong list.  */
-  if (n_end < b->overlay_center)
-    {
-      XOVERLAY (overlay)->next = b->overlays_after;
-      set_buffer_overlays_after (b, XOVERLAY (overlay));
-    }
-  else
-    {
-      XOVERLAY (overlay)->next = b->overlays_before;
-      set_buffer_overlays_before (b, XOVERLAY (overlay));
-    }
-
-  /* This puts it in the right list, and in the right order.  */
-  recenter_overlay_lists (b, b->overlay_center);
+  /* Put the overlay into the new buffer's overlay tree.  */
+  overlay_tree_insert (b, XOVERLAY (overlay));
 
   return unbind_to (count, overlay);
 }
@@ -4102,7 +4039,7 @@ DEFUN ("delete-overlay", Fdelete_overlay, Sdelete_overlay, 1, 1, 0,
   b = XBUFFER (buffer);
   specbind (Qinhibit_quit, Qt);
 
-  unchain_both (b, overlay);
+  overlay_tree_remove (b, XOVERLAY (overlay));
   drop_overlay (b, XOVERLAY (overlay));
 
   /* When deleting an overlay with before or after strings, turn off
@@ -4189,8 +4126,7 @@ DEFUN ("overlays-at", Foverlays_at, Soverlays_at, 1, 2, 0,
 
   /* Put all the overlays we want in a vector in overlay_vec.
      Store the length in len.  */
-  noverlays = overlays_at (XFIXNUM (pos), 1, &overlay_vec, &len,
-			   NULL, NULL, 0);
+  noverlays = overlays_at (XFIXNUM (pos), 1, &overlay_vec, &len, NULL);
 
   if (!NILP (sorted))
     noverlays = sort_overlays (overlay_vec, noverlays,
@@ -4233,8 +4169,8 @@ DEFUN ("overlays-in", Foverlays_in, Soverlays_in, 2, 2, 0,
 
   /* Put all the overlays we want in a vector in overlay_vec.
      Store the length in len.  */
-  noverlays = overlays_in (XFIXNUM (beg), XFIXNUM (end), 1, &overlay_vec, &len,
-			   NULL, NULL);
+  noverlays = overlays_in (XFIXNUM (beg), XFIXNUM (end), 1,
+			   &overlay_vec, &len);
 
   /* Make a list of them all.  */
   result = Flist (noverlays, overlay_vec);
@@ -4250,39 +4186,12 @@ DEFUN ("next-overlay-change", Fnext_overlay_change, Snext_overlay_change,
 the value is (point-max).  */)
   (Lisp_Object pos)
 {
-  ptrdiff_t i, len, noverlays;
-  ptrdiff_t endpos;
-  Lisp_Object *overlay_vec;
-
   CHECK_FIXNUM_COERCE_MARKER (pos);
 
   if (!buffer_has_overlays ())
     return make_fixnum (ZV);
 
-  len = 10;
-  overlay_vec = xmalloc (len * sizeof *overlay_vec);
-
-  /* Put all the overlays we want in a vector in overlay_vec.
-     Store the length in len.
-     endpos gets the position where the next overlay starts.  */
-  noverlays = overlays_at (XFIXNUM (pos), 1, &overlay_vec, &len,
-			   &endpos, 0, 1);
-
-  /* If any of these overlays ends before endpos,
-     use its ending point instead.  */
-  for (i = 0; i < noverlays; i++)
-    {
-      Lisp_Object oend;
-      ptrdiff_t oendpos;
-
-      oend = OVERLAY_END (overlay_vec[i]);
-      oendpos = OVERLAY_POSITION (oend);
-      if (oendpos < endpos)
-	endpos = oendpos;
-    }
-
-  xfree (overlay_vec);
-  return make_fixnum (endpos);
+  return make_fixnum (next_overlay_change (XFIXNUM (pos)));
 }
 
 DEFUN ("previous-overlay-change", Fprevious_overlay_change,
@@ -4292,67 +4201,45 @@ DEFUN ("previous-overlay-change", Fprevious_overlay_change,
 the value is (point-min).  */)
   (Lisp_Object pos)
 {
-  ptrdiff_t prevpos;
-  Lisp_Object *overlay_vec;
-  ptrdiff_t len;
-
   CHECK_FIXNUM_COERCE_MARKER (pos);
 
   if (!buffer_has_overlays ())
     return make_fixnum (BEGV);
 
-  /* At beginning of buffer, we know the answer;
-     avoid bug subtracting 1 below.  */
+  /* At beginning of buffer, we know the answer.  */
   if (XFIXNUM (pos) == BEGV)
     return pos;
 
-  len = 10;
-  overlay_vec = xmalloc (len * sizeof *overlay_vec);
-
-  /* Put all the overlays we want in a vector in overlay_vec.
-     Store the length in len.
-     prevpos gets the position of the previous change.  */
-  overlays_at (XFIXNUM (pos), 1, &overlay_vec, &len,
-	       0, &prevpos, 1);
-
-  xfree (overlay_vec);
-  return make_fixnum (prevpos);
+  return make_fixnum (previous_overlay_change (XFIXNUM (pos)));
 }
-
+
 /* These functions are for debugging overlays.  */
 
 DEFUN ("overlay-lists", Foverlay_lists, Soverlay_lists, 0, 0, 0,
        doc: /* Return a pair of lists giving all the overlays of the current buffer.
-The car has all the overlays before the overlay center;
-the cdr has all the overlays after the overlay center.
-Recentering overlays moves overlays between these lists.
+The car has all the overlays, in order of their start positions, and
+the cdr is nil.  (Overlays used to be split between the two lists at
+the overlay center, see `overlay-recenter'.)
 The lists you get are copies, so that changing them has no effect.
 However, the overlays you get are the real objects that the buffer uses.  */)
   (void)
 {
-  Lisp_Object before = Qnil, after = Qnil;
+  Lisp_Object overlays = Qnil;
 
-  for (struct Lisp_Overlay *ol = current_buffer->overlays_before;
-       ol; ol = ol->next)
-    before = Fcons (make_lisp_ptr (ol, Lisp_Vectorlike), before);
-  for (struct Lisp_Overlay *ol = current_buffer->overlays_after;
-       ol; ol = ol->next)
-    after = Fcons (make_lisp_ptr (ol, Lisp_Vectorlike), after);
+  FOR_EACH_OVERLAY_IN (ov, current_buffer, PTRDIFF_MIN, PTRDIFF_MAX)
+    overlays = Fcons (make_lisp_ptr (ov, Lisp_Vectorlike), overlays);
 
-  return Fcons (Fnreverse (before), Fnreverse (after));
+  return Fcons (Fnreverse (overlays), Qnil);
 }
 
 DEFUN ("overlay-recenter", Foverlay_recenter, Soverlay_recenter, 1, 1, 0,
-       doc: /* Recenter the overlays of the current buffer around position POS.
-That makes overlay lookup faster for positions near POS (but perhaps slower
-for positions far away from POS).  */)
+       doc: /* Do nothing; formerly, recenter overlays around POS.
+Overlays used to be kept in two lists divided around a center, which
+this function moved to POS.  They are now kept in a balanced tree,
+which makes looking them up fast at every position.  */)
   (Lisp_Object pos)
 {
-  ptrdiff_t p;
   CHECK_FIXNUM_COERCE_MARKER (pos);
-
-  p = clip_to_bounds (PTRDIFF_MIN, XFIXNUM (pos), PTRDIFF_MAX);
-  recenter_overlay_lists (current_buffer, p);
   return Qnil;
 }
 
@@ -4472,58 +4359,13 @@ report_overlay_modification (Lisp_Object start, Lisp_Object end, bool after,
       /* We are being called before a change.
 	 Scan the overlays to find the functions to call.  */
       last_overlay_modification_hooks_used = 0;
-      for (struct Lisp_Overlay *tail = current_buffer->overlays_before;
-	   tail; tail = tail->next)
+      FOR_EACH_OVERLAY_IN (tail, current_buffer,
+			   XFIXNAT (start), XFIXNAT (end))
 	{
-	  ptrdiff_t startpos, endpos;
-	  Lisp_Object ostart, oend;
-
 	  Lisp_Object overlay = make_lisp_ptr (tail, Lisp_Vectorlike);
+	  ptrdiff_t startpos = overlay_start (tail);
+	  ptrdiff_t endpos = overlay_end (tail);
 
-	  ostart = OVERLAY_START (overlay);
-	  oend = OVERLAY_END (overlay);
-	  endpos = OVERLAY_POSITION (oend);
-	  if (XFIXNAT (start) > endpos)
-	    break;
-	  startpos = OVERLAY_POSITION (ostart);
-	  if (insertion && (XFIXNAT (start) == startpos
-			    || XFIXNAT (end) == startpos))
-	    {
-	      Lisp_Object prop = Foverlay_get (overlay, Qinsert_in_front_hooks);
-	      if (!NILP (prop))
-		add_overlay_mod_hooklist (prop, overlay);
-	    }
-	  if (insertion && (XFIXNAT (start) == endpos
-			    || XFIXNAT (end) == endpos))
-	    {
-	      Lisp_Object prop = Foverlay_get (overlay, Qinsert_behind_hooks);
-	      if (!NILP (prop))
-		add_overlay_mod_hooklist (prop, overlay);
-	    }
-	  /* Test for intersecting intervals.  This does the right thing
-	     for both insertion and deletion.  */
-	  if (XFIXNAT (end) > startpos && XFIXNAT (start) < endpos)
-	    {
-	      Lisp_Object prop = Foverlay_get (overlay, Qmodification_hooks);
-	      if (!NILP (prop))
-		add_overlay_mod_hooklist (prop, overlay);
-	    }
-	}
-
-      for (struct Lisp_Overlay *tail = current_buffer->overlays_after;
-	   tail; tail = tail->next)
-	{
-	  ptrdiff_t startpos, endpos;
-	  Lisp_Object ostart, oend;
-
-	  Lisp_Object overlay = make_lisp_ptr (tail, Lisp_Vectorlike);
-
-	  ostart = OVERLAY_START (overlay);
-	  oend = OVERLAY_END (overlay);
-	  startpos = OVERLAY_POSITION (ostart);
-	  endpos = OVERLAY_POSITION (oend);
-	  if (XFIXNAT (end) < startpos)
-	    break;
 	  if (insertion && (XFIXNAT (start) == startpos
 			    || XFIXNAT (end) == startpos))
 	    {
@@ -4599,28 +4441,11 @@ call_overlay_mod_hooks (Lisp_Object list, Lisp_Object overlay, bool after,
 evaporate_overlays (ptrdiff_t pos)
 {
   Lisp_Object hit_list = Qnil;
-  if (pos <= current_buffer->overlay_center)
-    for (struct Lisp_Overlay *tail = current_buffer->overlays_before;
-	 tail; tail = tail->next)
-      {
-	Lisp_Object overlay = make_lisp_ptr (tail, Lisp_Vectorlike);
-	ptrdiff_t endpos = OVERLAY_POSITION (OVERLAY_END (overlay));
-	if (endpos < pos)
-	  break;
-	if (endpos == pos && OVERLAY_POSITION (OVERLAY_START (overlay)) == pos
-	    && ! NILP (Foverlay_get (overlay, Qevaporate)))
-	  hit_list = Fcons (overlay, hit_list);
-      }
-  else
-    for (struct Lisp_Overlay *tail = current_buffer->overlays_after;
-	 tail; tail = tail->next)
+  FOR_EACH_OVERLAY_IN (tail, current_buffer, pos, pos)
+    if (overlay_start (tail) == pos && overlay_end (tail) == pos)
       {
 	Lisp_Object overlay = make_lisp_ptr (tail, Lisp_Vectorlike);
-	ptrdiff_t startpos = OVERLAY_POSITION (OVERLAY_START (overlay));
-	if (startpos > pos)
-	  break;
-	if (startpos == pos && OVERLAY_POSITION (OVERLAY_END (overlay)) == pos
-	    && ! NILP (Foverlay_get (overlay, Qevaporate)))
+	if (! NILP (Foverlay_get (overlay, Qevaporate)))
 	  hit_list = Fcons (overlay, hit_list);
       }
   for (; CONSP (hit_list); hit_list = XCDR (hit_list))
@@ -5029,7 +4854,9 @@ enlarge_buffer_text (struct buffer *b, ptrdiff_t delta)
     BUF_Z_BYTE (b) - BUF_BEG_BYTE (b) + BUF_GAP_SIZE (b) + 1;
   ptrdiff_t new_nbytes = old_nbytes + delta;
 
-  if (pdumper_object_p (old_beg))
+  /* Text that comes from a dump file or a file mapping is copied to
+     newly allocated storage.  */
+  if (pdumper_object_p (old_beg) || b->text->mapped_size)
     b->text->beg = NULL;
   else
     old_beg = NULL;
@@ -5052,6 +4879,13 @@ enlarge_buffer_text (struct buffer *b, ptrdiff_t delta)
 
   if (old_beg)
     memcpy (p, old_beg, min (old_nbytes, new_nbytes));
+#ifdef MAP_BUFFER_TEXT
+  if (b->text->mapped_size)
+    {
+      munmap (old_beg, b->text->mapped_size);
+      b->text->mapped_size = 0;
+    }
+#endif
 
   BUF_BEG_ADDR (b) = p;
   unblock_input ();
@@ -5065,6 +4899,14 @@ free_buffer_text (struct buffer *b)
 {
   block_input ();
 
+#ifdef MAP_BUFFER_TEXT
+  if (b->text->mapped_size)
+    {
+      munmap (b->text->beg, b->text->mapped_size);
+      b->text->mapped_size = 0;
+    }
+  else
+#endif
   if (!pdumper_object_p (b->text->beg))
     {
 #if defined USE_MMAP_FOR_BUFFERS
@@ -5080,6 +4922,83 @@ free_buffer_text (struct buffer *b)
   unblock_input ();
 }
 
+/* Make the first NBYTES bytes of the regular file open on FD the
+   start of the gap of buffer B, which must be empty, as if they had
+   been read there, but by mapping the file into memory instead of
+   reading it.  The file's pages are then read only when something
+   looks at them, and the system can drop them again when memory gets
+   tight.  B's text must not be modified while it is mapped: the first
+   change copies it to ordinary storage, see prepare_to_modify_buffer_1.
+   Return true if successful, false if the file could not be mapped.  */
+
+bool
+map_buffer_text (struct buffer *b, int fd, ptrdiff_t nbytes)
+{
+#ifdef MAP_BUFFER_TEXT
+  eassert (BUF_BEG (b) == BUF_Z (b) && b->text == &b->own_text);
+  ptrdiff_t pagesize = getpagesize ();
+  ptrdiff_t file_size = ROUNDUP (nbytes, pagesize);
+  ptrdiff_t gap_size = nbytes + GAP_BYTES_DFL;
+  ptrdiff_t size = ROUNDUP (gap_size + 1, pagesize);
+
+  /* Map anonymous memory for the rest of the gap and the anchor byte
+     behind it, and the file over the start of that.  The remainder of
+     the file's last page reads as zeros, and both parts are private,
+     so a write to them is never seen by the file.  */
+  void *p = mmap (NULL, size, PROT_READ | PROT_WRITE,
+		  MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+  if (p == MAP_FAILED)
+    return false;
+  if (mmap (p, file_size, PROT_READ | PROT_WRITE,
+	    MAP_PRIVATE | MAP_FIXED, fd, 0)
+      == MAP_FAILED)
+    {
+      munmap (p, size);
+      return false;
+    }
+
+  free_buffer_text (b);
+  block_input ();
+  b->text->beg = p;
+  b->text->mapped_size = size;
+  BUF_GAP_SIZE (b) = gap_size;
+  unblock_input ();
+  return true;
+#else
+  return false;
+#endif
+}
+
+/* Handle a bus error at ADDR, which happens when a page of a mapped
+   buffer text lies beyond the end of its file because the file has
+   been truncated since it was mapped.  If ADDR is in such a buffer
+   text, replace the page with zeros and return true; otherwise return
+   false.  Called from a signal handler.  */
+
+bool
+mapped_buffer_text_fault (void *addr)
+{
+#ifdef MAP_BUFFER_TEXT
+  uintptr_t a = (uintptr_t) addr;
+  struct buffer *b;
+
+  FOR_EACH_BUFFER (b)
+    if (b->own_text.mapped_size)
+      {
+	uintptr_t beg = (uintptr_t) b->own_text.beg;
+	if (beg <= a && a - beg < b->own_text.mapped_size)
+	  {
+	    uintptr_t page = a & - (uintptr_t) getpagesize ();
+	    return (mmap ((void *) page, getpagesize (),
+			  PROT_READ | PROT_WRITE,
+			  MAP_ANONYMOUS | MAP_PRIVATE | MAP_FIXED, -1, 0)
+		    != MAP_FAILED);
+	  }
+      }
+#endif
+  return false;
+}
+
 
 
 /***********************************************************************
@@ -5245,9 +5164,7 @@ init_buffer_once (void)
   bset_mark_active (&buffer_defaults, Qnil);
   bset_file_format (&buffer_defaults, Qnil);
   bset_auto_save_file_format (&buffer_defaults, Qt);
-  set_buffer_overlays_before (&buffer_defaults, NULL);
-  set_buffer_overlays_after (&buffer_defaults, NULL);
-  buffer_defaults.overlay_center = BEG;
+  buffer_defaults.overlays = NULL;
 
   XSETFASTINT (BVAR (&buffer_defaults, tab_width), 8);
   bset_truncate_lines (&buffer_defaults, Qnil);
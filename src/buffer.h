@@ -195,6 +195,9 @@ #define BUF_COMPACT(buf) ((buf)->text->compact)
 /* Marker chain of buffer.  */
 #define BUF_MARKERS(buf) ((buf)->text->markers)
 
+/* Marker index of buffer text.  */
+#define BUF_MARKER_INDEX(buf) ((buf)->text->marker_index)
+
 #define BUF_UNCHANGED_MODIFIED(buf) \
   ((buf)->text->unchanged_modified)
 
@@ -254,6 +257,7 @@ #define BUF_TEMP_SET_PT(buffer, position) \
 				 ptrdiff_t, ptrdiff_t);
 extern void set_point_from_marker (Lisp_Object);
 extern void enlarge_buffer_text (struct buffer *, ptrdiff_t);
+extern bool map_buffer_text (struct buffer *, int, ptrdiff_t);
 
 
 /* Macros for setting the BEGV, ZV or PT of a given buffer.
@@ -469,6 +473,20 @@ #define BUF_FETCH_BYTE(buf, n) \
        to move a marker within a buffer.  */
     struct Lisp_Marker *markers;
 
+    /* If non-NULL, the same markers ordered by position, which lets a
+       change to a text with many markers adjust only the markers near
+       the change.  See marker.c.  */
+    struct marker_index *marker_index;
+
+    /* If non-NULL, known correspondences between character and byte
+       positions spread over a large text.  See marker.c.  */
+    struct charpos_checkpoints *charpos_checkpoints;
+
+    /* If nonzero, BEG was not allocated like other buffer texts but is
+       a private memory mapping of this many bytes, the first of which
+       map a file.  See map_buffer_text.  */
+    ptrdiff_t mapped_size;
+
     /* Usually false.  Temporarily true in decode_coding_gap to
        prevent Fgarbage_collect from shrinking the gap and losing
        not-yet-decoded bytes.  */
@@ -866,16 +884,14 @@ #define UNKNOWN_MODTIME_NSECS (-2)
      defined.  */
   bool_bf inhibit_buffer_hooks : 1;
 
-  /* List of overlays that end at or before the current center,
-     in order of end-position.  */
-  struct Lisp_Overlay *overlays_before;
-
-  /* List of overlays that end after  the current center,
-     in order of start-position.  */
-  struct Lisp_Overlay *overlays_after;
+  /* Root of the tree of this buffer's overlays, ordered by start
+     position.  */
+  struct Lisp_Overlay *overlays;
 
-  /* Position where the overlay lists are centered.  */
-  ptrdiff_t overlay_center;
+  /* If non-NULL, changes recorded for undo that have not been put on
+     undo_list yet.  They are newer than anything on it.  See undo.c
+     and buffer_undo_list.  */
+  struct undo_log *undo_log;
 
   /* Changes in the buffer are recorded here for undo, and t means
      don't record anything.  This information belongs to the base
@@ -1018,6 +1034,18 @@ bset_width_table (struct buffer *b, Lisp_Object val)
   b->width_table_ = val;
 }
 
+/* Return the undo list of buffer B, first putting on it any changes
+   still in B's undo log.  Use this rather than BVAR when the value
+   is kept, or stored back later.  */
+
+INLINE Lisp_Object
+buffer_undo_list (struct buffer *b)
+{
+  if (b->undo_log)
+    flush_undo_log (b);
+  return BVAR (b, undo_list);
+}
+
 /* Number of Lisp_Objects at the beginning of struct buffer.
    If you add, remove, or reorder Lisp_Objects within buffer
    structure, make sure that this is still correct.  */
@@ -1107,9 +1135,16 @@ #define FOR_EACH_BUFFER(b) \
 extern void compact_buffer (struct buffer *);
 extern void evaporate_overlays (ptrdiff_t);
 extern ptrdiff_t overlays_at (EMACS_INT, bool, Lisp_Object **,
-			      ptrdiff_t *, ptrdiff_t *, ptrdiff_t *, bool);
+			      ptrdiff_t *, ptrdiff_t *);
+extern ptrdiff_t next_overlay_change (ptrdiff_t);
+extern ptrdiff_t previous_overlay_change (ptrdiff_t);
+extern struct Lisp_Overlay *first_overlay_in (struct buffer *,
+					      ptrdiff_t, ptrdiff_t);
+extern struct Lisp_Overlay *next_overlay_in (struct Lisp_Overlay *,
+					     ptrdiff_t, ptrdiff_t);
+extern struct Lisp_Overlay *unlink_marker_overlay (struct Lisp_Marker *);
+extern void relink_overlay (struct Lisp_Overlay *);
 extern ptrdiff_t sort_overlays (Lisp_Object *, ptrdiff_t, struct window *);
-extern void recenter_overlay_lists (struct buffer *, ptrdiff_t);
 extern ptrdiff_t overlay_strings (ptrdiff_t, struct window *, unsigned char **);
 extern void validate_region (Lisp_Object *, Lisp_Object *);
 extern void set_buffer_internal_1 (struct buffer *);
@@ -1117,7 +1152,6 @@ #define FOR_EACH_BUFFER(b) \
 extern void set_buffer_temp (struct buffer *);
 extern Lisp_Object buffer_local_value (Lisp_Object, Lisp_Object);
 extern void record_buffer (Lisp_Object);
-extern void fix_overlays_before (struct buffer *, ptrdiff_t, ptrdiff_t);
 extern void mmap_set_vars (bool);
 extern void restore_buffer (Lisp_Object);
 extern void set_buffer_if_live (Lisp_Object);
@@ -1156,24 +1190,33 @@ record_unwind_current_buffer (void)
 }
 
 /* Get overlays at POSN into array OVERLAYS with NOVERLAYS elements.
-   If NEXTP is non-NULL, return next overlay there.
-   See overlay_at arg CHANGE_REQ for meaning of CHRQ arg.  */
+   If NEXTP is non-NULL, return next overlay there.  */
 
-#define GET_OVERLAYS_AT(posn, overlays, noverlays, nextp, chrq)		\
+#define GET_OVERLAYS_AT(posn, overlays, noverlays, nextp)		\
   do {									\
     ptrdiff_t maxlen = 40;						\
     SAFE_NALLOCA (overlays, 1, maxlen);					\
     (noverlays) = overlays_at (posn, false, &(overlays), &maxlen,	\
-			       nextp, NULL, chrq);			\
+			       nextp);					\
     if ((noverlays) > maxlen)						\
       {									\
 	maxlen = noverlays;						\
 	SAFE_NALLOCA (overlays, 1, maxlen);				\
 	(noverlays) = overlays_at (posn, false, &(overlays), &maxlen,	\
-				   nextp, NULL, chrq);			\
+				   nextp);				\
       }									\
   } while (false)
 
+/* FOR_EACH_OVERLAY_IN (OV, B, BEG, END) followed by a statement is a
+   `for' loop which iterates OV over the overlays of buffer B that end
+   at or after BEG and start at or before END, in order of their start
+   positions.  The statement must not add, move or delete overlays of
+   B.  */
+
+#define FOR_EACH_OVERLAY_IN(ov, b, beg, end)				\
+  for (struct Lisp_Overlay *ov = first_overlay_in (b, beg, end);	\
+       ov; ov = next_overlay_in (ov, beg, end))
+
 extern Lisp_Object Vbuffer_alist;
 
 /* FOR_EACH_LIVE_BUFFER (LIST_VAR, BUF_VAR) followed by a statement is
@@ -1205,7 +1248,7 @@ set_buffer_intervals (struct buffer *b, INTERVAL i)
 INLINE bool
 buffer_has_overlays (void)
 {
-  return current_buffer->overlays_before || current_buffer->overlays_after;
+  return current_buffer->overlays != NULL;
 }
 
 /* Return character code of multi-byte form at byte position POS.  If POS
@@ -7375,7 +7375,7 @@ decode_coding (struct coding_system *coding)
       if (MODIFF <= SAVE_MODIFF)
 	record_first_change ();
 
-      undo_list = BVAR (current_buffer, undo_list);
+      undo_list = buffer_undo_list (current_buffer);
       bset_undo_list (current_buffer, Qt);
     }
 
@@ -8010,7 +8010,7 @@ decode_coding_gap (struct coding_system *coding, ptrdiff_t bytes)
     {
       ptrdiff_t prev_Z = Z, prev_Z_BYTE = Z_BYTE;
       Lisp_Object val;
-      Lisp_Object undo_list = BVAR (current_buffer, undo_list);
+      Lisp_Object undo_list = buffer_undo_list (current_buffer);
 
       record_unwind_protect (coding_restore_undo_list,
 			     Fcons (undo_list, Fcurrent_buffer ()));
@@ -8103,7 +8103,7 @@ decode_coding_object (struct coding_system *coding,
 	  for (tail = BUF_MARKERS (current_buffer); tail; tail = tail->next)
 	    {
 	      tail->need_adjustment
-		= tail->charpos == (tail->insertion_type ? from : to);
+		= marker_charpos (tail) == (tail->insertion_type ? from : to);
 	      need_marker_adjustment |= tail->need_adjustment;
 	    }
 	  saved_pt = PT, saved_pt_byte = PT_BYTE;
@@ -8161,7 +8161,7 @@ decode_coding_object (struct coding_system *coding,
     {
       ptrdiff_t prev_Z = Z, prev_Z_BYTE = Z_BYTE;
       Lisp_Object val;
-      Lisp_Object undo_list = BVAR (current_buffer, undo_list);
+      Lisp_Object undo_list = buffer_undo_list (current_buffer);
       ptrdiff_t count1 = SPECPDL_INDEX ();
 
       record_unwind_protect (coding_restore_undo_list,
@@ -8222,16 +8222,15 @@ decode_coding_object (struct coding_system *coding,
 	      {
 		tail->need_adjustment = 0;
 		if (tail->insertion_type)
-		  {
-		    tail->bytepos = from_byte;
-		    tail->charpos = from;
-		  }
+		  attach_marker (tail, tail->buffer, from, from_byte);
 		else
 		  {
-		    tail->bytepos = from_byte + coding->produced;
-		    tail->charpos
-		      = (NILP (BVAR (current_buffer, enable_multibyte_characters))
-			 ? tail->bytepos : from + coding->produced_char);
+		    ptrdiff_t bytepos = from_byte + coding->produced;
+		    attach_marker
+		      (tail, tail->buffer,
+		       (NILP (BVAR (current_buffer, enable_multibyte_characters))
+			? bytepos : from + coding->produced_char),
+		       bytepos);
 		  }
 	      }
 	}
@@ -8274,7 +8273,7 @@ encode_coding_object (struct coding_system *coding,
       for (tail = BUF_MARKERS (current_buffer); tail; tail = tail->next)
 	{
 	  tail->need_adjustment
-	    = tail->charpos == (tail->insertion_type ? from : to);
+	    = marker_charpos (tail) == (tail->insertion_type ? from : to);
 	  need_marker_adjustment |= tail->need_adjustment;
 	}
     }
@@ -8425,16 +8424,15 @@ encode_coding_object (struct coding_system *coding,
 	      {
 		tail->need_adjustment = 0;
 		if (tail->insertion_type)
-		  {
-		    tail->bytepos = from_byte;
-		    tail->charpos = from;
-		  }
+		  attach_marker (tail, tail->buffer, from, from_byte);
 		else
 		  {
-		    tail->bytepos = from_byte + coding->produced;
-		    tail->charpos
-		      = (NILP (BVAR (current_buffer, enable_multibyte_characters))
-			 ? tail->bytepos : from + coding->produced_char);
+		    ptrdiff_t bytepos = from_byte + coding->produced;
+		    attach_marker
+		      (tail, tail->buffer,
+		       (NILP (BVAR (current_buffer, enable_multibyte_characters))
+			? bytepos : from + coding->produced_char),
+		       bytepos);
 		  }
 	      }
 	}
@@ -992,8 +992,12 @@ do_symval_forwarding (lispfwd valcontents)
       return *XOBJFWD (valcontents)->objvar;
 
     case Lisp_Fwd_Buffer_Obj:
-      return per_buffer_value (current_buffer,
-			       XBUFFER_OBJFWD (valcontents)->offset);
+      {
+	int offset = XBUFFER_OBJFWD (valcontents)->offset;
+	if (offset == PER_BUFFER_VAR_OFFSET (undo_list))
+	  return buffer_undo_list (current_buffer);
+	return per_buffer_value (current_buffer, offset);
+      }
 
     case Lisp_Fwd_Kboard_Obj:
       /* We used to simply use current_kboard here, but from Lisp
@@ -1150,6 +1154,8 @@ store_symval_forwarding (lispfwd valcontents, Lisp_Object newval,
 	  }
 	if (buf == NULL)
 	  buf = current_buffer;
+	if (offset == PER_BUFFER_VAR_OFFSET (undo_list))
+	  discard_undo_log (buf);
 	set_per_buffer_value (buf, offset, newval);
       }
       break;
@@ -3390,7 +3396,7 @@ shift_right_ull (bits_word w)
 
 /* Return the number of 1 bits in W.  */
 
-static int
+int
 count_one_bits_word (bits_word w)
 {
   if (BITS_WORD_MAX <= UINT_MAX)
@@ -269,41 +269,12 @@ overlays_around (EMACS_INT pos, Lisp_Object *vec, ptrdiff_t len)
 {
   ptrdiff_t idx = 0;
 
-  for (struct Lisp_Overlay *tail = current_buffer->overlays_before;
-       tail; tail = tail->next)
+  FOR_EACH_OVERLAY_IN (tail, current_buffer, pos, pos)
     {
-      Lisp_Object overlay = make_lisp_ptr (tail, Lisp_Vectorlike);
-      Lisp_Object end = OVERLAY_END (overlay);
-      ptrdiff_t endpos = OVERLAY_POSITION (end);
-      if (endpos < pos)
-	  break;
-      Lisp_Object start = OVERLAY_START (overlay);
-      ptrdiff_t startpos = OVERLAY_POSITION (start);
-      if (startpos <= pos)
-	{
-	  if (idx < len)
-	    vec[idx] = overlay;
-	  /* Keep counting overlays even if we can't return them all.  */
-	  idx++;
-	}
-    }
-
-  for (struct Lisp_Overlay *tail = current_buffer->overlays_after;
-       tail; tail = tail->next)
-    {
-      Lisp_Object overlay = make_lisp_ptr (tail, Lisp_Vectorlike);
-      Lisp_Object start = OVERLAY_START (overlay);
-      ptrdiff_t startpos = OVERLAY_POSITION (start);
-      if (pos < startpos)
-	break;
-      Lisp_Object end = OVERLAY_END (overlay);
-      ptrdiff_t endpos = OVERLAY_POSITION (end);
-      if (pos <= endpos)
-	{
-	  if (idx < len)
-	    vec[idx] = overlay;
-	  idx++;
-	}
+      if (idx < len)
+	vec[idx] = make_lisp_ptr (tail, Lisp_Vectorlike);
+      /* Keep counting overlays even if we can't return them all.  */
+      idx++;
     }
 
   return idx;
@@ -2311,7 +2282,7 @@ #define COMBINING_BOTH (COMBINING_BEFORE | COMBINING_AFTER)
   if (!changed && !NILP (noundo))
     {
       record_unwind_protect (subst_char_in_region_unwind,
-			     BVAR (current_buffer, undo_list));
+			     buffer_undo_list (current_buffer));
       bset_undo_list (current_buffer, Qt);
       /* Don't do file-locking.  */
       record_unwind_protect (subst_char_in_region_unwind_1,
@@ -2378,7 +2349,7 @@ #define COMBINING_BOTH (COMBINING_BEFORE | COMBINING_AFTER)
 	    {
 	      Lisp_Object tem, string;
 
-	      tem = BVAR (current_buffer, undo_list);
+	      tem = buffer_undo_list (current_buffer);
 
 	      /* Make a multibyte string containing this single character.  */
 	      string = make_multibyte_string ((char *) tostr, 1, len);
@@ -2396,7 +2367,11 @@ #define COMBINING_BOTH (COMBINING_BEFORE | COMBINING_AFTER)
 		INC_POS (pos_byte_next);
 
 	      if (! NILP (noundo))
-		bset_undo_list (current_buffer, tem);
+		{
+		  /* Forget what replace_range put in the log, too.  */
+		  discard_undo_log (current_buffer);
+		  bset_undo_list (current_buffer, tem);
+		}
 	    }
 	  else
 	    {
@@ -2664,6 +2639,114 @@ DEFUN ("delete-and-extract-region", Fdelete_and_extract_region,
   return del_range_1 (XFIXNUM (start), XFIXNUM (end), 1, 1);
 }
 
+/* A replacement for `replace-buffer-regions'.  */
+struct buffer_edit
+{
+  ptrdiff_t start, end;
+
+  /* The position of the replacement in the argument.  */
+  ptrdiff_t index;
+};
+
+/* Order replacements the way `replace-buffer-regions' applies them:
+   from the end of the buffer backwards, so that making a replacement
+   does not change the positions of the ones still to be made.
+   Several insertions at the same position are applied in reverse
+   order, so that their texts end up in the original order.  */
+
+static int
+compare_buffer_edits (void const *a, void const *b)
+{
+  struct buffer_edit const *p = a, *q = b;
+
+  if (p->start != q->start)
+    return p->start < q->start ? 1 : -1;
+  if (p->end != q->end)
+    return p->end < q->end ? 1 : -1;
+  return p->index < q->index ? 1 : -1;
+}
+
+DEFUN ("replace-buffer-regions", Freplace_buffer_regions,
+       Sreplace_buffer_regions, 1, 2, 0,
+       doc: /* Replace several regions of the current buffer at once.
+EDITS is a list of elements (START END TEXT), each of which says to
+replace the text between START and END with the string TEXT.  All
+the positions refer to the buffer as it is before any of the
+replacements.  The regions must not overlap, but several elements can
+insert text at the same position, and then the texts appear in the
+order of the elements in EDITS.
+
+If INHERIT is non-nil, the inserted text inherits text properties as
+with `insert-and-inherit'.  Markers and point are relocated as with
+`replace-match'.
+
+The text of a buffer has to be moved in memory to make a change far
+from the previous one, so making many changes in an arbitrary order
+can take time proportional to their number times the size of the
+buffer.  This function makes the replacements from the end of the
+buffer backwards instead, which moves each part of the text at most
+once.  It is much faster for many replacements in a large buffer.
+
+The change hooks are run for each replacement, and should not modify
+the buffer.  Return nil.  */)
+  (Lisp_Object edits, Lisp_Object inherit)
+{
+  ptrdiff_t n = list_length (edits);
+  Lisp_Object texts = make_nil_vector (n);
+  bool multibyte = !NILP (BVAR (current_buffer, enable_multibyte_characters));
+  struct buffer_edit *v;
+  USE_SAFE_ALLOCA;
+
+  SAFE_NALLOCA (v, 1, n);
+  for (ptrdiff_t i = 0; i < n; i++)
+    {
+      Lisp_Object edit = XCAR (edits);
+      Lisp_Object start = Fcar (edit);
+      Lisp_Object end = Fcar (Fcdr (edit));
+      Lisp_Object text = Fcar (Fcdr (Fcdr (edit)));
+
+      validate_region (&start, &end);
+      CHECK_STRING (text);
+      v[i].start = XFIXNUM (start);
+      v[i].end = XFIXNUM (end);
+      ASET (texts, i, text);
+      v[i].index = i;
+      edits = XCDR (edits);
+    }
+
+  qsort (v, n, sizeof *v, compare_buffer_edits);
+
+  /* Check that no two regions overlap, and find out how much the gap
+     can have to grow while the replacements are made.  Deleted text
+     takes at least one byte per character.  */
+  ptrdiff_t growth = 0, max_growth = 0;
+  for (ptrdiff_t i = 0; i < n; i++)
+    {
+      Lisp_Object text = AREF (texts, v[i].index);
+      if (0 < i && v[i - 1].start < v[i].end)
+	error ("Overlapping regions to replace");
+      ptrdiff_t inserted = (!multibyte ? SCHARS (text)
+			    : STRING_MULTIBYTE (text) ? SBYTES (text)
+			    : count_size_as_multibyte (SDATA (text),
+						       SBYTES (text)));
+      growth += inserted - (v[i].end - v[i].start);
+      max_growth = max (max_growth, growth);
+    }
+
+  /* Make the gap large enough for all the replacements at once, so
+     that the text after it is not moved for each one that grows the
+     buffer.  */
+  if (GAP_SIZE < max_growth)
+    make_gap (max_growth - GAP_SIZE);
+
+  for (ptrdiff_t i = 0; i < n; i++)
+    replace_range (v[i].start, v[i].end, AREF (texts, v[i].index), true,
+		   !NILP (inherit), true, false);
+
+  SAFE_FREE ();
+  return Qnil;
+}
+
 DEFUN ("widen", Fwiden, Swiden, 0, 0, "",
        doc: /* Remove restrictions (narrowing) from current buffer.
 This allows the buffer's full text to be seen and edited.  */)
@@ -2766,21 +2849,26 @@ save_restriction_restore (Lisp_Object data)
       eassert (buf == end->buffer);
 
       if (buf /* Verify marker still points to a buffer.  */
-	  && (beg->charpos != BUF_BEGV (buf) || end->charpos != BUF_ZV (buf)))
+	  && (marker_charpos (beg) != BUF_BEGV (buf)
+	      || marker_charpos (end) != BUF_ZV (buf)))
 	/* The restriction has changed from the saved one, so restore
 	   the saved restriction.  */
 	{
 	  ptrdiff_t pt = BUF_PT (buf);
+	  ptrdiff_t beg_charpos = marker_charpos (beg);
+	  ptrdiff_t beg_bytepos = marker_bytepos (beg);
+	  ptrdiff_t end_charpos = marker_charpos (end);
+	  ptrdiff_t end_bytepos = marker_bytepos (end);
 
-	  SET_BUF_BEGV_BOTH (buf, beg->charpos, beg->bytepos);
-	  SET_BUF_ZV_BOTH (buf, end->charpos, end->bytepos);
+	  SET_BUF_BEGV_BOTH (buf, beg_charpos, beg_bytepos);
+	  SET_BUF_ZV_BOTH (buf, end_charpos, end_bytepos);
 
-	  if (pt < beg->charpos || pt > end->charpos)
+	  if (pt < beg_charpos || pt > end_charpos)
 	    /* The point is outside the new visible range, move it inside. */
 	    SET_BUF_PT_BOTH (buf,
-			     clip_to_bounds (beg->charpos, pt, end->charpos),
-			     clip_to_bounds (beg->bytepos, BUF_PT_BYTE (buf),
-					     end->bytepos));
+			     clip_to_bounds (beg_charpos, pt, end_charpos),
+			     clip_to_bounds (beg_bytepos, BUF_PT_BYTE (buf),
+					     end_bytepos));
 
 	  buf->clip_changed = 1; /* Remember that the narrowing changed. */
 	}
@@ -4113,6 +4201,8 @@ transpose_markers (ptrdiff_t start1, ptrdiff_t end1,
   amt1_byte = (end2_byte - start2_byte) + (start2_byte - end1_byte);
   amt2_byte = (end1_byte - start1_byte) + (start2_byte - end1_byte);
 
+  /* This reorders the markers, so the marker index must go.  */
+  free_marker_index (current_buffer);
   for (marker = BUF_MARKERS (current_buffer); marker; marker = marker->next)
     {
       mpos = marker->bytepos;
@@ -4435,6 +4525,8 @@ DEFUN ("transpose-regions", Ftranspose_regions, Stranspose_regions, 4, 5,
       update_compositions (end2 - len1, end2, CHECK_BORDER);
     }
 
+  forget_charpos_checkpoints (current_buffer, start1_byte, end2_byte);
+
   /* When doing multiple transpositions, it might be nice
      to optimize this.  Perhaps the markers in any one buffer
      should be organized in some sorted data tree.  */
@@ -4609,6 +4701,7 @@ syms_of_editfns (void)
   defsubr (&Stranslate_region_internal);
   defsubr (&Sdelete_region);
   defsubr (&Sdelete_and_extract_region);
+  defsubr (&Sreplace_buffer_regions);
   defsubr (&Swiden);
   defsubr (&Snarrow_to_region);
   defsubr (&Ssave_restriction);
@@ -3517,7 +3517,6 @@ decide_coding_unwind (Lisp_Object unwind_data)
      So move markers that set-auto-coding might have created to BEG,
      just in case.  */
   adjust_markers_for_delete (BEG, BEG_BYTE, Z, Z_BYTE);
-  adjust_overlays_for_delete (BEG, Z - BEG);
   set_buffer_intervals (current_buffer, NULL);
   TEMP_SET_PT_BOTH (BEG, BEG_BYTE);
 
@@ -3733,7 +3732,7 @@ because (1) it preserves some marker positions and (2) it puts less data
   /* If the undo log only contains the insertion, there's no point
      keeping it.  It's typically when we first fill a file-buffer.  */
   bool empty_undo_list_p
-    = (!NILP (visit) && NILP (BVAR (current_buffer, undo_list))
+    = (!NILP (visit) && NILP (buffer_undo_list (current_buffer))
        && BEG == Z);
   Lisp_Object old_Vdeactivate_mark = Vdeactivate_mark;
   bool we_locked_file = false;
@@ -3953,8 +3952,7 @@ because (1) it preserves some marker positions and (2) it puts less data
 		  bset_read_only (buf, Qnil);
 		  bset_filename (buf, Qnil);
 		  bset_undo_list (buf, Qt);
-		  eassert (buf->overlays_before == NULL);
-		  eassert (buf->overlays_after == NULL);
+		  eassert (buf->overlays == NULL);
 
 		  set_buffer_internal (buf);
 		  Ferase_buffer ();
@@ -4387,9 +4385,38 @@ because (1) it preserves some marker positions and (2) it puts less data
       prepare_to_modify_buffer (PT, PT, NULL);
     }
 
-  move_gap_both (PT, PT_BYTE);
-  if (GAP_SIZE < total)
-    make_gap (total - GAP_SIZE);
+  /* A large file that goes verbatim into an empty buffer can be
+     mapped into memory rather than read, so that only the parts of it
+     that are looked at are ever read.  */
+  bool mapped = false;
+  if (! not_regular && beg_offset == 0 && NILP (replace)
+      && NILP (coding_system) && BEG == Z
+      && FIXNATP (Vlarge_file_map_threshold)
+      && XFIXNAT (Vlarge_file_map_threshold) <= total && 0 < total
+      && !NILP (Vcoding_system_for_read)
+      && !NILP (Fcoding_system_p (Vcoding_system_for_read)))
+    {
+      struct coding_system map_coding;
+      bool multibyte
+	= !NILP (BVAR (current_buffer, enable_multibyte_characters));
+
+      /* Set up the coding system as the code after `notfound' will,
+	 to see whether it will decode the text.  */
+      setup_coding_system (multibyte ? Vcoding_system_for_read
+			   : raw_text_coding_system (Vcoding_system_for_read),
+			   &map_coding);
+      map_coding.dst_multibyte
+	= multibyte && ! (!NILP (visit) && CODING_FOR_UNIBYTE (&map_coding));
+      mapped = (! CODING_MAY_REQUIRE_DECODING (&map_coding)
+		&& map_buffer_text (current_buffer, fd, total));
+    }
+
+  if (!mapped)
+    {
+      move_gap_both (PT, PT_BYTE);
+      if (GAP_SIZE < total)
+	make_gap (total - GAP_SIZE);
+    }
 
   if (beg_offset != 0 || !NILP (replace))
     {
@@ -4400,11 +4427,11 @@ because (1) it preserves some marker positions and (2) it puts less data
   /* In the following loop, HOW_MUCH contains the total bytes read so
      far for a regular file, and not changed for a special file.  But,
      before exiting the loop, it is set to a negative value if I/O
-     error occurs.  */
-  how_much = 0;
+     error occurs.  A mapped file has been read in full.  */
+  how_much = mapped ? total : 0;
 
   /* Total bytes inserted.  */
-  inserted = 0;
+  inserted = how_much;
 
   /* Here, we don't do code conversion in the loop.  It is done by
      decode_coding_gap after all data are read into the buffer.  */
@@ -4517,7 +4544,7 @@ because (1) it preserves some marker positions and (2) it puts less data
             = BVAR (current_buffer, enable_multibyte_characters);
           Lisp_Object unwind_data
             = Fcons (multibyte,
-                     Fcons (BVAR (current_buffer, undo_list),
+                     Fcons (buffer_undo_list (current_buffer),
 			    Fcurrent_buffer ()));
 	  ptrdiff_t count1 = SPECPDL_INDEX ();
 
@@ -4628,7 +4655,10 @@ because (1) it preserves some marker positions and (2) it puts less data
   if (!NILP (visit))
     {
       if (empty_undo_list_p)
-	bset_undo_list (current_buffer, Qnil);
+	{
+	  discard_undo_log (current_buffer);
+	  bset_undo_list (current_buffer, Qnil);
+	}
 
       if (NILP (handler))
 	{
@@ -4676,7 +4706,7 @@ because (1) it preserves some marker positions and (2) it puts less data
       specbind (Qinhibit_modification_hooks, Qt);
 
       /* Save old undo list and don't record undo for decoding.  */
-      old_undo = BVAR (current_buffer, undo_list);
+      old_undo = buffer_undo_list (current_buffer);
       bset_undo_list (current_buffer, Qt);
 
       if (NILP (replace))
@@ -5112,6 +5142,12 @@ write_region (Lisp_Object start, Lisp_Object end, Lisp_Object filename,
       file_locked = 1;
     }
 
+  /* Text mapped from a file is read from the file while it is
+     written, and truncating the file would take the text away if it
+     is the same file.  Copy the text to ordinary storage first.  */
+  if (!STRINGP (start) && current_buffer->text->mapped_size)
+    enlarge_buffer_text (current_buffer, 0);
+
   encoded_filename = ENCODE_FILE (filename);
   fn = SSDATA (encoded_filename);
   open_flags = O_WRONLY | O_CREAT;
@@ -6376,6 +6412,26 @@ do (file-exists-p FILENAME) and FILENAME is handled by HANDLER, then
 file is usually more useful if it contains the deleted text.  */);
   Vauto_save_include_big_deletions = Qnil;
 
+  DEFVAR_LISP ("large-file-map-threshold", Vlarge_file_map_threshold,
+	       doc: /* Size in bytes from which files are mapped rather than read.
+When `insert-file-contents' inserts at least this many bytes of a file
+into an empty buffer without any conversion, as `find-file-literally'
+and `insert-file-contents-literally' do, it maps the file into memory
+instead of reading it.  The file's contents are then read from disk
+only as they are displayed, searched or otherwise examined, so even a
+very large file is inserted at once, and memory holds only the parts
+of it that were looked at recently.  The first change to the buffer
+text copies the whole text to ordinary memory.
+
+The mapping is private only to the changes Emacs makes: until the
+buffer is changed, the parts of the file that another program rewrites
+in place may show up in the buffer, and if the file is truncated, the
+part of the buffer beyond its new end reads as null bytes.  So a
+mapped file should only grow while it is visited.  Writing the buffer
+copies its text to ordinary memory first, so that it can be saved back
+to the same file.  A value of nil means never map files.  */);
+  Vlarge_file_map_threshold = make_fixnum (16 * 1024 * 1024);
+
   DEFVAR_BOOL ("write-region-inhibit-fsync", write_region_inhibit_fsync,
 	       doc: /* Non-nil means don't call fsync in `write-region'.
 This variable affects calls to `write-region' as well as save commands.
@@ -22,10 +22,17 @@ Copyright (C) 1985-1987, 1993-1995, 1997-2019 Free Software Foundation,
 
 #include <stdlib.h>
 #include <unistd.h>
+#include <byteswap.h>
+#include <count-trailing-zeros.h>
 #include <filevercmp.h>
 #include <intprops.h>
 #include <vla.h>
 #include <errno.h>
+#include <fcntl.h>
+
+#ifdef __SSE2__
+# include <emmintrin.h>
+#endif
 
 #include "lisp.h"
 #include "bignum.h"
@@ -42,8 +49,6 @@ Copyright (C) 1985-1987, 1993-1995, 1997-2019 Free Software Foundation,
 # define gnutls_rnd w32_gnutls_rnd
 #endif
 
-static void sort_vector_copy (Lisp_Object, ptrdiff_t,
-			      Lisp_Object *restrict, Lisp_Object *restrict);
 enum equal_kind { EQUAL_NO_QUIT, EQUAL_PLAIN, EQUAL_INCLUDING_PROPERTIES };
 static bool internal_equal (Lisp_Object, Lisp_Object,
 			    enum equal_kind, int, Lisp_Object);
@@ -177,6 +182,349 @@ DEFUN ("string-bytes", Fstring_bytes, Sstring_bytes, 1, 1, 0,
   return make_fixnum (SBYTES (string));
 }
 
+/* Levenshtein distances are computed with the bit-parallel algorithm
+   of G. Myers, "A fast bit-vector algorithm for approximate string
+   matching based on dynamic programming", J. ACM 46 (1999), in the
+   form that H. Hyyro gives for the edit distance.  The characters of
+   one string, the pattern, are the rows of the dynamic programming
+   matrix.  A column of the matrix is represented by the differences
+   between vertically adjacent cells, as bit vectors of words of 64
+   rows each, and the characters of the other string, the text, each
+   advance the column by a few word operations per word.  */
+
+/* The number of rows in a word.  */
+enum { STRING_DISTANCE_WORD_BITS = 64 };
+
+/* Patterns of at most this many characters need no heap storage.  */
+enum { STRING_DISTANCE_SMALL = STRING_DISTANCE_WORD_BITS };
+
+/* A character of a pattern that is not below 256, and the row of the
+   pattern's masks for it.  */
+struct string_distance_char
+{
+  int c;
+  int row;
+};
+
+struct string_distance_pattern
+{
+  /* The number of characters in the pattern, and the number of words
+     needed for a bit vector of that many rows.  */
+  ptrdiff_t length, nwords;
+
+  /* True if characters are the bytes of the strings' internal
+     representation.  */
+  bool bytes;
+
+  /* The characters of the pattern.  */
+  int *chars;
+
+  /* The row of MASKS for each character below 256.  */
+  unsigned short byte_row[256];
+
+  /* The rows of MASKS for the other characters of the pattern, sorted
+     by character.  */
+  struct string_distance_char *others;
+  ptrdiff_t nothers;
+
+  /* Rows of NWORDS words each.  Bit I of row R is set if character I
+     of the pattern is the character of row R.  Row 0 is for the
+     characters not in the pattern and is all zeros.  MASKS is null if
+     the rows would take too much memory, and then COLUMN is the column
+     of the plain dynamic programming algorithm instead.  */
+  uint64_t *masks;
+  ptrdiff_t *column;
+
+  /* The vertical differences of the current column: PV has the bits
+     of the rows that are one more than the row above them, and MV
+     those that are one less.  */
+  uint64_t *pv, *mv;
+
+  /* Storage for small patterns.  */
+  int small_chars[STRING_DISTANCE_SMALL];
+  struct string_distance_char small_others[STRING_DISTANCE_SMALL];
+  uint64_t small_words[STRING_DISTANCE_SMALL + 3];
+};
+
+static int
+compare_string_distance_chars (void const *a, void const *b)
+{
+  int ca = ((struct string_distance_char const *) a)->c;
+  int cb = ((struct string_distance_char const *) b)->c;
+  return (ca > cb) - (ca < cb);
+}
+
+/* Return a heap-allocated array of N elements of SIZE bytes each, to
+   be freed when unwinding.  */
+
+static void *
+string_distance_alloc (ptrdiff_t n, ptrdiff_t size)
+{
+  void *p = xnmalloc (n, size);
+  record_unwind_protect_ptr (xfree, p);
+  return p;
+}
+
+/* Set up P for computing distances from STRING, comparing bytes if
+   BYTES, else characters.  Memory that P needs on the heap is freed
+   when unwinding.  */
+
+static void
+string_distance_pattern_init (struct string_distance_pattern *p,
+			      Lisp_Object string, bool bytes)
+{
+  ptrdiff_t m = bytes ? SBYTES (string) : SCHARS (string);
+  ptrdiff_t nwords = (m + STRING_DISTANCE_WORD_BITS - 1)
+		     / STRING_DISTANCE_WORD_BITS;
+  bool small = m <= STRING_DISTANCE_SMALL;
+
+  p->length = m;
+  p->nwords = nwords;
+  p->bytes = bytes;
+  p->chars = small ? p->small_chars : string_distance_alloc (m, sizeof (int));
+  p->others = (small ? p->small_others
+	       : string_distance_alloc (m, sizeof *p->others));
+
+  if (bytes || SCHARS (string) == SBYTES (string))
+    for (ptrdiff_t i = 0; i < m; i++)
+      p->chars[i] = SREF (string, i);
+  else
+    {
+      ptrdiff_t i = 0, i_byte = 0;
+      for (ptrdiff_t k = 0; k < m; k++)
+	FETCH_STRING_CHAR_ADVANCE (p->chars[k], string, i, i_byte);
+    }
+
+  /* Give each distinct character of the pattern a row.  */
+
+  int nrows = 1;
+  ptrdiff_t nothers = 0;
+  memset (p->byte_row, 0, sizeof p->byte_row);
+  for (ptrdiff_t k = 0; k < m; k++)
+    {
+      int c = p->chars[k];
+      if (c < 256)
+	{
+	  if (!p->byte_row[c])
+	    p->byte_row[c] = nrows++;
+	}
+      else
+	p->others[nothers++].c = c;
+    }
+  if (nothers != 0)
+    {
+      qsort (p->others, nothers, sizeof *p->others,
+	     compare_string_distance_chars);
+      ptrdiff_t n = 0;
+      for (ptrdiff_t k = 0; k < nothers; k++)
+	if (n == 0 || p->others[k].c != p->others[n - 1].c)
+	  {
+	    p->others[n].c = p->others[k].c;
+	    p->others[n++].row = nrows++;
+	  }
+      nothers = n;
+    }
+  p->nothers = nothers;
+
+  /* With many distinct characters, the rows would take much more
+     memory than the pattern; fall back on the plain algorithm.  */
+
+  if (!small && nrows * nwords > 4 * m)
+    {
+      p->masks = p->pv = p->mv = NULL;
+      p->column = string_distance_alloc (m + 1, sizeof *p->column);
+      return;
+    }
+
+  uint64_t *words = (small ? p->small_words
+		     : string_distance_alloc (nrows + 2,
+					      nwords * sizeof *words));
+  memset (words, 0, nrows * nwords * sizeof *words);
+  p->masks = words;
+  p->column = NULL;
+  p->pv = words + nrows * nwords;
+  p->mv = p->pv + nwords;
+  for (ptrdiff_t k = 0; k < m; k++)
+    {
+      int c = p->chars[k];
+      int row;
+      if (c < 256)
+	row = p->byte_row[c];
+      else
+	{
+	  struct string_distance_char key = { .c = c };
+	  struct string_distance_char *found
+	    = bsearch (&key, p->others, nothers, sizeof key,
+		       compare_string_distance_chars);
+	  /* Every character of the pattern has a row.  */
+	  eassume (found);
+	  row = found->row;
+	}
+      p->masks[row * nwords + k / STRING_DISTANCE_WORD_BITS]
+	|= (uint64_t) 1 << k % STRING_DISTANCE_WORD_BITS;
+    }
+}
+
+/* Return the row of P's masks for the character C.  */
+
+static uint64_t const *
+string_distance_row (struct string_distance_pattern const *p, int c)
+{
+  int row = 0;
+
+  if (c < 256)
+    row = p->byte_row[c];
+  else
+    {
+      ptrdiff_t lo = 0, hi = p->nothers;
+      while (lo < hi)
+	{
+	  ptrdiff_t mid = lo + (hi - lo) / 2;
+	  if (p->others[mid].c < c)
+	    lo = mid + 1;
+	  else
+	    hi = mid;
+	}
+      if (lo < p->nothers && p->others[lo].c == c)
+	row = p->others[lo].row;
+    }
+  return p->masks + row * p->nwords;
+}
+
+/* Return the Levenshtein distance between the pattern P and TEXT, or
+   LIMIT + 1 if the distance is greater than LIMIT.  LIMIT must be
+   less than PTRDIFF_MAX.  */
+
+static ptrdiff_t
+string_distance_1 (struct string_distance_pattern *p, Lisp_Object text,
+		   ptrdiff_t limit)
+{
+  ptrdiff_t m = p->length;
+  ptrdiff_t n = p->bytes ? SBYTES (text) : SCHARS (text);
+  bool text_bytes = p->bytes || SCHARS (text) == SBYTES (text);
+  ptrdiff_t i = 0, i_byte = 0;
+
+  /* The distance is at least the difference in length.  */
+  if (eabs (m - n) > limit)
+    return limit + 1;
+  if (m == 0)
+    return n;
+
+  if (!p->masks)
+    {
+      /* The plain algorithm, with the pattern as the rows too.  */
+      ptrdiff_t *column = p->column;
+      int const *chars = p->chars;
+
+      for (ptrdiff_t y = 0; y <= m; y++)
+	column[y] = y;
+      for (ptrdiff_t x = 1; x <= n; x++)
+	{
+	  int c;
+	  if (text_bytes)
+	    c = SREF (text, x - 1);
+	  else
+	    FETCH_STRING_CHAR_ADVANCE (c, text, i, i_byte);
+
+	  ptrdiff_t lastdiag = x - 1, colmin = x;
+	  column[0] = x;
+	  for (ptrdiff_t y = 1; y <= m; y++)
+	    {
+	      ptrdiff_t olddiag = column[y];
+	      column[y] = min (min (column[y] + 1, column[y - 1] + 1),
+			       lastdiag + (chars[y - 1] != c));
+	      lastdiag = olddiag;
+	      colmin = min (colmin, column[y]);
+	    }
+
+	  /* Every path to the last cell crosses this column.  */
+	  if (colmin > limit)
+	    return limit + 1;
+	}
+      return column[m];
+    }
+
+  ptrdiff_t nwords = p->nwords;
+  uint64_t *pv = p->pv, *mv = p->mv;
+  uint64_t last_bit
+    = (uint64_t) 1 << (m - 1) % STRING_DISTANCE_WORD_BITS;
+  uint64_t high_bit = (uint64_t) 1 << (STRING_DISTANCE_WORD_BITS - 1);
+  ptrdiff_t score = m;
+
+  if (nwords == 1 && text_bytes)
+    {
+      /* The common case of a short pattern and ASCII or unibyte text,
+	 with the column in registers.  */
+      uint64_t pv0 = -1, mv0 = 0;
+      unsigned char const *t = SDATA (text);
+      for (ptrdiff_t x = 0; x < n; x++)
+	{
+	  uint64_t eq = p->masks[p->byte_row[t[x]]];
+	  uint64_t xv = eq | mv0;
+	  uint64_t xh = (((eq & pv0) + pv0) ^ pv0) | eq;
+	  uint64_t ph = mv0 | ~(xh | pv0);
+	  uint64_t mh = pv0 & xh;
+	  score += (ph & last_bit) ? 1 : (mh & last_bit) ? -1 : 0;
+	  ph = ph << 1 | 1;
+	  mh <<= 1;
+	  pv0 = mh | ~(xv | ph);
+	  mv0 = ph & xv;
+	  if (score - (n - x - 1) > limit)
+	    return limit + 1;
+	}
+      return score;
+    }
+
+  /* Initially each row is one more than the row above it.  */
+  for (ptrdiff_t w = 0; w < nwords; w++)
+    {
+      pv[w] = -1;
+      mv[w] = 0;
+    }
+
+  for (ptrdiff_t x = 0; x < n; x++)
+    {
+      int c;
+      if (text_bytes)
+	c = SREF (text, x);
+      else
+	FETCH_STRING_CHAR_ADVANCE (c, text, i, i_byte);
+      uint64_t const *eqs = string_distance_row (p, c);
+
+      /* HIN is the horizontal difference entering the current word
+	 from above; in the top row it is always one.  */
+      int hin = 1;
+      for (ptrdiff_t w = 0; w < nwords; w++)
+	{
+	  uint64_t eq = eqs[w], pvw = pv[w], mvw = mv[w];
+	  uint64_t xv = eq | mvw;
+	  if (hin < 0)
+	    eq |= 1;
+	  uint64_t xh = (((eq & pvw) + pvw) ^ pvw) | eq;
+	  uint64_t ph = mvw | ~(xh | pvw);
+	  uint64_t mh = pvw & xh;
+	  uint64_t out_bit = w == nwords - 1 ? last_bit : high_bit;
+	  int hout = (ph & out_bit) ? 1 : (mh & out_bit) ? -1 : 0;
+	  ph <<= 1;
+	  mh <<= 1;
+	  if (hin < 0)
+	    mh |= 1;
+	  else if (hin > 0)
+	    ph |= 1;
+	  pv[w] = mh | ~(xv | ph);
+	  mv[w] = ph & xv;
+	  hin = hout;
+	}
+      score += hin;
+
+      /* The last row changes by at most one per column.  */
+      if (score - (n - x - 1) > limit)
+	return limit + 1;
+    }
+
+  return score;
+}
+
 DEFUN ("string-distance", Fstring_distance, Sstring_distance, 2, 3, 0,
        doc: /* Return Levenshtein distance between STRING1 and STRING2.
 The distance is the number of deletions, insertions, and substitutions
@@ -190,57 +538,73 @@ DEFUN ("string-distance", Fstring_distance, Sstring_distance, 2, 3, 0,
   CHECK_STRING (string1);
   CHECK_STRING (string2);
 
-  bool use_byte_compare =
-    !NILP (bytecompare)
-    || (!STRING_MULTIBYTE (string1) && !STRING_MULTIBYTE (string2));
-  ptrdiff_t len1 = use_byte_compare ? SBYTES (string1) : SCHARS (string1);
-  ptrdiff_t len2 = use_byte_compare ? SBYTES (string2) : SCHARS (string2);
-  ptrdiff_t x, y, lastdiag, olddiag;
+  /* The characters of a unibyte string are its bytes anyway.  */
+  bool bytes = !NILP (bytecompare);
+  ptrdiff_t count = SPECPDL_INDEX ();
+  struct string_distance_pattern p;
 
-  USE_SAFE_ALLOCA;
-  ptrdiff_t *column = SAFE_ALLOCA ((len1 + 1) * sizeof (ptrdiff_t));
-  for (y = 1; y <= len1; y++)
-    column[y] = y;
+  /* The distance is symmetric; the shorter string needs fewer words
+     as the pattern.  */
+  if ((bytes ? SBYTES (string2) < SBYTES (string1)
+       : SCHARS (string2) < SCHARS (string1)))
+    {
+      Lisp_Object tem = string1;
+      string1 = string2;
+      string2 = tem;
+    }
+
+  string_distance_pattern_init (&p, string1, bytes);
+  ptrdiff_t distance = string_distance_1 (&p, string2, PTRDIFF_MAX - 1);
+  return unbind_to (count, make_fixnum (distance));
+}
+
+DEFUN ("string-distances", Fstring_distances, Sstring_distances, 2, 4, 0,
+       doc: /* Return the Levenshtein distances between STRING and CANDIDATES.
+CANDIDATES is a vector or list of strings.  Return a vector whose
+elements are the distances between STRING and the corresponding
+elements of CANDIDATES, as `string-distance' computes them.
+This is faster than calling `string-distance' for each candidate.
 
-  if (use_byte_compare)
+BYTECOMPARE has the same meaning as for `string-distance'.
+
+If LIMIT is non-nil, it should be a natural number.  The element of
+the result for a candidate whose distance from STRING is greater than
+LIMIT is nil instead.  The computation for such a candidate stops as
+soon as it is clear that its distance exceeds LIMIT.  */)
+  (Lisp_Object string, Lisp_Object candidates, Lisp_Object bytecompare,
+   Lisp_Object limit)
+{
+  CHECK_STRING (string);
+  if (!VECTORP (candidates))
     {
-      char *s1 = SSDATA (string1);
-      char *s2 = SSDATA (string2);
+      CHECK_LIST (candidates);
+      candidates = Fvconcat (1, &candidates);
+    }
 
-      for (x = 1; x <= len2; x++)
-        {
-          column[0] = x;
-          for (y = 1, lastdiag = x - 1; y <= len1; y++)
-            {
-              olddiag = column[y];
-              column[y] = min (min (column[y] + 1, column[y-1] + 1),
-			       lastdiag + (s1[y-1] == s2[x-1] ? 0 : 1));
-              lastdiag = olddiag;
-            }
-        }
+  ptrdiff_t max_distance = PTRDIFF_MAX - 1;
+  if (!NILP (limit))
+    {
+      CHECK_FIXNAT (limit);
+      max_distance = min (XFIXNAT (limit), max_distance);
     }
-  else
+
+  ptrdiff_t count = SPECPDL_INDEX ();
+  ptrdiff_t n = ASIZE (candidates);
+  Lisp_Object result = make_nil_vector (n);
+  struct string_distance_pattern p;
+
+  string_distance_pattern_init (&p, string, !NILP (bytecompare));
+  for (ptrdiff_t i = 0; i < n; i++)
     {
-      int c1, c2;
-      ptrdiff_t i1, i1_byte, i2 = 0, i2_byte = 0;
-      for (x = 1; x <= len2; x++)
-        {
-          column[0] = x;
-          FETCH_STRING_CHAR_ADVANCE (c2, string2, i2, i2_byte);
-          i1 = i1_byte = 0;
-          for (y = 1, lastdiag = x - 1; y <= len1; y++)
-            {
-              olddiag = column[y];
-              FETCH_STRING_CHAR_ADVANCE (c1, string1, i1, i1_byte);
-              column[y] = min (min (column[y] + 1, column[y-1] + 1),
-			       lastdiag + (c1 == c2 ? 0 : 1));
-              lastdiag = olddiag;
-            }
-        }
+      Lisp_Object candidate = AREF (candidates, i);
+      CHECK_STRING (candidate);
+      ptrdiff_t distance = string_distance_1 (&p, candidate, max_distance);
+      if (distance <= max_distance)
+	ASET (result, i, make_fixnum (distance));
+      rarely_quit (i);
     }
 
-  SAFE_FREE ();
-  return make_fixnum (column[len1]);
+  return unbind_to (count, result);
 }
 
 DEFUN ("string-equal", Fstring_equal, Sstring_equal, 2, 2, 0,
@@ -1256,6 +1620,200 @@ DEFUN ("string-to-unibyte", Fstring_to_unibyte, Sstring_to_unibyte,
   return string;
 }
 
+/* Return true if STRING contains only ASCII characters.  */
+
+static bool
+string_ascii_p (Lisp_Object string)
+{
+  if (STRING_MULTIBYTE (string))
+    return SBYTES (string) == SCHARS (string);
+  unsigned char const *p = SDATA (string);
+  for (ptrdiff_t i = 0; i < SBYTES (string); i++)
+    if (!ASCII_CHAR_P (p[i]))
+      return false;
+  return true;
+}
+
+/* Convert the NBYTES bytes of text at SRC to lower case according to
+   the current buffer's case table, storing the result into DST unless
+   DST is null, and return the number of bytes of the result.
+   MULTIBYTE says whether the text is multibyte.  Unlike `downcase',
+   this maps each character to exactly one character, so character
+   positions are the same before and after.  Only ASCII letters are
+   changed in unibyte text.  */
+
+static ptrdiff_t
+fold_case_text (unsigned char const *src, ptrdiff_t nbytes, bool multibyte,
+		unsigned char *dst)
+{
+  unsigned char const *p = src, *end = src + nbytes;
+  unsigned char *q = dst;
+  ptrdiff_t folded_bytes = 0;
+
+  /* Look up ASCII characters, by far the most common, only once.
+     A case table may map them outside ASCII, in which case they take
+     the slow path in multibyte text and stay unchanged otherwise.  */
+  unsigned char ascii_fold[128];
+  bool ascii_to_ascii[128];
+  for (int c = 0; c < 128; c++)
+    {
+      int lc = downcase (c);
+      ascii_to_ascii[c] = ASCII_CHAR_P (lc);
+      ascii_fold[c] = ascii_to_ascii[c] ? lc : c;
+    }
+
+  if (!multibyte)
+    {
+      if (dst)
+	for (; p < end; p++)
+	  *q++ = ASCII_CHAR_P (*p) ? ascii_fold[*p] : *p;
+      return nbytes;
+    }
+
+  while (p < end)
+    {
+      if (ASCII_CHAR_P (*p) && ascii_to_ascii[*p])
+	{
+	  if (dst)
+	    *q++ = ascii_fold[*p];
+	  p++;
+	  folded_bytes++;
+	}
+      else
+	{
+	  int len;
+	  int c = downcase (STRING_CHAR_AND_LENGTH (p, len));
+	  p += len;
+	  if (dst)
+	    {
+	      int clen = CHAR_STRING (c, q);
+	      q += clen;
+	      folded_bytes += clen;
+	    }
+	  else
+	    folded_bytes += CHAR_BYTES (c);
+	}
+    }
+  return folded_bytes;
+}
+
+DEFUN ("string-search", Fstring_search, Sstring_search, 2, 4, 0,
+       doc: /* Search for the string NEEDLE in the string HAYSTACK.
+The return value is the position of the first occurrence of NEEDLE in
+HAYSTACK, or nil if no match was found.
+
+The optional START-POS argument says where to start searching in
+HAYSTACK and defaults to zero (start at the beginning).
+It must be between zero and the length of HAYSTACK, inclusive.
+
+Case is significant unless IGNORE-CASE is non-nil.  In that case
+characters are compared after converting them to lower case using the
+current buffer's case table.  Text properties are ignored, and the
+match data is not changed.  */)
+  (Lisp_Object needle, Lisp_Object haystack, Lisp_Object start_pos,
+   Lisp_Object ignore_case)
+{
+  ptrdiff_t start = 0;
+
+  CHECK_STRING (needle);
+  CHECK_STRING (haystack);
+
+  if (!NILP (start_pos))
+    {
+      CHECK_FIXNUM (start_pos);
+      EMACS_INT pos = XFIXNUM (start_pos);
+      if (pos < 0 || pos > SCHARS (haystack))
+	xsignal1 (Qargs_out_of_range, start_pos);
+      start = pos;
+    }
+
+  /* If NEEDLE is longer than (the remaining part of) HAYSTACK, then
+     we can't have a match.  */
+  if (SCHARS (needle) > SCHARS (haystack) - start)
+    return Qnil;
+
+  bool multibyte = STRING_MULTIBYTE (haystack);
+  ptrdiff_t start_byte = string_char_to_byte (haystack, start);
+  unsigned char const *hay = SDATA (haystack) + start_byte;
+  ptrdiff_t haybytes = SBYTES (haystack) - start_byte;
+  USE_SAFE_ALLOCA;
+
+  if (!NILP (ignore_case))
+    {
+      /* Fold a copy of the part of HAYSTACK to search, outside the
+	 Lisp heap so as not to provoke garbage collection.  */
+      ptrdiff_t folded_bytes = fold_case_text (hay, haybytes, multibyte, NULL);
+      unsigned char *folded = SAFE_ALLOCA (folded_bytes);
+      fold_case_text (hay, haybytes, multibyte, folded);
+      hay = folded;
+      haybytes = folded_bytes;
+
+      ptrdiff_t needle_bytes
+	= fold_case_text (SDATA (needle), SBYTES (needle),
+			  STRING_MULTIBYTE (needle), NULL);
+      Lisp_Object folded_needle
+	= (STRING_MULTIBYTE (needle)
+	   ? make_uninit_multibyte_string (SCHARS (needle), needle_bytes)
+	   : make_uninit_string (needle_bytes));
+      fold_case_text (SDATA (needle), SBYTES (needle),
+		      STRING_MULTIBYTE (needle), SDATA (folded_needle));
+      needle = folded_needle;
+    }
+
+  unsigned char const *res;
+
+  /* The internal representation of multibyte text is
+     self-synchronizing, so a byte match of a whole multibyte NEEDLE
+     always starts at a character boundary.  */
+  if (multibyte == STRING_MULTIBYTE (needle) || string_ascii_p (needle))
+    res = memmem (hay, haybytes, SDATA (needle), SBYTES (needle));
+  else if (multibyte)
+    {
+      /* A unibyte non-ASCII NEEDLE can only match raw bytes.  */
+      Lisp_Object multi_needle = string_to_multibyte (needle);
+      res = memmem (hay, haybytes,
+		    SDATA (multi_needle), SBYTES (multi_needle));
+    }
+  else
+    {
+      /* A multibyte NEEDLE can only occur in a unibyte HAYSTACK if all
+	 its non-ASCII characters are raw bytes.  */
+      unsigned char const *p = SDATA (needle);
+      ptrdiff_t nbytes = SBYTES (needle);
+      bool raw_bytes_only = true;
+      for (ptrdiff_t i = 0; i < nbytes && raw_bytes_only; i++)
+	{
+	  if (CHAR_BYTE8_HEAD_P (p[i]))
+	    i++;
+	  else if (!ASCII_CHAR_P (p[i]))
+	    raw_bytes_only = false;
+	}
+
+      res = NULL;
+      if (raw_bytes_only)
+	{
+	  Lisp_Object uni_needle = Fstring_to_unibyte (needle);
+	  res = memmem (hay, haybytes,
+			SDATA (uni_needle), SBYTES (uni_needle));
+	}
+    }
+
+  Lisp_Object result = Qnil;
+  if (res)
+    {
+      ptrdiff_t offset = res - hay;
+      if (!multibyte)
+	result = make_fixnum (start + offset);
+      else if (NILP (ignore_case))
+	result = make_fixnum (string_byte_to_char (haystack,
+						   start_byte + offset));
+      else
+	result = make_fixnum (start + multibyte_chars_in_text (hay, offset));
+    }
+  SAFE_FREE ();
+  return result;
+}
+
 
 DEFUN ("copy-alist", Fcopy_alist, Scopy_alist, 1, 1, 0,
        doc: /* Return a copy of ALIST.
@@ -1977,20 +2535,39 @@ DEFUN ("reverse", Freverse, Sreverse, 1, 1, 0,
 }
 
 /* Sort LIST using PREDICATE, preserving original order of elements
-   considered as equal.  */
+   considered as equal.  If KEYFUNC is non-nil, compare its results
+   instead of the elements.  The elements are sorted in a temporary
+   vector and then stored back into the cons cells of LIST, in order,
+   so LIST itself becomes the sorted list.  */
 
 static Lisp_Object
-sort_list (Lisp_Object list, Lisp_Object predicate)
+sort_list (Lisp_Object list, Lisp_Object predicate, Lisp_Object keyfunc)
 {
   ptrdiff_t length = list_length (list);
   if (length < 2)
     return list;
 
-  Lisp_Object tem = Fnthcdr (make_fixnum (length / 2 - 1), list);
-  Lisp_Object back = Fcdr (tem);
-  Fsetcdr (tem, Qnil);
+  Lisp_Object *result;
+  USE_SAFE_ALLOCA;
+  SAFE_ALLOCA_LISP (result, length);
+  Lisp_Object tail = list;
+  for (ptrdiff_t i = 0; i < length; i++)
+    {
+      result[i] = XCAR (tail);
+      tail = XCDR (tail);
+    }
+
+  tim_sort (predicate, keyfunc, result, length);
 
-  return merge (Fsort (list, predicate), Fsort (back, predicate), predicate);
+  /* PREDICATE may have shortened LIST in the meantime.  */
+  tail = list;
+  for (ptrdiff_t i = 0; i < length && CONSP (tail); i++)
+    {
+      XSETCAR (tail, result[i]);
+      tail = XCDR (tail);
+    }
+  SAFE_FREE ();
+  return list;
 }
 
 /* Using PRED to compare, return whether A and B are in order.
@@ -2001,110 +2578,49 @@ inorder (Lisp_Object pred, Lisp_Object a, Lisp_Object b)
   return NILP (call2 (pred, b, a));
 }
 
-/* Using PRED to compare, merge from ALEN-length A and BLEN-length B
-   into DEST.  Argument arrays must be nonempty and must not overlap,
-   except that B might be the last part of DEST.  */
-static void
-merge_vectors (Lisp_Object pred,
-	       ptrdiff_t alen, Lisp_Object const a[restrict VLA_ELEMS (alen)],
-	       ptrdiff_t blen, Lisp_Object const b[VLA_ELEMS (blen)],
-	       Lisp_Object dest[VLA_ELEMS (alen + blen)])
-{
-  eassume (0 < alen && 0 < blen);
-  Lisp_Object const *alim = a + alen;
-  Lisp_Object const *blim = b + blen;
-
-  while (true)
-    {
-      if (inorder (pred, a[0], b[0]))
-	{
-	  *dest++ = *a++;
-	  if (a == alim)
-	    {
-	      if (dest != b)
-		memcpy (dest, b, (blim - b) * sizeof *dest);
-	      return;
-	    }
-	}
-      else
-	{
-	  *dest++ = *b++;
-	  if (b == blim)
-	    {
-	      memcpy (dest, a, (alim - a) * sizeof *dest);
-	      return;
-	    }
-	}
-    }
-}
-
-/* Using PRED to compare, sort LEN-length VEC in place, using TMP for
-   temporary storage.  LEN must be at least 2.  */
-static void
-sort_vector_inplace (Lisp_Object pred, ptrdiff_t len,
-		     Lisp_Object vec[restrict VLA_ELEMS (len)],
-		     Lisp_Object tmp[restrict VLA_ELEMS (len >> 1)])
-{
-  eassume (2 <= len);
-  ptrdiff_t halflen = len >> 1;
-  sort_vector_copy (pred, halflen, vec, tmp);
-  if (1 < len - halflen)
-    sort_vector_inplace (pred, len - halflen, vec + halflen, vec);
-  merge_vectors (pred, halflen, tmp, len - halflen, vec + halflen, vec);
-}
-
-/* Using PRED to compare, sort from LEN-length SRC into DST.
-   Len must be positive.  */
-static void
-sort_vector_copy (Lisp_Object pred, ptrdiff_t len,
-		  Lisp_Object src[restrict VLA_ELEMS (len)],
-		  Lisp_Object dest[restrict VLA_ELEMS (len)])
-{
-  eassume (0 < len);
-  ptrdiff_t halflen = len >> 1;
-  if (halflen < 1)
-    dest[0] = src[0];
-  else
-    {
-      if (1 < halflen)
-	sort_vector_inplace (pred, halflen, src, dest);
-      if (1 < len - halflen)
-	sort_vector_inplace (pred, len - halflen, src + halflen, dest);
-      merge_vectors (pred, halflen, src, len - halflen, src + halflen, dest);
-    }
-}
-
 /* Sort VECTOR in place using PREDICATE, preserving original order of
-   elements considered as equal.  */
+   elements considered as equal.  If KEYFUNC is non-nil, compare its
+   results instead of the elements.  */
 
 static void
-sort_vector (Lisp_Object vector, Lisp_Object predicate)
+sort_vector (Lisp_Object vector, Lisp_Object predicate, Lisp_Object keyfunc)
 {
-  ptrdiff_t len = ASIZE (vector);
-  if (len < 2)
-    return;
-  ptrdiff_t halflen = len >> 1;
-  Lisp_Object *tmp;
-  USE_SAFE_ALLOCA;
-  SAFE_ALLOCA_LISP (tmp, halflen);
-  for (ptrdiff_t i = 0; i < halflen; i++)
-    tmp[i] = make_fixnum (0);
-  sort_vector_inplace (predicate, len, XVECTOR (vector)->contents, tmp);
-  SAFE_FREE ();
+  tim_sort (predicate, keyfunc, XVECTOR (vector)->contents, ASIZE (vector));
 }
 
-DEFUN ("sort", Fsort, Ssort, 2, 2, 0,
+DEFUN ("sort", Fsort, Ssort, 2, MANY, 0,
        doc: /* Sort SEQ, stably, comparing elements using PREDICATE.
 Returns the sorted sequence.  SEQ should be a list or vector.  SEQ is
-modified by side effects.  PREDICATE is called with two elements of
-SEQ, and should return non-nil if the first element should sort before
-the second.  */)
-  (Lisp_Object seq, Lisp_Object predicate)
+modified by side effects; when SEQ is a list, its elements are
+rearranged among its existing cons cells, so SEQ itself is sorted
+afterwards.  PREDICATE is called with two elements of SEQ, and should
+return non-nil if the first element should sort before the second.
+
+If the keyword argument :key is given and non-nil, it should be a
+function of one argument.  It is called exactly once on each element
+of SEQ, and PREDICATE then compares the values it returned instead of
+the elements themselves.
+
+Runs of elements that are already in ascending or strictly descending
+order are detected and take advantage of, so sorting nearly sorted
+data is cheap.  Sorting is fastest when PREDICATE is `<', `>' or
+`string<', which are compared without calling them as functions.
+usage: (sort SEQ PREDICATE &key KEY)  */)
+  (ptrdiff_t nargs, Lisp_Object *args)
 {
+  Lisp_Object seq = args[0], predicate = args[1], keyfunc = Qnil;
+
+  for (ptrdiff_t i = 2; i < nargs; i += 2)
+    {
+      if (! (EQ (args[i], QCkey) && i + 1 < nargs))
+	signal_error ("Invalid argument list", args[i]);
+      keyfunc = args[i + 1];
+    }
+
   if (CONSP (seq))
-    seq = sort_list (seq, predicate);
+    seq = sort_list (seq, predicate, keyfunc);
   else if (VECTORP (seq))
-    sort_vector (seq, predicate);
+    sort_vector (seq, predicate, keyfunc);
   else if (!NILP (seq))
     wrong_type_argument (Qlist_or_vector_p, seq);
   return seq;
@@ -2454,7 +2970,8 @@ internal_equal (Lisp_Object o1, Lisp_Object o2, enum equal_kind equal_kind,
 	  {
 	    return (XMARKER (o1)->buffer == XMARKER (o2)->buffer
 		    && (XMARKER (o1)->buffer == 0
-			|| XMARKER (o1)->bytepos == XMARKER (o2)->bytepos));
+			|| (marker_bytepos (XMARKER (o1))
+			    == marker_bytepos (XMARKER (o2)))));
 	  }
 	/* Boolvectors are compared much like strings.  */
 	if (BOOL_VECTOR_P (o1))
@@ -3216,7 +3733,7 @@ #define MIME_LINE_LENGTH 76
 
 /* Tables of base64 values for bytes.  -1 means ignorable, 0 invalid,
    positive means 1 + the represented value.  */
-static signed char const base64_char_to_value[2][UCHAR_MAX] =
+static signed char const base64_char_to_value[2][UCHAR_MAX + 1] =
 {
  /* base64 */
  {
@@ -3273,10 +3790,36 @@ #define MIME_LINE_LENGTH 76
    base64 characters.  */
 
 
+/* The number of input bytes encoded into one line of output.  */
+enum { MIME_LINE_BYTES = MIME_LINE_LENGTH / 4 * 3 };
+
+/* The region commands convert this many characters of the region at a
+   time, so that they need only a bounded amount of temporary storage
+   however large the region is.  This is a whole number of lines of
+   encoder input.  */
+enum { BASE64_REGION_CHUNK = 1024 * MIME_LINE_BYTES };
+
+/* The state of a base64 decoder between two pieces of its input.  */
+struct base64_decode_state
+{
+  /* The bits of the current quadruplet seen so far.  */
+  unsigned int value;
+
+  /* The number of characters of the current quadruplet seen so far.  */
+  int count;
+
+  /* True if the third character of the quadruplet was '=', so that the
+     next significant character must be '=' too.  */
+  bool pad;
+};
+
 static ptrdiff_t base64_encode_1 (const char *, char *, ptrdiff_t, bool, bool,
 				  bool, bool);
 static ptrdiff_t base64_decode_1 (const char *, char *, ptrdiff_t, bool,
-				  bool, ptrdiff_t *);
+				  bool, ptrdiff_t *,
+				  struct base64_decode_state *);
+static bool base64_decode_complete_p (struct base64_decode_state const *,
+				      bool);
 
 Lisp_Object base64_encode_region_1 (Lisp_Object, Lisp_Object, bool,
 				    bool, bool);
@@ -3309,50 +3852,123 @@ DEFUN ("base64url-encode-region", Fbase64url_encode_region, Sbase64url_encode_re
   return base64_encode_region_1(beg, end, false, NILP(no_pad), true);
 }
 
+/* Return true if the NBYTES bytes of multibyte text at P can be
+   base64-encoded, i.e. contain only unibyte and eight-bit
+   characters.  */
+
+static bool
+base64_encodable_p (unsigned char const *p, ptrdiff_t nbytes)
+{
+  unsigned char const *plim = p + nbytes;
+
+  while (p < plim)
+    {
+      if (ASCII_CHAR_P (*p))
+	p++;
+      else
+	{
+	  int len;
+	  int c = STRING_CHAR_AND_LENGTH (p, len);
+	  if (c >= 256 && !CHAR_BYTE8_P (c))
+	    return false;
+	  p += len;
+	}
+    }
+  return true;
+}
+
 Lisp_Object
 base64_encode_region_1 (Lisp_Object beg, Lisp_Object end, bool line_break,
 			bool pad, bool base64url)
 {
   char *encoded;
-  ptrdiff_t allength, length;
-  ptrdiff_t ibeg, iend, encoded_length;
+  ptrdiff_t allength, from, to, from_byte, to_byte;
   ptrdiff_t old_pos = PT;
+  ptrdiff_t encoded_length = 0;
+  bool multibyte = !NILP (BVAR (current_buffer, enable_multibyte_characters));
   USE_SAFE_ALLOCA;
 
   validate_region (&beg, &end);
+  from = XFIXNAT (beg);
+  to = XFIXNAT (end);
 
-  ibeg = CHAR_TO_BYTE (XFIXNAT (beg));
-  iend = CHAR_TO_BYTE (XFIXNAT (end));
-  move_gap_both (XFIXNAT (beg), ibeg);
+  if (from < to)
+    {
+      from_byte = CHAR_TO_BYTE (from);
+      to_byte = CHAR_TO_BYTE (to);
 
-  /* We need to allocate enough room for encoding the text.
-     We need 33 1/3% more space, plus a newline every 76
-     characters, and then we round up. */
-  length = iend - ibeg;
-  allength = length + length/3 + 1;
-  allength += allength / MIME_LINE_LENGTH + 1 + 6;
+      /* Check the whole region before changing anything, so that
+	 the buffer is left alone if the encoding isn't possible.  */
+      if (multibyte && to_byte - from_byte != to - from)
+	{
+	  move_gap_both (from, from_byte);
+	  if (!base64_encodable_p (BYTE_POS_ADDR (from_byte),
+				   to_byte - from_byte))
+	    error ("Multibyte character in data for base64 encoding");
+	}
 
-  encoded = SAFE_ALLOCA (allength);
-  encoded_length = base64_encode_1 ((char *) BYTE_POS_ADDR (ibeg),
-				    encoded, length, line_break,
-				    pad, base64url,
-				    !NILP (BVAR (current_buffer, enable_multibyte_characters)));
-  if (encoded_length > allength)
-    emacs_abort ();
+      prepare_to_modify_buffer (from, to, &from);
+      to = min (from + XFIXNAT (end) - XFIXNAT (beg), ZV);
+      from_byte = CHAR_TO_BYTE (from);
+      to_byte = CHAR_TO_BYTE (to);
+
+      /* We need to allocate enough room for encoding a chunk of the
+	 text.  We need 33 1/3% more space, plus a newline every 76
+	 characters, and then we round up.  */
+      ptrdiff_t chunk_bytes = min (to_byte - from_byte,
+				   (multibyte ? MAX_MULTIBYTE_LENGTH : 1)
+				   * BASE64_REGION_CHUNK);
+      allength = chunk_bytes + chunk_bytes / 3 + 1;
+      allength += allength / MIME_LINE_LENGTH + 1 + 6;
+      encoded = SAFE_ALLOCA (allength);
+
+      /* Replace the region one chunk at a time, right where the gap
+	 is, so that the text never needs to be copied as a whole.
+	 POS is where the text not yet encoded starts and END_POS is
+	 where it ends.  Insert first in order to preserve markers.  */
+      ptrdiff_t pos = from, pos_byte = from_byte;
+      ptrdiff_t end_pos = to, end_pos_byte = to_byte;
+      ptrdiff_t converted = 0;
+      while (pos < end_pos)
+	{
+	  ptrdiff_t chunk_end = min (end_pos, pos + BASE64_REGION_CHUNK);
+	  ptrdiff_t chunk_end_byte = (chunk_end == end_pos ? end_pos_byte
+				      : CHAR_TO_BYTE (chunk_end));
+	  char *e = encoded;
+
+	  /* Every chunk but the last ends on a line boundary.  */
+	  if (line_break && pos != from)
+	    *e++ = '\n';
+	  move_gap_both (pos, pos_byte);
+	  ptrdiff_t n = base64_encode_1 ((char *) BYTE_POS_ADDR (pos_byte), e,
+					 chunk_end_byte - pos_byte, line_break,
+					 pad, base64url, multibyte);
+	  if (n < 0)
+	    {
+	      /* A change hook inserted some text we can't encode.  */
+	      signal_after_change (from, converted, encoded_length);
+	      error ("Multibyte character in data for base64 encoding");
+	    }
+	  n += e - encoded;
+	  if (n > allength)
+	    emacs_abort ();
 
-  if (encoded_length < 0)
-    {
-      /* The encoding wasn't possible. */
+	  TEMP_SET_PT_BOTH (pos, pos_byte);
+	  insert_1_both (encoded, n, n, false, false, false);
+	  del_range_2 (pos + n, pos_byte + n, chunk_end + n,
+		       chunk_end_byte + n, false);
+	  encoded_length += n;
+	  converted += chunk_end - pos;
+	  end_pos += n - (chunk_end - pos);
+	  end_pos_byte += n - (chunk_end_byte - pos_byte);
+	  pos += n;
+	  pos_byte += n;
+	}
       SAFE_FREE ();
-      error ("Multibyte character in data for base64 encoding");
-    }
 
-  /* Now we have encoded the region, so we insert the new contents
-     and delete the old.  (Insert first in order to preserve markers.)  */
-  SET_PT_BOTH (XFIXNAT (beg), ibeg);
-  insert (encoded, encoded_length);
-  SAFE_FREE ();
-  del_range_byte (ibeg + encoded_length, iend + encoded_length);
+      signal_after_change (from, to - from, encoded_length);
+      update_compositions (from, from + encoded_length, CHECK_BORDER);
+    }
 
   /* If point was outside of the region, restore it exactly; else just
      move to the beginning of the region.  */
@@ -3360,7 +3976,7 @@ base64_encode_region_1 (Lisp_Object beg, Lisp_Object end, bool line_break,
     old_pos += encoded_length - (XFIXNAT (end) - XFIXNAT (beg));
   else if (old_pos > XFIXNAT (beg))
     old_pos = XFIXNAT (beg);
-  SET_PT (old_pos);
+  SET_PT (clip_to_bounds (BEGV, old_pos, ZV));
 
   /* We return the length of the encoded text. */
   return make_fixnum (encoded_length);
@@ -3429,105 +4045,108 @@ base64_encode_string_1(Lisp_Object string, bool line_break,
   return encoded_string;
 }
 
-static ptrdiff_t
-base64_encode_1 (const char *from, char *to, ptrdiff_t length,
-		 bool line_break, bool pad, bool base64url,
-		 bool multibyte)
+/* Encode the N bytes at FROM into TO, without line breaks, and
+   return the end of the output.  If PAD, pad the last quadruplet of
+   the output with '='.  */
+
+static char *
+base64_encode_bytes (unsigned char const *from, ptrdiff_t n, char *to,
+		     bool pad, char const *b64_value_to_char)
 {
-  int counter = 0;
-  ptrdiff_t i = 0;
+  unsigned char const *f = from;
+  unsigned char const *flim = from + n;
   char *e = to;
-  int c;
-  unsigned int value;
-  int bytes;
-  char const *b64_value_to_char = base64_value_to_char[base64url];
 
-  while (i < length)
+  /* Process whole triplets.  */
+
+  for (; flim - f >= 3; f += 3)
     {
-      if (multibyte)
-	{
-	  c = STRING_CHAR_AND_LENGTH ((unsigned char *) from + i, bytes);
-	  if (CHAR_BYTE8_P (c))
-	    c = CHAR_TO_BYTE8 (c);
-	  else if (c >= 256)
-	    return -1;
-	  i += bytes;
-	}
-      else
-	c = from[i++];
+      unsigned int value = f[0] << 16 | f[1] << 8 | f[2];
+      e[0] = b64_value_to_char[value >> 18];
+      e[1] = b64_value_to_char[value >> 12 & 0x3f];
+      e[2] = b64_value_to_char[value >> 6 & 0x3f];
+      e[3] = b64_value_to_char[value & 0x3f];
+      e += 4;
+    }
 
-      /* Wrap line every 76 characters.  */
+  /* Process the one or two bytes that are left over, if any.  */
 
-      if (line_break)
-	{
-	  if (counter < MIME_LINE_LENGTH / 4)
-	    counter++;
-	  else
-	    {
-	      *e++ = '\n';
-	      counter = 1;
-	    }
-	}
+  if (f < flim)
+    {
+      unsigned int value = f[0] << 16 | (flim - f == 2 ? f[1] << 8 : 0);
+      *e++ = b64_value_to_char[value >> 18];
+      *e++ = b64_value_to_char[value >> 12 & 0x3f];
+      if (flim - f == 2)
+	*e++ = b64_value_to_char[value >> 6 & 0x3f];
+      else if (pad)
+	*e++ = '=';
+      if (pad)
+	*e++ = '=';
+    }
 
-      /* Process first byte of a triplet.  */
+  return e;
+}
 
-      *e++ = b64_value_to_char[0x3f & c >> 2];
-      value = (0x03 & c) << 4;
+/* Base64-encode the data at FROM of LENGTH bytes into TO, and return
+   the length of the output.  If MULTIBYTE, FROM is in multibyte form;
+   return -1 if it contains a character that is neither unibyte nor
+   eight-bit.  */
 
-      /* Process second byte of a triplet.  */
+static ptrdiff_t
+base64_encode_1 (const char *from, char *to, ptrdiff_t length,
+		 bool line_break, bool pad, bool base64url,
+		 bool multibyte)
+{
+  unsigned char const *f = (unsigned char const *) from;
+  unsigned char const *flim = f + length;
+  char *e = to;
+  char const *b64_value_to_char = base64_value_to_char[base64url];
+  unsigned char line[MIME_LINE_BYTES];
 
-      if (i == length)
-	{
-	  *e++ = b64_value_to_char[value];
-	  if (pad)
-	    {
-	      *e++ = '=';
-	      *e++ = '=';
-	    }
-	  break;
-	}
+  if (!multibyte && !line_break)
+    return base64_encode_bytes (f, length, e, pad, b64_value_to_char) - to;
+
+  /* Encode a line's worth of input at a time.  Multibyte input is
+     first converted to the bytes it represents.  */
 
-      if (multibyte)
+  while (f < flim)
+    {
+      unsigned char const *bytes;
+      ptrdiff_t n;
+
+      if (!multibyte)
 	{
-	  c = STRING_CHAR_AND_LENGTH ((unsigned char *) from + i, bytes);
-	  if (CHAR_BYTE8_P (c))
-	    c = CHAR_TO_BYTE8 (c);
-	  else if (c >= 256)
-	    return -1;
-	  i += bytes;
+	  bytes = f;
+	  n = min (flim - f, MIME_LINE_BYTES);
+	  f += n;
 	}
       else
-	c = from[i++];
-
-      *e++ = b64_value_to_char[value | (0x0f & c >> 4)];
-      value = (0x0f & c) << 2;
-
-      /* Process third byte of a triplet.  */
-
-      if (i == length)
 	{
-	  *e++ = b64_value_to_char[value];
-	  if (pad)
+	  for (n = 0; n < MIME_LINE_BYTES && f < flim; n++)
 	    {
-	      *e++ = '=';
+	      int c = *f;
+	      if (ASCII_CHAR_P (c))
+		f++;
+	      else
+		{
+		  int len;
+		  c = STRING_CHAR_AND_LENGTH (f, len);
+		  if (CHAR_BYTE8_P (c))
+		    c = CHAR_TO_BYTE8 (c);
+		  else if (c >= 256)
+		    return -1;
+		  f += len;
+		}
+	      line[n] = c;
 	    }
-	  break;
+	  bytes = line;
 	}
 
-      if (multibyte)
-	{
-	  c = STRING_CHAR_AND_LENGTH ((unsigned char *) from + i, bytes);
-	  if (CHAR_BYTE8_P (c))
-	    c = CHAR_TO_BYTE8 (c);
-	  else if (c >= 256)
-	    return -1;
-	  i += bytes;
-	}
-      else
-	c = from[i++];
+      /* Wrap line every 76 characters.  */
 
-      *e++ = b64_value_to_char[value | (0x03 & c >> 6)];
-      *e++ = b64_value_to_char[0x3f & c];
+      if (line_break && e != to)
+	*e++ = '\n';
+      e = base64_encode_bytes (bytes, n, e, pad, b64_value_to_char);
     }
 
   return e - to;
@@ -3543,50 +4162,97 @@ DEFUN ("base64-decode-region", Fbase64_decode_region, Sbase64_decode_region,
 of the base 64 encoding, as defined in RFC 4648.  */)
      (Lisp_Object beg, Lisp_Object end, Lisp_Object base64url)
 {
-  ptrdiff_t ibeg, iend, length, allength;
+  ptrdiff_t from, to, from_byte, to_byte, allength;
   char *decoded;
   ptrdiff_t old_pos = PT;
-  ptrdiff_t decoded_length;
-  ptrdiff_t inserted_chars;
+  ptrdiff_t inserted_chars = 0;
   bool multibyte = !NILP (BVAR (current_buffer, enable_multibyte_characters));
+  bool url = !NILP (base64url);
+  struct base64_decode_state state = { 0 };
   USE_SAFE_ALLOCA;
 
   validate_region (&beg, &end);
+  from = XFIXNAT (beg);
+  to = XFIXNAT (end);
 
-  ibeg = CHAR_TO_BYTE (XFIXNAT (beg));
-  iend = CHAR_TO_BYTE (XFIXNAT (end));
-
-  length = iend - ibeg;
-
-  /* We need to allocate enough room for decoding the text.  If we are
-     working on a multibyte buffer, each decoded code may occupy at
-     most two bytes.  */
-  allength = multibyte ? length * 2 : length;
-  decoded = SAFE_ALLOCA (allength);
-
-  move_gap_both (XFIXNAT (beg), ibeg);
-  decoded_length = base64_decode_1 ((char *) BYTE_POS_ADDR (ibeg),
-				    decoded, length, !NILP (base64url),
-				    multibyte, &inserted_chars);
-  if (decoded_length > allength)
-    emacs_abort ();
-
-  if (decoded_length < 0)
+  if (from < to)
     {
-      /* The decoding wasn't possible. */
-      error ("Invalid base64 data");
-    }
+      from_byte = CHAR_TO_BYTE (from);
+      to_byte = CHAR_TO_BYTE (to);
+
+      /* We need to allocate enough room for decoding a chunk of the
+	 text.  If we are working on a multibyte buffer, each decoded
+	 code may occupy at most two bytes.  */
+      ptrdiff_t chunk = min (to_byte - from_byte, BASE64_REGION_CHUNK);
+      allength = multibyte ? chunk * 2 : chunk;
+      decoded = SAFE_ALLOCA (allength);
+
+      /* Decode the whole region once without keeping the result, so
+	 that the buffer is left alone if the decoding isn't possible.  */
+      move_gap_both (from, from_byte);
+      for (ptrdiff_t b = from_byte; b < to_byte; b += chunk)
+	{
+	  ptrdiff_t nchars;
+	  if (base64_decode_1 ((char *) BYTE_POS_ADDR (b), decoded,
+			       min (to_byte - b, chunk), url,
+			       false, &nchars, &state)
+	      < 0)
+	    error ("Invalid base64 data");
+	}
+      if (!base64_decode_complete_p (&state, url))
+	error ("Invalid base64 data");
+      state = (struct base64_decode_state) { 0 };
+
+      prepare_to_modify_buffer (from, to, &from);
+      to = min (from + XFIXNAT (end) - XFIXNAT (beg), ZV);
+      from_byte = CHAR_TO_BYTE (from);
+      to_byte = CHAR_TO_BYTE (to);
+
+      /* Now replace the region one chunk at a time, right where the
+	 gap is, as base64_encode_region_1 does.  Valid base64 text
+	 is ASCII, so that the chunks fit into DECODED.  */
+      ptrdiff_t pos = from, pos_byte = from_byte;
+      ptrdiff_t end_pos = to, end_pos_byte = to_byte;
+      ptrdiff_t converted = 0;
+      bool ok = true;
+      while (pos < end_pos)
+	{
+	  ptrdiff_t chunk_end = min (end_pos, pos + chunk);
+	  ptrdiff_t chunk_end_byte = (chunk_end == end_pos ? end_pos_byte
+				      : CHAR_TO_BYTE (chunk_end));
+	  ptrdiff_t nchars;
+
+	  move_gap_both (pos, pos_byte);
+	  ptrdiff_t n = base64_decode_1 ((char *) BYTE_POS_ADDR (pos_byte),
+					 decoded, chunk_end_byte - pos_byte,
+					 url, multibyte, &nchars, &state);
+	  if (n < 0)
+	    {
+	      /* A change hook inserted some invalid text.  */
+	      ok = false;
+	      break;
+	    }
+	  if (n > allength)
+	    emacs_abort ();
 
-  /* Now we have decoded the region, so we insert the new contents
-     and delete the old.  (Insert first in order to preserve markers.)  */
-  TEMP_SET_PT_BOTH (XFIXNAT (beg), ibeg);
-  insert_1_both (decoded, inserted_chars, decoded_length, 0, 1, 0);
-  signal_after_change (XFIXNAT (beg), 0, inserted_chars);
-  SAFE_FREE ();
+	  TEMP_SET_PT_BOTH (pos, pos_byte);
+	  insert_1_both (decoded, nchars, n, false, false, false);
+	  del_range_2 (pos + nchars, pos_byte + n, chunk_end + nchars,
+		       chunk_end_byte + n, false);
+	  inserted_chars += nchars;
+	  converted += chunk_end - pos;
+	  end_pos += nchars - (chunk_end - pos);
+	  end_pos_byte += n - (chunk_end_byte - pos_byte);
+	  pos += nchars;
+	  pos_byte += n;
+	}
+      SAFE_FREE ();
 
-  /* Delete the original text.  */
-  del_range_both (PT, PT_BYTE, XFIXNAT (end) + inserted_chars,
-		  iend + decoded_length, 1);
+      signal_after_change (from, converted, inserted_chars);
+      update_compositions (from, from + inserted_chars, CHECK_BORDER);
+      if (! (ok && base64_decode_complete_p (&state, url)))
+	error ("Invalid base64 data");
+    }
 
   /* If point was outside of the region, restore it exactly; else just
      move to the beginning of the region.  */
@@ -3594,7 +4260,7 @@ DEFUN ("base64-decode-region", Fbase64_decode_region, Sbase64_decode_region,
     old_pos += inserted_chars - (XFIXNAT (end) - XFIXNAT (beg));
   else if (old_pos > XFIXNAT (beg))
     old_pos = XFIXNAT (beg);
-  SET_PT (old_pos > ZV ? ZV : old_pos);
+  SET_PT (clip_to_bounds (BEGV, old_pos, ZV));
 
   return make_fixnum (inserted_chars);
 }
@@ -3620,7 +4286,8 @@ DEFUN ("base64-decode-string", Fbase64_decode_string, Sbase64_decode_string,
   /* The decoded result should be unibyte. */
   ptrdiff_t decoded_chars;
   decoded_length = base64_decode_1 (SSDATA (string), decoded, length,
-				    !NILP (base64url), 0, &decoded_chars);
+				    !NILP (base64url), 0, &decoded_chars,
+				    NULL);
   if (decoded_length > length)
     emacs_abort ();
   else if (decoded_length >= 0)
@@ -3635,139 +4302,146 @@ DEFUN ("base64-decode-string", Fbase64_decode_string, Sbase64_decode_string,
   return decoded_string;
 }
 
+/* Store the byte C into E, in multibyte form if MULTIBYTE_BIT is
+   nonzero.  Return the end of the output.  */
+
+static char *
+base64_put_byte (char *e, unsigned char c, unsigned char multibyte_bit)
+{
+  if (c & multibyte_bit)
+    return e + BYTE8_STRING (c, e);
+  *e = c;
+  return e + 1;
+}
+
 /* Base64-decode the data at FROM of LENGTH bytes into TO.  If
    MULTIBYTE, the decoded result should be in multibyte
-   form.  Store the number of produced characters in *NCHARS_RETURN.  */
+   form.  Store the number of produced characters in *NCHARS_RETURN.
+   Return the number of produced bytes, or -1 if the data is invalid.
+
+   If STATE is null, the data must be complete.  Otherwise it is just
+   a piece of the data, and STATE holds the state of the decoder
+   before and after the piece; use base64_decode_complete_p to find
+   out whether the data was complete after its last piece.  */
 
 static ptrdiff_t
 base64_decode_1 (const char *from, char *to, ptrdiff_t length,
-		 bool base64url,
-		 bool multibyte, ptrdiff_t *nchars_return)
+		 bool base64url, bool multibyte, ptrdiff_t *nchars_return,
+		 struct base64_decode_state *state)
 {
-  char const *f = from;
-  char const *flim = from + length;
+  unsigned char const *f = (unsigned char const *) from;
+  unsigned char const *flim = f + length;
   char *e = to;
   ptrdiff_t nchars = 0;
   signed char const *b64_char_to_value = base64_char_to_value[base64url];
   unsigned char multibyte_bit = multibyte << 7;
+  struct base64_decode_state st = { 0 };
+
+  if (state)
+    st = *state;
 
   while (true)
     {
-      unsigned char c;
-      int v1;
-
-      /* Process first byte of a quadruplet. */
+      /* At the start of a quadruplet, decode whole quadruplets at a
+	 time for as long as there is nothing to skip or check.  */
 
-      do
-	{
-	  if (f == flim)
-	    {
-	      *nchars_return = nchars;
-	      return e - to;
-	    }
-	  c = *f++;
-	  v1 = b64_char_to_value[c];
-	}
-      while (v1 < 0);
-
-      if (v1 == 0)
-	return -1;
-      unsigned int value = (v1 - 1) << 18;
-
-      /* Process second byte of a quadruplet.  */
+      if (st.count == 0 && !st.pad)
+	for (; flim - f >= 4; f += 4)
+	  {
+	    int v0 = b64_char_to_value[f[0]] - 1;
+	    int v1 = b64_char_to_value[f[1]] - 1;
+	    int v2 = b64_char_to_value[f[2]] - 1;
+	    int v3 = b64_char_to_value[f[3]] - 1;
+	    if ((v0 | v1 | v2 | v3) < 0)
+	      break;
 
-      do
-	{
-	  if (f == flim)
-	    return -1;
-	  c = *f++;
-	  v1 = b64_char_to_value[c];
-	}
-      while (v1 < 0);
+	    unsigned int value = v0 << 18 | v1 << 12 | v2 << 6 | v3;
+	    unsigned char c0 = value >> 16, c1 = value >> 8, c2 = value;
+	    if ((c0 | c1 | c2) & multibyte_bit)
+	      {
+		e = base64_put_byte (e, c0, multibyte_bit);
+		e = base64_put_byte (e, c1, multibyte_bit);
+		e = base64_put_byte (e, c2, multibyte_bit);
+	      }
+	    else
+	      {
+		e[0] = c0;
+		e[1] = c1;
+		e[2] = c2;
+		e += 3;
+	      }
+	    nchars += 3;
+	  }
 
-      if (v1 == 0)
-	return -1;
-      value += (v1 - 1) << 12;
+      if (f == flim)
+	break;
 
-      c = value >> 16 & 0xff;
-      if (c & multibyte_bit)
-	e += BYTE8_STRING (c, e);
-      else
-	*e++ = c;
-      nchars++;
+      /* Otherwise, process a single character.  */
 
-      /* Process third byte of a quadruplet.  */
+      unsigned char c = *f++;
+      int v1 = b64_char_to_value[c];
+      if (v1 < 0)
+	continue;
 
-      do
+      if (st.pad)
 	{
-	  if (f == flim)
-	    {
-	      if (!base64url)
-		return -1;
-	      *nchars_return = nchars;
-	      return e - to;
-	    }
-	  c = *f++;
-	  v1 = b64_char_to_value[c];
+	  /* The third character was '=', so this must be '=' too.  */
+	  if (c != '=')
+	    return -1;
+	  st.pad = false;
+	  st.count = 0;
+	  continue;
 	}
-      while (v1 < 0);
 
-      if (c == '=')
+      if (c == '=' && st.count >= 2)
 	{
-	  do
-	    {
-	      if (f == flim)
-		return -1;
-	      c = *f++;
-	    }
-	  while (b64_char_to_value[c] < 0);
-
-	  if (c != '=')
-	    return -1;
+	  /* Padding ends the quadruplet.  */
+	  st.pad = st.count == 2;
+	  st.count = 0;
+	  st.value = 0;
 	  continue;
 	}
 
       if (v1 == 0)
 	return -1;
-      value += (v1 - 1) << 6;
+      st.value |= (v1 - 1) << (18 - 6 * st.count);
 
-      c = value >> 8 & 0xff;
-      if (c & multibyte_bit)
-	e += BYTE8_STRING (c, e);
-      else
-	*e++ = c;
-      nchars++;
+      /* Each character after the first completes a byte.  */
 
-      /* Process fourth byte of a quadruplet.  */
+      if (st.count != 0)
+	{
+	  e = base64_put_byte (e, st.value >> (24 - 8 * st.count) & 0xff,
+			       multibyte_bit);
+	  nchars++;
+	}
 
-      do
+      if (st.count < 3)
+	st.count++;
+      else
 	{
-	  if (f == flim)
-	    {
-	      if (!base64url)
-		return -1;
-	      *nchars_return = nchars;
-	      return e - to;
-	    }
-	  c = *f++;
-	  v1 = b64_char_to_value[c];
+	  st.count = 0;
+	  st.value = 0;
 	}
-      while (v1 < 0);
+    }
 
-      if (c == '=')
-	continue;
+  *nchars_return = nchars;
+  if (state)
+    *state = st;
+  else if (!base64_decode_complete_p (&st, base64url))
+    return -1;
+  return e - to;
+}
 
-      if (v1 < 0)
-	return -1;
-      value += v1 - 1;
+/* Return true if the base64 decoder in state STATE has seen complete
+   data.  Without padding, the data may end after the second or third
+   character of a quadruplet only in the URL variant.  */
 
-      c = value & 0xff;
-      if (c & multibyte_bit)
-	e += BYTE8_STRING (c, e);
-      else
-	*e++ = c;
-      nchars++;
-    }
+static bool
+base64_decode_complete_p (struct base64_decode_state const *state,
+			  bool base64url)
+{
+  return (!state->pad
+	  && (state->count == 0 || (base64url && state->count >= 2)));
 }
 
 
@@ -3814,11 +4488,6 @@ set_hash_hash_slot (struct Lisp_Hash_Table *h, ptrdiff_t idx, Lisp_Object val)
 {
   gc_aset (h->hash, idx, val);
 }
-static void
-set_hash_index_slot (struct Lisp_Hash_Table *h, ptrdiff_t idx, ptrdiff_t val)
-{
-  gc_aset (h->index, idx, make_fixnum (val));
-}
 
 /* If OBJ is a Lisp hash table, return a pointer to its struct
    Lisp_Hash_Table.  Otherwise, signal an error.  */
@@ -3914,8 +4583,8 @@ larger_vector (Lisp_Object vec, ptrdiff_t incr_min, ptrdiff_t nitems_max)
 			 Low-level Functions
  ***********************************************************************/
 
-/* Return the index of the next entry in H following the one at IDX,
-   or -1 if none.  */
+/* Return the index of the next free entry in H following the one at
+   IDX, or -1 if none.  */
 
 static ptrdiff_t
 HASH_NEXT (struct Lisp_Hash_Table *h, ptrdiff_t idx)
@@ -3923,15 +4592,6 @@ HASH_NEXT (struct Lisp_Hash_Table *h, ptrdiff_t idx)
   return XFIXNUM (AREF (h->next, idx));
 }
 
-/* Return the index of the element in hash table H that is the start
-   of the collision list at index IDX, or -1 if the list is empty.  */
-
-static ptrdiff_t
-HASH_INDEX (struct Lisp_Hash_Table *h, ptrdiff_t idx)
-{
-  return XFIXNUM (AREF (h->index, idx));
-}
-
 /* Restore a hash table's mutability after the critical section exits.  */
 
 static void
@@ -4053,17 +4713,358 @@ #define INDEX_SIZE_BOUND \
 		      - header_size - GCALIGNMENT) \
 		     / word_size)))
 
+
+/* Hash table index.
+
+   The index is an open-addressing table laid out like the "Swiss
+   tables" of Abseil.  H->index is a unibyte string of H->index_groups
+   groups, each made of HASH_GROUP_WIDTH control bytes followed by the
+   entry numbers of as many slots.  A control byte is HASH_CTRL_EMPTY,
+   HASH_CTRL_DELETED, or, for a slot in use, seven bits taken from the
+   hash code of its entry.  Keeping the control bytes next to the
+   entry numbers lets a lookup get both with a single cache miss.
+
+   A lookup starts at the group that holds the slot given by the hash
+   code modulo the number of slots, like the bucket of a chained
+   table, so that keys with close hash codes have their slots close
+   together.  The number of groups is a prime, which spreads hash codes
+   that are multiples of each other over all groups.  The lookup
+   compares the control bytes of the whole group with the byte it
+   looks for at once, with SSE2 where available and a word at a time
+   elsewhere.  Only the entries whose byte matches have their keys
+   compared, so a lookup rarely looks at a key other than the one it
+   finds.  Unless the group has an empty slot, the lookup goes on with
+   the groups a multiple of a step away, where the step is taken from
+   other bits of the hash code; that way, keys with close hash codes
+   that fill a run of groups do not all have to probe through it.
+
+   Removing an entry empties its slot if the slot's group has an empty
+   slot already, as no lookup goes past that group anyway.  Otherwise
+   the slot is marked as deleted, so that lookups still go on past it.
+   Insertions reuse deleted slots, and rebuilding the index drops the
+   ones that are left.  */
+
+enum { HASH_CTRL_EMPTY = 0x80, HASH_CTRL_DELETED = 0xfe };
+
+#ifdef __SSE2__
+
+enum { HASH_GROUP_WIDTH = 16 };
+
+/* A set of slots in a group, with bit I set for slot I.  */
+typedef unsigned int hash_group_set;
+
+static hash_group_set
+hash_group_match (unsigned char const *group, int byte)
+{
+  __m128i ctrl = _mm_loadu_si128 ((__m128i const *) group);
+  return _mm_movemask_epi8 (_mm_cmpeq_epi8 (ctrl, _mm_set1_epi8 (byte)));
+}
+
+static hash_group_set
+hash_group_match_empty (unsigned char const *group)
+{
+  return hash_group_match (group, (signed char) HASH_CTRL_EMPTY);
+}
+
+/* Return the set of slots in GROUP that are empty or deleted.  */
+
+static hash_group_set
+hash_group_match_free (unsigned char const *group)
+{
+  return _mm_movemask_epi8 (_mm_loadu_si128 ((__m128i const *) group));
+}
+
+static int
+hash_group_first (hash_group_set set)
+{
+  return count_trailing_zeros (set);
+}
+
+#else /* !__SSE2__ */
+
+enum { HASH_GROUP_WIDTH = 8 };
+
+/* A set of slots in a group, with the top bit of byte I set for slot
+   I.  */
+typedef unsigned long long int hash_group_set;
+
+#define HASH_GROUP_LSBS 0x0101010101010101ull
+#define HASH_GROUP_MSBS 0x8080808080808080ull
+
+static hash_group_set
+hash_group_load (unsigned char const *group)
+{
+  uint64_t word;
+  memcpy (&word, group, sizeof word);
+#ifdef WORDS_BIGENDIAN
+  word = bswap_64 (word);
+#endif
+  return word;
+}
+
+/* This may also report slots after the first matching one that do
+   not match, though never empty or deleted ones.  Callers check the
+   keys anyway.  */
+
+static hash_group_set
+hash_group_match (unsigned char const *group, int byte)
+{
+  hash_group_set x = hash_group_load (group) ^ (HASH_GROUP_LSBS * byte);
+  return (x - HASH_GROUP_LSBS) & ~x & HASH_GROUP_MSBS;
+}
+
+static hash_group_set
+hash_group_match_empty (unsigned char const *group)
+{
+  hash_group_set word = hash_group_load (group);
+  return word & ~word << 6 & HASH_GROUP_MSBS;
+}
+
+static hash_group_set
+hash_group_match_free (unsigned char const *group)
+{
+  return hash_group_load (group) & HASH_GROUP_MSBS;
+}
+
+static int
+hash_group_first (hash_group_set set)
+{
+  return count_trailing_zeros_ll (set) / CHAR_BIT;
+}
+
+#endif /* !__SSE2__ */
+
+/* The type of the entry numbers in the index.  */
+typedef int_least32_t hash_index_entry;
+
+enum
+  {
+    HASH_GROUP_SIZE = HASH_GROUP_WIDTH * (1 + sizeof (hash_index_entry)),
+    HASH_INDEX_ENTRY_MAX = INT_LEAST32_MAX
+  };
+
+/* Return the control bytes of group G of H's index.  */
+
+static unsigned char *
+hash_group (struct Lisp_Hash_Table *h, ptrdiff_t g)
+{
+  return SDATA (h->index) + g * HASH_GROUP_SIZE;
+}
+
+/* Return a pointer to the control byte of slot SLOT of H's index.  */
+
+static unsigned char *
+hash_ctrl (struct Lisp_Hash_Table *h, ptrdiff_t slot)
+{
+  return hash_group (h, slot / HASH_GROUP_WIDTH) + slot % HASH_GROUP_WIDTH;
+}
+
+/* Return a pointer to the entry number of slot SLOT of H's index.  */
+
+static unsigned char *
+hash_slot_entry (struct Lisp_Hash_Table *h, ptrdiff_t slot)
+{
+  return (hash_group (h, slot / HASH_GROUP_WIDTH) + HASH_GROUP_WIDTH
+	  + slot % HASH_GROUP_WIDTH * sizeof (hash_index_entry));
+}
+
+/* Return the number of the entry in slot SLOT of H's index, which
+   must be in use.  */
+
+static ptrdiff_t
+HASH_INDEX (struct Lisp_Hash_Table *h, ptrdiff_t slot)
+{
+  hash_index_entry i;
+  memcpy (&i, hash_slot_entry (h, slot), sizeof i);
+  return i;
+}
+
+static void
+set_hash_index_slot (struct Lisp_Hash_Table *h, ptrdiff_t slot, ptrdiff_t i)
+{
+  hash_index_entry entry = i;
+  memcpy (hash_slot_entry (h, slot), &entry, sizeof entry);
+}
+
+/* Return the control byte of an entry with hash code HASH_CODE: its
+   top seven bits after scrambling, so that they depend on all bits of
+   HASH_CODE rather than on the ones that pick its first group.  */
+
+static int
+hash_ctrl_byte (EMACS_UINT hash_code)
+{
+  return (uint64_t) hash_code * 0x9e3779b97f4a7c15u >> 57;
+}
+
+/* Return the smallest prime that is at least N, or 1 if N <= 1.  */
+
 static ptrdiff_t
-hash_index_size (struct Lisp_Hash_Table *h, ptrdiff_t size)
+hash_index_prime (ptrdiff_t n)
 {
+  if (n <= 2)
+    return n <= 1 ? 1 : 2;
+  for (n |= 1; ; n += 2)
+    {
+      ptrdiff_t d = 3;
+      while (d <= n / d && n % d != 0)
+	d += 2;
+      if (n / d < d)
+	return n;
+    }
+}
+
+/* Return the number of index groups needed by a hash table H with
+   SIZE entries, enough to keep the index at most 7/8 full and to honor
+   H's rehash threshold.  */
+
+static ptrdiff_t
+hash_index_groups (struct Lisp_Hash_Table *h, ptrdiff_t size)
+{
+  if (HASH_INDEX_ENTRY_MAX < size)
+    error ("Hash table too large");
   double threshold = h->rehash_threshold;
-  double index_float = size / threshold;
-  ptrdiff_t index_size = (index_float < INDEX_SIZE_BOUND + 1
-	                  ? next_almost_prime (index_float)
-	                  : INDEX_SIZE_BOUND + 1);
-  if (INDEX_SIZE_BOUND < index_size)
+  double ngroups_float
+    = size / min (threshold, 0.875) / HASH_GROUP_WIDTH + 1;
+  ptrdiff_t ngroups = (ngroups_float < INDEX_SIZE_BOUND / HASH_GROUP_SIZE
+		       ? hash_index_prime (ngroups_float)
+		       : INDEX_SIZE_BOUND);
+  if (INDEX_SIZE_BOUND / HASH_GROUP_SIZE < ngroups)
     error ("Hash table too large");
-  return index_size;
+  return ngroups;
+}
+
+/* Mark all slots of H's index as empty.  */
+
+static void
+hash_index_clear (struct Lisp_Hash_Table *h)
+{
+  for (ptrdiff_t g = 0; g < h->index_groups; g++)
+    memset (hash_group (h, g), HASH_CTRL_EMPTY, HASH_GROUP_WIDTH);
+  h->index_deleted = 0;
+}
+
+/* Give H an empty index of NGROUPS groups.  */
+
+static void
+make_hash_index (struct Lisp_Hash_Table *h, ptrdiff_t ngroups)
+{
+  h->index = make_uninit_string (ngroups * HASH_GROUP_SIZE);
+  h->index_groups = ngroups;
+  hash_index_clear (h);
+}
+
+/* Return the group where lookups of hash code HASH_CODE start in H's
+   index.  */
+
+static ptrdiff_t
+hash_first_group (struct Lisp_Hash_Table *h, EMACS_UINT hash_code)
+{
+  return hash_code % (h->index_groups * HASH_GROUP_WIDTH) / HASH_GROUP_WIDTH;
+}
+
+/* Return the group that lookups of hash code HASH_CODE probe after
+   group G of H's index.  *STEP is the distance between the groups, or
+   0 if it is not known yet.  As the number of groups is a prime, the
+   lookups visit every group.  */
+
+static ptrdiff_t
+hash_next_group (struct Lisp_Hash_Table *h, EMACS_UINT hash_code,
+		 ptrdiff_t g, ptrdiff_t *step)
+{
+  ptrdiff_t ngroups = h->index_groups;
+  if (*step == 0)
+    {
+      uint64_t scrambled = (uint64_t) hash_code * 0x9e3779b97f4a7c15u;
+      *step = ngroups == 1 ? 1 : 1 + (scrambled >> 32) % (ngroups - 1);
+    }
+  g += *step;
+  return g < ngroups ? g : g - ngroups;
+}
+
+/* Put entry I with hash code HASH_CODE into a free slot of H's index,
+   which must have one.  */
+
+static void
+hash_index_insert (struct Lisp_Hash_Table *h, ptrdiff_t i,
+		   EMACS_UINT hash_code)
+{
+  ptrdiff_t g = hash_first_group (h, hash_code);
+
+  for (ptrdiff_t ngroups = h->index_groups, step = 0;
+       0 < ngroups; ngroups--, g = hash_next_group (h, hash_code, g, &step))
+    {
+      unsigned char *group = hash_group (h, g);
+      hash_group_set avail = hash_group_match_free (group);
+      if (avail)
+	{
+	  int n = hash_group_first (avail);
+	  if (group[n] == HASH_CTRL_DELETED)
+	    h->index_deleted--;
+	  group[n] = hash_ctrl_byte (hash_code);
+	  set_hash_index_slot (h, g * HASH_GROUP_WIDTH + n, i);
+	  return;
+	}
+    }
+  emacs_abort ();
+}
+
+/* Empty slot SLOT of H's index.  */
+
+static void
+hash_index_remove (struct Lisp_Hash_Table *h, ptrdiff_t slot)
+{
+  if (hash_group_match_empty (hash_group (h, slot / HASH_GROUP_WIDTH)))
+    *hash_ctrl (h, slot) = HASH_CTRL_EMPTY;
+  else
+    {
+      *hash_ctrl (h, slot) = HASH_CTRL_DELETED;
+      h->index_deleted++;
+    }
+}
+
+/* Put all entries of H into its index, which must be empty.  */
+
+static void
+hash_index_fill (struct Lisp_Hash_Table *h)
+{
+  ptrdiff_t size = HASH_TABLE_SIZE (h);
+  for (ptrdiff_t i = 0; i < size; i++)
+    if (!NILP (HASH_HASH (h, i)))
+      hash_index_insert (h, i, XUFIXNUM (HASH_HASH (h, i)));
+}
+
+/* Return the slot of H's index that holds the entry for KEY, whose
+   hash code is HASH_CODE, or -1 if there is none.  */
+
+static ptrdiff_t
+hash_index_lookup (struct Lisp_Hash_Table *h, Lisp_Object key,
+		   Lisp_Object hash_code)
+{
+  ptrdiff_t g = hash_first_group (h, XUFIXNUM (hash_code));
+  int byte = hash_ctrl_byte (XUFIXNUM (hash_code));
+
+  for (ptrdiff_t ngroups = h->index_groups, step = 0;
+       0 < ngroups;
+       ngroups--, g = hash_next_group (h, XUFIXNUM (hash_code), g, &step))
+    {
+      /* Refetch the group after comparing keys, as a user-defined
+	 test may have caused a GC that moved it.  */
+      hash_group_set match = hash_group_match (hash_group (h, g), byte);
+      for (; match; match &= match - 1)
+	{
+	  ptrdiff_t slot = g * HASH_GROUP_WIDTH + hash_group_first (match);
+	  ptrdiff_t i = HASH_INDEX (h, slot);
+	  if (*hash_ctrl (h, slot) == byte
+	      && (EQ (key, HASH_KEY (h, i))
+		  || (h->test.cmpfn
+		      && EQ (hash_code, HASH_HASH (h, i))
+		      && !NILP (h->test.cmpfn (key, HASH_KEY (h, i), h)))))
+	    return slot;
+	}
+      if (hash_group_match_empty (hash_group (h, g)))
+	break;
+    }
+  return -1;
 }
 
 /* Create and initialize a new hash table.
@@ -4122,7 +5123,7 @@ make_hash_table (struct hash_table_test test, EMACS_INT size,
   h->key_and_value = make_vector (2 * size, Qunbound);
   h->hash = make_nil_vector (size);
   h->next = make_vector (size, make_fixnum (-1));
-  h->index = make_vector (hash_index_size (h, size), make_fixnum (-1));
+  make_hash_index (h, hash_index_groups (h, size));
   h->next_weak = NULL;
   h->purecopy = purecopy;
   h->mutable = true;
@@ -4198,7 +5199,7 @@ maybe_resize_hash_table (struct Lisp_Hash_Table *h)
       for (ptrdiff_t i = old_size; i < next_size - 1; i++)
 	gc_aset (next, i, make_fixnum (i + 1));
       gc_aset (next, next_size - 1, make_fixnum (-1));
-      ptrdiff_t index_size = hash_index_size (h, next_size);
+      ptrdiff_t index_groups = hash_index_groups (h, next_size);
 
       /* Build the new&larger key_and_value vector, making sure the new
          fields are initialized to `unbound`.  */
@@ -4211,21 +5212,14 @@ maybe_resize_hash_table (struct Lisp_Hash_Table *h)
 
       Lisp_Object hash = larger_vector (h->hash, next_size - old_size,
 					next_size);
-      h->index = make_vector (index_size, make_fixnum (-1));
       h->key_and_value = key_and_value;
       h->hash = hash;
       h->next = next;
       h->next_free = old_size;
 
       /* Rehash.  */
-      for (ptrdiff_t i = 0; i < old_size; i++)
-	if (!NILP (HASH_HASH (h, i)))
-	  {
-	    EMACS_UINT hash_code = XUFIXNUM (HASH_HASH (h, i));
-	    ptrdiff_t start_of_bucket = hash_code % ASIZE (h->index);
-	    set_hash_next_slot (h, i, HASH_INDEX (h, start_of_bucket));
-	    set_hash_index_slot (h, start_of_bucket, i);
-	  }
+      make_hash_index (h, index_groups);
+      hash_index_fill (h);
 
 #ifdef ENABLE_CHECKING
       if (HASH_TABLE_P (Vpurify_flag) && XHASH_TABLE (Vpurify_flag) == h)
@@ -4234,7 +5228,69 @@ maybe_resize_hash_table (struct Lisp_Hash_Table *h)
     }
 }
 
-/* Recompute the hashes (and hence also the "next" pointers).
+/* Number of calls to `maphash' in progress.  While this is nonzero,
+   hash tables are not shrunk automatically, as that would move
+   entries that the iteration has yet to visit.  */
+
+static ptrdiff_t maphash_depth;
+
+/* Reallocate hash table H with room for NEW_SIZE entries, NEW_SIZE >=
+   H->count, moving the entries to the front of the new vectors in
+   their current order.  */
+
+static void
+compact_hash_table (struct Lisp_Hash_Table *h, ptrdiff_t new_size)
+{
+  hash_rehash_if_needed (h);
+  eassert (h->count <= new_size && 0 < new_size);
+
+  ptrdiff_t old_size = HASH_TABLE_SIZE (h);
+  Lisp_Object key_and_value = make_vector (2 * new_size, Qunbound);
+  Lisp_Object hash = make_nil_vector (new_size);
+  Lisp_Object next = make_vector (new_size, make_fixnum (-1));
+  ptrdiff_t index_groups = hash_index_groups (h, new_size);
+
+  ptrdiff_t count = 0;
+  for (ptrdiff_t i = 0; i < old_size; i++)
+    if (!NILP (HASH_HASH (h, i)))
+      {
+	ASET (key_and_value, 2 * count, HASH_KEY (h, i));
+	ASET (key_and_value, 2 * count + 1, HASH_VALUE (h, i));
+	ASET (hash, count, HASH_HASH (h, i));
+	count++;
+      }
+  eassert (count == h->count);
+  for (ptrdiff_t i = count; i < new_size - 1; i++)
+    ASET (next, i, make_fixnum (i + 1));
+
+  h->key_and_value = key_and_value;
+  h->hash = hash;
+  h->next = next;
+  h->next_free = count < new_size ? count : -1;
+
+  make_hash_index (h, index_groups);
+  hash_index_fill (h);
+}
+
+static void
+maphash_unwind (void)
+{
+  maphash_depth--;
+}
+
+/* Shrink hash table H if at most an eighth of its entries are in use.
+   Leave room for four times the current count, so that a table whose
+   count goes up and down is not resized back and forth.  */
+
+static void
+maybe_shrink_hash_table (struct Lisp_Hash_Table *h)
+{
+  ptrdiff_t size = HASH_TABLE_SIZE (h);
+  if (maphash_depth == 0 && DEFAULT_HASH_SIZE < size && h->count <= size / 8)
+    compact_hash_table (h, max (DEFAULT_HASH_SIZE, 4 * h->count));
+}
+
+/* Recompute the hashes (and hence also the index).
    Normally there's never a need to recompute hashes.
    This is done only on first-access to a hash-table loaded from
    the "pdump", because the object's addresses may have changed, thus
@@ -4260,19 +5316,13 @@ hash_table_rehash (struct Lisp_Hash_Table *h)
     }
 
   /* Reset the index so that any slot we don't fill below is marked
-     invalid.  */
-  Ffillarray (h->index, make_fixnum (-1));
+     empty.  */
+  hash_index_clear (h);
 
-  /* Rebuild the collision chains.  */
+  /* Rebuild the index.  */
   for (ptrdiff_t i = 0; i < size; ++i)
     if (!NILP (AREF (hash, i)))
-      {
-        EMACS_UINT hash_code = XUFIXNUM (AREF (hash, i));
-        ptrdiff_t start_of_bucket = hash_code % ASIZE (h->index);
-        set_hash_next_slot (h, i, HASH_INDEX (h, start_of_bucket));
-        set_hash_index_slot (h, start_of_bucket, i);
-        eassert (HASH_NEXT (h, i) != i); /* Stop loops.  */
-      }
+      hash_index_insert (h, i, XUFIXNUM (AREF (hash, i)));
 
   /* Finally, mark the hash table as having a valid hash order.
      Do this last so that if we're interrupted, we retry on next
@@ -4289,24 +5339,14 @@ hash_table_rehash (struct Lisp_Hash_Table *h)
 ptrdiff_t
 hash_lookup (struct Lisp_Hash_Table *h, Lisp_Object key, Lisp_Object *hash)
 {
-  ptrdiff_t start_of_bucket, i;
-
   hash_rehash_if_needed (h);
 
   Lisp_Object hash_code = h->test.hashfn (key, h);
   if (hash)
     *hash = hash_code;
 
-  start_of_bucket = XUFIXNUM (hash_code) % ASIZE (h->index);
-
-  for (i = HASH_INDEX (h, start_of_bucket); 0 <= i; i = HASH_NEXT (h, i))
-    if (EQ (key, HASH_KEY (h, i))
-	|| (h->test.cmpfn
-	    && EQ (hash_code, HASH_HASH (h, i))
-	    && !NILP (h->test.cmpfn (key, HASH_KEY (h, i), h))))
-      break;
-
-  return i;
+  ptrdiff_t slot = hash_index_lookup (h, key, hash_code);
+  return slot < 0 ? -1 : HASH_INDEX (h, slot);
 }
 
 static void
@@ -4325,8 +5365,6 @@ check_mutable_hash_table (Lisp_Object obj, struct Lisp_Hash_Table *h)
 hash_put (struct Lisp_Hash_Table *h, Lisp_Object key, Lisp_Object value,
 	  Lisp_Object hash)
 {
-  ptrdiff_t start_of_bucket, i;
-
   hash_rehash_if_needed (h);
 
   /* Increment count after resizing because resizing may fail.  */
@@ -4334,20 +5372,27 @@ hash_put (struct Lisp_Hash_Table *h, Lisp_Object key, Lisp_Object value,
   h->count++;
 
   /* Store key/value in the key_and_value vector.  */
-  i = h->next_free;
+  ptrdiff_t i = h->next_free;
   eassert (NILP (HASH_HASH (h, i)));
   eassert (EQ (Qunbound, (HASH_KEY (h, i))));
   h->next_free = HASH_NEXT (h, i);
+  set_hash_next_slot (h, i, -1);
   set_hash_key_slot (h, i, key);
   set_hash_value_slot (h, i, value);
 
   /* Remember its hash code.  */
   set_hash_hash_slot (h, i, hash);
 
-  /* Add new entry to its collision chain.  */
-  start_of_bucket = XUFIXNUM (hash) % ASIZE (h->index);
-  set_hash_next_slot (h, i, HASH_INDEX (h, start_of_bucket));
-  set_hash_index_slot (h, start_of_bucket, i);
+  /* Add the new entry to the index, first dropping its deleted slots
+     if they and the entries would leave no empty slot in a group.  */
+  ptrdiff_t nslots = h->index_groups * HASH_GROUP_WIDTH;
+  if (nslots - nslots / 8 < h->count + h->index_deleted)
+    {
+      hash_index_clear (h);
+      hash_index_fill (h);
+    }
+  else
+    hash_index_insert (h, i, XUFIXNUM (hash));
   return i;
 }
 
@@ -4358,39 +5403,26 @@ hash_put (struct Lisp_Hash_Table *h, Lisp_Object key, Lisp_Object value,
 hash_remove_from_table (struct Lisp_Hash_Table *h, Lisp_Object key)
 {
   Lisp_Object hash_code = h->test.hashfn (key, h);
-  ptrdiff_t start_of_bucket = XUFIXNUM (hash_code) % ASIZE (h->index);
-  ptrdiff_t prev = -1;
 
   hash_rehash_if_needed (h);
 
-  for (ptrdiff_t i = HASH_INDEX (h, start_of_bucket);
-       0 <= i;
-       i = HASH_NEXT (h, i))
+  ptrdiff_t slot = hash_index_lookup (h, key, hash_code);
+  if (0 <= slot)
     {
-      if (EQ (key, HASH_KEY (h, i))
-	  || (h->test.cmpfn
-	      && EQ (hash_code, HASH_HASH (h, i))
-	      && !NILP (h->test.cmpfn (key, HASH_KEY (h, i), h))))
-	{
-	  /* Take entry out of collision chain.  */
-	  if (prev < 0)
-	    set_hash_index_slot (h, start_of_bucket, HASH_NEXT (h, i));
-	  else
-	    set_hash_next_slot (h, prev, HASH_NEXT (h, i));
-
-	  /* Clear slots in key_and_value and add the slots to
-	     the free list.  */
-	  set_hash_key_slot (h, i, Qunbound);
-	  set_hash_value_slot (h, i, Qnil);
-	  set_hash_hash_slot (h, i, Qnil);
-	  set_hash_next_slot (h, i, h->next_free);
-	  h->next_free = i;
-	  h->count--;
-	  eassert (h->count >= 0);
-	  break;
-	}
-
-      prev = i;
+      ptrdiff_t i = HASH_INDEX (h, slot);
+
+      /* Take entry out of the index.  */
+      hash_index_remove (h, slot);
+
+      /* Clear slots in key_and_value and add the slots to
+	 the free list.  */
+      set_hash_key_slot (h, i, Qunbound);
+      set_hash_value_slot (h, i, Qnil);
+      set_hash_hash_slot (h, i, Qnil);
+      set_hash_next_slot (h, i, h->next_free);
+      h->next_free = i;
+      h->count--;
+      eassert (h->count >= 0);
     }
 }
 
@@ -4412,8 +5444,7 @@ hash_clear (struct Lisp_Hash_Table *h)
 	  set_hash_hash_slot (h, i, Qnil);
 	}
 
-      for (i = 0; i < ASIZE (h->index); ++i)
-	ASET (h->index, i, make_fixnum (-1));
+      hash_index_clear (h);
 
       h->next_free = 0;
       h->count = 0;
@@ -4426,96 +5457,71 @@ hash_clear (struct Lisp_Hash_Table *h)
 			   Weak Hash Tables
  ************************************************************************/
 
-/* Sweep weak hash table H.  REMOVE_ENTRIES_P means remove
-   entries from the table that don't survive the current GC.
-   !REMOVE_ENTRIES_P means mark entries that are in use.  Value is
-   true if anything was marked.  */
+/* Return true if an entry of a hash table with weakness WEAK survives
+   the current GC.  KEY_SURVIVES and VALUE_SURVIVES say whether the
+   entry's key and value are known to survive it.  */
 
 bool
-sweep_weak_table (struct Lisp_Hash_Table *h, bool remove_entries_p)
+weak_entry_survives_p (Lisp_Object weak, bool key_survives,
+		       bool value_survives)
+{
+  if (EQ (weak, Qkey))
+    return key_survives;
+  else if (EQ (weak, Qvalue))
+    return value_survives;
+  else if (EQ (weak, Qkey_or_value))
+    return key_survives || value_survives;
+  else if (EQ (weak, Qkey_and_value))
+    return key_survives && value_survives;
+  else
+    emacs_abort ();
+}
+
+/* Remove the entries of weak hash table H that don't survive the
+   current GC.  Marking is over at this point, so the entries that are
+   kept have both their key and value marked.  */
+
+void
+sweep_weak_table (struct Lisp_Hash_Table *h)
 {
-  ptrdiff_t n = gc_asize (h->index);
-  bool marked = false;
+  ptrdiff_t n = h->index_groups * HASH_GROUP_WIDTH;
 
-  for (ptrdiff_t bucket = 0; bucket < n; ++bucket)
+  /* It's okay if hash_rehash_needed_p (h) is true, since the index
+     is not rebuilt here and stays valid for the cached hash values.  */
+  for (ptrdiff_t slot = 0; slot < n; ++slot)
     {
-      /* Follow collision chain, removing entries that don't survive
-         this garbage collection.  It's okay if hash_rehash_needed_p
-         (h) is true, since we're operating entirely on the cached
-         hash values. */
-      ptrdiff_t prev = -1;
-      ptrdiff_t next;
-      for (ptrdiff_t i = HASH_INDEX (h, bucket); 0 <= i; i = next)
-        {
-	  bool key_known_to_survive_p = survives_gc_p (HASH_KEY (h, i));
-	  bool value_known_to_survive_p = survives_gc_p (HASH_VALUE (h, i));
-	  bool remove_p;
-
-	  if (EQ (h->weak, Qkey))
-	    remove_p = !key_known_to_survive_p;
-	  else if (EQ (h->weak, Qvalue))
-	    remove_p = !value_known_to_survive_p;
-	  else if (EQ (h->weak, Qkey_or_value))
-	    remove_p = !(key_known_to_survive_p || value_known_to_survive_p);
-	  else if (EQ (h->weak, Qkey_and_value))
-	    remove_p = !(key_known_to_survive_p && value_known_to_survive_p);
-	  else
-	    emacs_abort ();
+      if (*hash_ctrl (h, slot) & HASH_CTRL_EMPTY)
+	continue;
 
-	  next = HASH_NEXT (h, i);
+      ptrdiff_t i = HASH_INDEX (h, slot);
 
-	  if (remove_entries_p)
-	    {
-              eassert (!remove_p
-                       == (key_known_to_survive_p && value_known_to_survive_p));
-	      if (remove_p)
-		{
-		  /* Take out of collision chain.  */
-		  if (prev < 0)
-		    set_hash_index_slot (h, bucket, next);
-		  else
-		    set_hash_next_slot (h, prev, next);
-
-		  /* Add to free list.  */
-		  set_hash_next_slot (h, i, h->next_free);
-		  h->next_free = i;
-
-		  /* Clear key, value, and hash.  */
-		  set_hash_key_slot (h, i, Qunbound);
-		  set_hash_value_slot (h, i, Qnil);
-                  if (!NILP (h->hash))
-                    set_hash_hash_slot (h, i, Qnil);
-
-                  eassert (h->count != 0);
-                  h->count += h->count > 0 ? -1 : 1;
-                }
-	      else
-		{
-		  prev = i;
-		}
-	    }
-	  else
-	    {
-	      if (!remove_p)
-		{
-		  /* Make sure key and value survive.  */
-		  if (!key_known_to_survive_p)
-		    {
-		      mark_object (HASH_KEY (h, i));
-                      marked = true;
-		    }
-
-		  if (!value_known_to_survive_p)
-		    {
-		      mark_object (HASH_VALUE (h, i));
-                      marked = true;
-		    }
-		}
-	    }
+      bool key_known_to_survive_p = survives_gc_p (HASH_KEY (h, i));
+      bool value_known_to_survive_p = survives_gc_p (HASH_VALUE (h, i));
+      bool remove_p = !weak_entry_survives_p (h->weak,
+					      key_known_to_survive_p,
+					      value_known_to_survive_p);
+
+      eassert (!remove_p
+	       == (key_known_to_survive_p && value_known_to_survive_p));
+      if (remove_p)
+	{
+	  /* Take out of the index.  */
+	  hash_index_remove (h, slot);
+
+	  /* Add to free list.  */
+	  set_hash_next_slot (h, i, h->next_free);
+	  h->next_free = i;
+
+	  /* Clear key, value, and hash.  */
+	  set_hash_key_slot (h, i, Qunbound);
+	  set_hash_value_slot (h, i, Qnil);
+	  if (!NILP (h->hash))
+	    set_hash_hash_slot (h, i, Qnil);
+
+	  eassert (h->count != 0);
+	  h->count += h->count > 0 ? -1 : 1;
 	}
     }
-
-  return marked;
 }
 
 
@@ -4533,20 +5539,29 @@ #define SXHASH_MAX_DEPTH 3
 #define SXHASH_MAX_LEN   7
 
 /* Return a hash for string PTR which has length LEN.  The hash value
-   can be any EMACS_UINT value.  */
+   can be any EMACS_UINT value.  Combine a word at a time rather than a
+   byte at a time, since this is called for every `intern' and every
+   lookup of a string in an `equal' hash table.  */
 
 EMACS_UINT
 hash_string (char const *ptr, ptrdiff_t len)
 {
   char const *p = ptr;
   char const *end = p + len;
-  unsigned char c;
-  EMACS_UINT hash = 0;
+  EMACS_UINT hash = len;
+  EMACS_UINT word;
+
+  for (; sizeof word <= end - p; p += sizeof word)
+    {
+      memcpy (&word, p, sizeof word);
+      hash = sxhash_combine (hash, word);
+    }
 
-  while (p != end)
+  if (p != end)
     {
-      c = *p++;
-      hash = sxhash_combine (hash, c);
+      for (word = 0; p != end; p++)
+	word = (word << CHAR_BIT) + (unsigned char) *p;
+      hash = sxhash_combine (hash, word);
     }
 
   return hash;
@@ -4964,6 +5979,7 @@ DEFUN ("clrhash", Fclrhash, Sclrhash, 1, 1, 0,
   struct Lisp_Hash_Table *h = check_hash_table (table);
   check_mutable_hash_table (table, h);
   hash_clear (h);
+  maybe_shrink_hash_table (h);
   /* Be compatible with XEmacs.  */
   return table;
 }
@@ -5007,6 +6023,7 @@ DEFUN ("remhash", Fremhash, Sremhash, 2, 2, 0,
   struct Lisp_Hash_Table *h = check_hash_table (table);
   check_mutable_hash_table (table, h);
   hash_remove_from_table (h, key);
+  maybe_shrink_hash_table (h);
   return Qnil;
 }
 
@@ -5018,6 +6035,10 @@ DEFUN ("maphash", Fmaphash, Smaphash, 2, 2, 0,
   (Lisp_Object function, Lisp_Object table)
 {
   struct Lisp_Hash_Table *h = check_hash_table (table);
+  ptrdiff_t count = SPECPDL_INDEX ();
+
+  record_unwind_protect_void (maphash_unwind);
+  maphash_depth++;
 
   for (ptrdiff_t i = 0; i < HASH_TABLE_SIZE (h); ++i)
     {
@@ -5026,7 +6047,25 @@ DEFUN ("maphash", Fmaphash, Smaphash, 2, 2, 0,
         call2 (function, k, HASH_VALUE (h, i));
     }
 
-  return Qnil;
+  return unbind_to (count, Qnil);
+}
+
+
+DEFUN ("compact-hash-table", Fcompact_hash_table, Scompact_hash_table,
+       1, 1, 0,
+       doc: /* Shrink hash table TABLE to fit its current contents.
+Entries that were removed from TABLE keep occupying memory until TABLE
+is reallocated; `remhash' and `clrhash' do this automatically when
+TABLE becomes mostly empty.  Don't call this function from within
+`maphash' over TABLE.  Return TABLE.  */)
+  (Lisp_Object table)
+{
+  struct Lisp_Hash_Table *h = check_hash_table (table);
+  check_mutable_hash_table (table, h);
+  ptrdiff_t new_size = max (1, h->count);
+  if (new_size < HASH_TABLE_SIZE (h))
+    compact_hash_table (h, new_size);
+  return table;
 }
 
 
@@ -5090,6 +6129,112 @@ DEFUN ("secure-hash-algorithms", Fsecure_hash_algorithms,
   return list (Qmd5, Qsha1, Qsha224, Qsha256, Qsha384, Qsha512);
 }
 
+/* Return the region of the current buffer between START and END, as
+   specified with `secure-hash', in *B and *E.  */
+
+static void
+buffer_data_region (Lisp_Object start, Lisp_Object end,
+		    EMACS_INT *b, EMACS_INT *e)
+{
+  if (NILP (start))
+    *b = BEGV;
+  else
+    {
+      CHECK_FIXNUM_COERCE_MARKER (start);
+      *b = XFIXNUM (start);
+    }
+
+  if (NILP (end))
+    *e = ZV;
+  else
+    {
+      CHECK_FIXNUM_COERCE_MARKER (end);
+      *e = XFIXNUM (end);
+    }
+
+  if (*b > *e)
+    {
+      EMACS_INT temp = *b;
+      *b = *e;
+      *e = temp;
+    }
+
+  if (!(BEGV <= *b && *e <= ZV))
+    args_out_of_range (start, end);
+}
+
+/* Return the coding system to encode the text of the current buffer
+   between B and E with, for `secure-hash'.  CODING_SYSTEM and NOERROR
+   are as specified with `md5'.  */
+
+static Lisp_Object
+buffer_data_coding_system (EMACS_INT b, EMACS_INT e,
+			   Lisp_Object coding_system, Lisp_Object noerror)
+{
+  if (NILP (coding_system))
+    {
+      /* Decide the coding-system to encode the data with.
+	 See fileio.c:Fwrite-region */
+
+      if (!NILP (Vcoding_system_for_write))
+	coding_system = Vcoding_system_for_write;
+      else
+	{
+	  bool force_raw_text = false;
+
+	  coding_system = BVAR (current_buffer, buffer_file_coding_system);
+	  if (NILP (coding_system)
+	      || NILP (Flocal_variable_p (Qbuffer_file_coding_system, Qnil)))
+	    {
+	      coding_system = Qnil;
+	      if (NILP (BVAR (current_buffer, enable_multibyte_characters)))
+		force_raw_text = true;
+	    }
+
+	  if (NILP (coding_system) && !NILP (Fbuffer_file_name (Qnil)))
+	    {
+	      /* Check file-coding-system-alist.  */
+	      Lisp_Object val = CALLN (Ffind_operation_coding_system,
+				       Qwrite_region,
+				       make_fixnum (b), make_fixnum (e),
+				       Fbuffer_file_name (Qnil));
+	      if (CONSP (val) && !NILP (XCDR (val)))
+		coding_system = XCDR (val);
+	    }
+
+	  if (NILP (coding_system)
+	      && !NILP (BVAR (current_buffer, buffer_file_coding_system)))
+	    {
+	      /* If we still have not decided a coding system, use the
+		 default value of buffer-file-coding-system.  */
+	      coding_system = BVAR (current_buffer, buffer_file_coding_system);
+	    }
+
+	  if (!force_raw_text
+	      && !NILP (Ffboundp (Vselect_safe_coding_system_function)))
+	    /* Confirm that VAL can surely encode the current region.  */
+	    coding_system = call4 (Vselect_safe_coding_system_function,
+				   make_fixnum (b), make_fixnum (e),
+				   coding_system, Qnil);
+
+	  if (force_raw_text)
+	    coding_system = Qraw_text;
+	}
+
+      if (NILP (Fcoding_system_p (coding_system)))
+	{
+	  /* Invalid coding system.  */
+
+	  if (!NILP (noerror))
+	    coding_system = Qraw_text;
+	  else
+	    xsignal1 (Qcoding_system_error, coding_system);
+	}
+    }
+
+  return coding_system;
+}
+
 /* Extract data from a string or a buffer. SPEC is a list of
 (BUFFER-OR-STRING-OR-SYMBOL START END CODING-SYSTEM NOERROR) which behave as
 specified with `secure-hash' and in Info node
@@ -5158,92 +6303,9 @@ extract_data_from_object (Lisp_Object spec,
       struct buffer *bp = XBUFFER (object);
       set_buffer_internal (bp);
 
-      if (NILP (start))
-	b = BEGV;
-      else
-	{
-	  CHECK_FIXNUM_COERCE_MARKER (start);
-	  b = XFIXNUM (start);
-	}
-
-      if (NILP (end))
-	e = ZV;
-      else
-	{
-	  CHECK_FIXNUM_COERCE_MARKER (end);
-	  e = XFIXNUM (end);
-	}
-
-      if (b > e)
-	{
-	  EMACS_INT temp = b;
-	  b = e;
-	  e = temp;
-	}
-
-      if (!(BEGV <= b && e <= ZV))
-	args_out_of_range (start, end);
-
-      if (NILP (coding_system))
-	{
-	  /* Decide the coding-system to encode the data with.
-	     See fileio.c:Fwrite-region */
-
-	  if (!NILP (Vcoding_system_for_write))
-	    coding_system = Vcoding_system_for_write;
-	  else
-	    {
-	      bool force_raw_text = false;
-
-	      coding_system = BVAR (XBUFFER (object), buffer_file_coding_system);
-	      if (NILP (coding_system)
-		  || NILP (Flocal_variable_p (Qbuffer_file_coding_system, Qnil)))
-		{
-		  coding_system = Qnil;
-		  if (NILP (BVAR (current_buffer, enable_multibyte_characters)))
-		    force_raw_text = true;
-		}
-
-	      if (NILP (coding_system) && !NILP (Fbuffer_file_name (object)))
-		{
-		  /* Check file-coding-system-alist.  */
-		  Lisp_Object val = CALLN (Ffind_operation_coding_system,
-					   Qwrite_region,
-					   make_fixnum (b), make_fixnum (e),
-					   Fbuffer_file_name (object));
-		  if (CONSP (val) && !NILP (XCDR (val)))
-		    coding_system = XCDR (val);
-		}
-
-	      if (NILP (coding_system)
-		  && !NILP (BVAR (XBUFFER (object), buffer_file_coding_system)))
-		{
-		  /* If we still have not decided a coding system, use the
-		     default value of buffer-file-coding-system.  */
-		  coding_system = BVAR (XBUFFER (object), buffer_file_coding_system);
-		}
-
-	      if (!force_raw_text
-		  && !NILP (Ffboundp (Vselect_safe_coding_system_function)))
-		/* Confirm that VAL can surely encode the current region.  */
-		coding_system = call4 (Vselect_safe_coding_system_function,
-				       make_fixnum (b), make_fixnum (e),
-				       coding_system, Qnil);
-
-	      if (force_raw_text)
-		coding_system = Qraw_text;
-	    }
-
-	  if (NILP (Fcoding_system_p (coding_system)))
-	    {
-	      /* Invalid coding system.  */
-
-	      if (!NILP (noerror))
-		coding_system = Qraw_text;
-	      else
-		xsignal1 (Qcoding_system_error, coding_system);
-	    }
-	}
+      buffer_data_region (start, end, &b, &e);
+      coding_system = buffer_data_coding_system (b, e, coding_system,
+						 noerror);
 
       object = make_buffer_string (b, e, false);
       set_buffer_internal (prev);
@@ -5285,72 +6347,257 @@ extract_data_from_object (Lisp_Object spec,
 }
 
 
-/* ALGORITHM is a symbol: md5, sha1, sha224 and so on. */
+/* The state of a message digest computation with one of the
+   algorithms of `secure-hash'.  */
 
-static Lisp_Object
-secure_hash (Lisp_Object algorithm, Lisp_Object object, Lisp_Object start,
-	     Lisp_Object end, Lisp_Object coding_system, Lisp_Object noerror,
-	     Lisp_Object binary)
+struct secure_hash_state
 {
-  ptrdiff_t start_byte, end_byte;
+  /* The algorithm, one of Qmd5, Qsha1 and so on.  */
+  Lisp_Object algorithm;
+
+  /* The size of the digest in bytes.  */
   int digest_size;
-  void *(*hash_func) (const char *, size_t, void *);
-  Lisp_Object digest;
 
-  CHECK_SYMBOL (algorithm);
+  union
+  {
+    struct md5_ctx md5;
+    struct sha1_ctx sha1;
+    struct sha256_ctx sha256;
+    struct sha512_ctx sha512;
+  } ctx;
+};
 
-  Lisp_Object spec = list5 (object, start, end, coding_system, noerror);
+/* The secure hash functions encode buffer text this many characters
+   at a time.  */
+enum { SECURE_HASH_CHUNK = 1024 * 1024 };
 
-  const char *input = extract_data_from_object (spec, &start_byte, &end_byte);
+/* Start computing a digest with ALGORITHM, a symbol: md5, sha1, sha224
+   and so on.  */
 
-  if (input == NULL)
-    error ("secure_hash: failed to extract data from object, aborting!");
+static void
+secure_hash_init (struct secure_hash_state *state, Lisp_Object algorithm)
+{
+  CHECK_SYMBOL (algorithm);
+  state->algorithm = algorithm;
 
   if (EQ (algorithm, Qmd5))
     {
-      digest_size = MD5_DIGEST_SIZE;
-      hash_func	  = md5_buffer;
+      state->digest_size = MD5_DIGEST_SIZE;
+      md5_init_ctx (&state->ctx.md5);
     }
   else if (EQ (algorithm, Qsha1))
     {
-      digest_size = SHA1_DIGEST_SIZE;
-      hash_func	  = sha1_buffer;
+      state->digest_size = SHA1_DIGEST_SIZE;
+      sha1_init_ctx (&state->ctx.sha1);
     }
   else if (EQ (algorithm, Qsha224))
     {
-      digest_size = SHA224_DIGEST_SIZE;
-      hash_func	  = sha224_buffer;
+      state->digest_size = SHA224_DIGEST_SIZE;
+      sha224_init_ctx (&state->ctx.sha256);
     }
   else if (EQ (algorithm, Qsha256))
     {
-      digest_size = SHA256_DIGEST_SIZE;
-      hash_func	  = sha256_buffer;
+      state->digest_size = SHA256_DIGEST_SIZE;
+      sha256_init_ctx (&state->ctx.sha256);
     }
   else if (EQ (algorithm, Qsha384))
     {
-      digest_size = SHA384_DIGEST_SIZE;
-      hash_func	  = sha384_buffer;
+      state->digest_size = SHA384_DIGEST_SIZE;
+      sha384_init_ctx (&state->ctx.sha512);
     }
   else if (EQ (algorithm, Qsha512))
     {
-      digest_size = SHA512_DIGEST_SIZE;
-      hash_func	  = sha512_buffer;
+      state->digest_size = SHA512_DIGEST_SIZE;
+      sha512_init_ctx (&state->ctx.sha512);
     }
   else
     error ("Invalid algorithm arg: %s", SDATA (Fsymbol_name (algorithm)));
+}
+
+/* Add the LEN bytes at BUFFER to the digest computed in STATE.  */
+
+static void
+secure_hash_process (struct secure_hash_state *state,
+		     void const *buffer, ptrdiff_t len)
+{
+  Lisp_Object algorithm = state->algorithm;
+
+  if (EQ (algorithm, Qmd5))
+    md5_process_bytes (buffer, len, &state->ctx.md5);
+  else if (EQ (algorithm, Qsha1))
+    sha1_process_bytes (buffer, len, &state->ctx.sha1);
+  else if (EQ (algorithm, Qsha224) || EQ (algorithm, Qsha256))
+    sha256_process_bytes (buffer, len, &state->ctx.sha256);
+  else
+    sha512_process_bytes (buffer, len, &state->ctx.sha512);
+}
+
+/* Finish the digest computed in STATE, and return it as a string:
+   in binary form if BINARY is non-nil, else in hexadecimal.  */
+
+static Lisp_Object
+secure_hash_finish (struct secure_hash_state *state, Lisp_Object binary)
+{
+  Lisp_Object algorithm = state->algorithm;
+  int digest_size = state->digest_size;
 
   /* allocate 2 x digest_size so that it can be re-used to hold the
      hexified value */
-  digest = make_uninit_string (digest_size * 2);
+  Lisp_Object digest = make_uninit_string (digest_size * 2);
+  char *p = SSDATA (digest);
 
-  hash_func (input + start_byte,
-	     end_byte - start_byte,
-	     SSDATA (digest));
+  if (EQ (algorithm, Qmd5))
+    md5_finish_ctx (&state->ctx.md5, p);
+  else if (EQ (algorithm, Qsha1))
+    sha1_finish_ctx (&state->ctx.sha1, p);
+  else if (EQ (algorithm, Qsha224))
+    sha224_finish_ctx (&state->ctx.sha256, p);
+  else if (EQ (algorithm, Qsha256))
+    sha256_finish_ctx (&state->ctx.sha256, p);
+  else if (EQ (algorithm, Qsha384))
+    sha384_finish_ctx (&state->ctx.sha512, p);
+  else
+    sha512_finish_ctx (&state->ctx.sha512, p);
 
   if (NILP (binary))
     return make_digest_string (digest, digest_size);
   else
-    return make_unibyte_string (SSDATA (digest), digest_size);
+    return make_unibyte_string (p, digest_size);
+}
+
+/* Encode the text of the current buffer between FROM and TO with
+   CODING, and add the result to the digest computed in STATE.  */
+
+static void
+secure_hash_encoded_text (struct secure_hash_state *state,
+			  struct coding_system *coding,
+			  ptrdiff_t from, ptrdiff_t from_byte,
+			  ptrdiff_t to, ptrdiff_t to_byte)
+{
+  /* Avoid creating a Lisp string for the encoded text.  */
+  coding->raw_destination = 1;
+  encode_coding_object (coding, Fcurrent_buffer (), from, from_byte,
+			to, to_byte, Qt);
+  if (coding->raw_destination)
+    {
+      secure_hash_process (state, coding->destination, coding->produced);
+      /* We're responsible for freeing this, see
+	 encode_coding_object to check why.  */
+      xfree (coding->destination);
+      coding->raw_destination = 0;
+    }
+  else
+    secure_hash_process (state, SDATA (coding->dst_object),
+			 SBYTES (coding->dst_object));
+}
+
+/* Add the text of the current buffer between FROM and TO to the
+   digest computed in STATE, without copying it into a string.  Unless
+   CODING_SYSTEM is nil, encode the text with it a chunk at a time, the
+   way `write-region' does.  */
+
+static void
+secure_hash_buffer_text (struct secure_hash_state *state,
+			 ptrdiff_t from, ptrdiff_t to,
+			 Lisp_Object coding_system)
+{
+  bool encode = !NILP (coding_system);
+  struct coding_system coding;
+
+  if (encode)
+    setup_coding_system (coding_system, &coding);
+
+  while (from < to)
+    {
+      ptrdiff_t from_byte = CHAR_TO_BYTE (from);
+      ptrdiff_t nchars = min (to - from, SECURE_HASH_CHUNK);
+      ptrdiff_t chunk_end_byte = CHAR_TO_BYTE (from + nchars);
+
+      if (encode)
+	coding.src_multibyte = nchars < chunk_end_byte - from_byte;
+      if (encode && CODING_REQUIRE_ENCODING (&coding))
+	{
+	  secure_hash_encoded_text (state, &coding, from, from_byte,
+				    from + nchars, chunk_end_byte);
+	  from += coding.consumed_char;
+	}
+      else
+	{
+	  /* Hash the text as it is, on each side of the gap.  */
+	  if (from_byte < GPT_BYTE && GPT_BYTE < chunk_end_byte)
+	    {
+	      secure_hash_process (state, BYTE_POS_ADDR (from_byte),
+				   GPT_BYTE - from_byte);
+	      from_byte = GPT_BYTE;
+	    }
+	  secure_hash_process (state, BYTE_POS_ADDR (from_byte),
+			       chunk_end_byte - from_byte);
+	  from += nchars;
+	}
+      maybe_quit ();
+    }
+
+  if (encode)
+    {
+      if (CODING_REQUIRE_FLUSHING (&coding))
+	{
+	  /* Let the encoder output what it still holds, with an empty
+	     last block as `write-region' does.  Marking the last chunk
+	     itself as the last block is not the same: the encoder may
+	     then reset its state in the middle of that chunk.  */
+	  coding.mode |= CODING_MODE_LAST_BLOCK;
+	  secure_hash_encoded_text (state, &coding, to, CHAR_TO_BYTE (to),
+				    to, CHAR_TO_BYTE (to));
+	}
+      Vlast_coding_system_used = CODING_ID_NAME (coding.id);
+    }
+}
+
+/* ALGORITHM is a symbol: md5, sha1, sha224 and so on. */
+
+static Lisp_Object
+secure_hash (Lisp_Object algorithm, Lisp_Object object, Lisp_Object start,
+	     Lisp_Object end, Lisp_Object coding_system, Lisp_Object noerror,
+	     Lisp_Object binary)
+{
+  struct secure_hash_state state;
+
+  secure_hash_init (&state, algorithm);
+
+  if (BUFFERP (object))
+    {
+      /* Hash the text where it is, rather than making a string of it
+	 the way extract_data_from_object does.  */
+      ptrdiff_t count = SPECPDL_INDEX ();
+      EMACS_INT b, e;
+
+      record_unwind_current_buffer ();
+      set_buffer_internal (XBUFFER (object));
+
+      buffer_data_region (start, end, &b, &e);
+      coding_system = buffer_data_coding_system (b, e, coding_system,
+						 noerror);
+      if (NILP (BVAR (current_buffer, enable_multibyte_characters)))
+	coding_system = Qnil;
+      secure_hash_buffer_text (&state, b, e, coding_system);
+
+      unbind_to (count, Qnil);
+    }
+  else
+    {
+      ptrdiff_t start_byte, end_byte;
+      Lisp_Object spec = list5 (object, start, end, coding_system, noerror);
+      const char *input = extract_data_from_object (spec, &start_byte,
+						    &end_byte);
+
+      if (input == NULL)
+	error ("secure_hash: failed to extract data from object, aborting!");
+
+      secure_hash_process (&state, input + start_byte,
+			   end_byte - start_byte);
+    }
+
+  return secure_hash_finish (&state, binary);
 }
 
 DEFUN ("md5", Fmd5, Smd5, 1, 5, 0,
@@ -5402,6 +6649,45 @@ DEFUN ("secure-hash", Fsecure_hash, Ssecure_hash, 2, 5, 0,
   return secure_hash (algorithm, object, start, end, Qnil, Qnil, binary);
 }
 
+DEFUN ("secure-hash-file", Fsecure_hash_file, Ssecure_hash_file, 2, 3, 0,
+       doc: /* Return the secure hash of the contents of FILE.
+ALGORITHM is a symbol specifying the hash to use, as with
+`secure-hash'.  The hash is computed from the bytes in FILE, without
+decoding them and without reading the whole file into memory.
+
+If BINARY is non-nil, returns a string in binary form.  */)
+  (Lisp_Object algorithm, Lisp_Object file, Lisp_Object binary)
+{
+  struct secure_hash_state state;
+  ptrdiff_t count = SPECPDL_INDEX ();
+  char buf[MAX_ALLOCA];
+
+  secure_hash_init (&state, algorithm);
+  CHECK_STRING (file);
+  file = Fexpand_file_name (file, Qnil);
+
+  Lisp_Object handler = Ffind_file_name_handler (file, Qsecure_hash_file);
+  if (!NILP (handler))
+    return call4 (handler, Qsecure_hash_file, algorithm, file, binary);
+
+  Lisp_Object encoded_file = ENCODE_FILE (file);
+  int fd = emacs_open (SSDATA (encoded_file), O_RDONLY, 0);
+  if (fd < 0)
+    report_file_error ("Opening input file", file);
+  record_unwind_protect_int (close_file_unwind, fd);
+
+  ptrdiff_t nread;
+  while ((nread = emacs_read_quit (fd, buf, sizeof buf)) != 0)
+    {
+      if (nread < 0)
+	report_file_error ("Read error", file);
+      secure_hash_process (&state, buf, nread);
+    }
+
+  unbind_to (count, Qnil);
+  return secure_hash_finish (&state, binary);
+}
+
 DEFUN ("buffer-hash", Fbuffer_hash, Sbuffer_hash, 0, 1, 0,
        doc: /* Return a hash of the contents of BUFFER-OR-NAME.
 This hash is performed on the raw internal format of the buffer,
@@ -5460,6 +6746,7 @@ syms_of_fns (void)
   DEFSYM (Qhash_table_test, "hash-table-test");
   DEFSYM (Qkey_or_value, "key-or-value");
   DEFSYM (Qkey_and_value, "key-and-value");
+  DEFSYM (QCkey, ":key");
 
   defsubr (&Ssxhash_eq);
   defsubr (&Ssxhash_eql);
@@ -5478,6 +6765,7 @@ syms_of_fns (void)
   defsubr (&Sputhash);
   defsubr (&Sremhash);
   defsubr (&Smaphash);
+  defsubr (&Scompact_hash_table);
   defsubr (&Sdefine_hash_table_test);
 
   /* Crypto and hashing stuff.  */
@@ -5489,6 +6777,7 @@ syms_of_fns (void)
   DEFSYM (Qsha256, "sha256");
   DEFSYM (Qsha384, "sha384");
   DEFSYM (Qsha512, "sha512");
+  DEFSYM (Qsecure_hash_file, "secure-hash-file");
 
   /* Miscellaneous stuff.  */
 
@@ -5557,6 +6846,7 @@ syms_of_fns (void)
   defsubr (&Sproper_list_p);
   defsubr (&Sstring_bytes);
   defsubr (&Sstring_distance);
+  defsubr (&Sstring_distances);
   defsubr (&Sstring_equal);
   defsubr (&Scompare_strings);
   defsubr (&Sstring_lessp);
@@ -5573,6 +6863,7 @@ syms_of_fns (void)
   defsubr (&Sstring_as_unibyte);
   defsubr (&Sstring_to_multibyte);
   defsubr (&Sstring_to_unibyte);
+  defsubr (&Sstring_search);
   defsubr (&Scopy_alist);
   defsubr (&Ssubstring);
   defsubr (&Ssubstring_no_properties);
@@ -5625,6 +6916,7 @@ syms_of_fns (void)
   defsubr (&Smd5);
   defsubr (&Ssecure_hash_algorithms);
   defsubr (&Ssecure_hash);
+  defsubr (&Ssecure_hash_file);
   defsubr (&Sbuffer_hash);
   defsubr (&Slocale_info);
 }
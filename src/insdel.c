@@ -68,11 +68,11 @@ check_markers (void)
     {
       if (tail->buffer->text != current_buffer->text)
 	emacs_abort ();
-      if (tail->charpos > Z)
+      if (marker_charpos (tail) > Z)
 	emacs_abort ();
-      if (tail->bytepos > Z_BYTE)
+      if (marker_bytepos (tail) > Z_BYTE)
 	emacs_abort ();
-      if (multibyte && ! CHAR_HEAD_P (FETCH_BYTE (tail->bytepos)))
+      if (multibyte && ! CHAR_HEAD_P (FETCH_BYTE (marker_bytepos (tail))))
 	emacs_abort ();
     }
 }
@@ -227,8 +227,8 @@ adjust_suspend_auto_hscroll (ptrdiff_t from, ptrdiff_t to)
 
       if (BUFFERP (w->contents)
 	  && XBUFFER (w->contents) == current_buffer
-	  && XMARKER (w->old_pointm)->charpos >= from
-	  && XMARKER (w->old_pointm)->charpos <= to)
+	  && marker_charpos (XMARKER (w->old_pointm)) >= from
+	  && marker_charpos (XMARKER (w->old_pointm)) <= to)
 	w->suspend_auto_hscroll = 0;
     }
 }
@@ -247,9 +247,18 @@ adjust_markers_for_delete (ptrdiff_t from, ptrdiff_t from_byte,
 {
   struct Lisp_Marker *m;
   ptrdiff_t charpos;
+  ptrdiff_t nmarkers = 0;
 
   adjust_suspend_auto_hscroll (from, to);
-  for (m = BUF_MARKERS (current_buffer); m; m = m->next)
+  adjust_charpos_checkpoints (current_buffer, from, from_byte,
+			      to - from, to_byte - from_byte, 0, 0);
+  if (BUF_MARKER_INDEX (current_buffer))
+    {
+      adjust_marker_index_for_replace (current_buffer, from, from_byte,
+				       to - from, to_byte - from_byte, 0, 0);
+      return;
+    }
+  for (m = BUF_MARKERS (current_buffer); m; m = m->next, nmarkers++)
     {
       charpos = m->charpos;
       eassert (charpos <= Z);
@@ -268,6 +277,7 @@ adjust_markers_for_delete (ptrdiff_t from, ptrdiff_t from_byte,
 	  m->bytepos = from_byte;
 	}
     }
+  maybe_index_markers (current_buffer, nmarkers);
 }
 
 
@@ -287,38 +297,44 @@ adjust_markers_for_insert (ptrdiff_t from, ptrdiff_t from_byte,
   bool adjusted = 0;
   ptrdiff_t nchars = to - from;
   ptrdiff_t nbytes = to_byte - from_byte;
+  ptrdiff_t nmarkers = 0;
 
   adjust_suspend_auto_hscroll (from, to);
-  for (m = BUF_MARKERS (current_buffer); m; m = m->next)
-    {
-      eassert (m->bytepos >= m->charpos
-	       && m->bytepos - m->charpos <= Z_BYTE - Z);
-
-      if (m->bytepos == from_byte)
-	{
-	  if (m->insertion_type || before_markers)
-	    {
-	      m->bytepos = to_byte;
-	      m->charpos = to;
-	      if (m->insertion_type)
-		adjusted = 1;
-	    }
-	}
-      else if (m->bytepos > from_byte)
-	{
-	  m->bytepos += nbytes;
-	  m->charpos += nchars;
-	}
-    }
+  adjust_charpos_checkpoints (current_buffer, from, from_byte,
+			      0, 0, nchars, nbytes);
+  if (BUF_MARKER_INDEX (current_buffer))
+    adjusted = adjust_marker_index_for_insert (current_buffer, from,
+					       nchars, nbytes,
+					       before_markers);
+  else
+    for (m = BUF_MARKERS (current_buffer); m; m = m->next, nmarkers++)
+      {
+	eassert (m->bytepos >= m->charpos
+		 && m->bytepos - m->charpos <= Z_BYTE - Z);
+
+	if (m->bytepos == from_byte)
+	  {
+	    if (m->insertion_type || before_markers)
+	      {
+		m->bytepos = to_byte;
+		m->charpos = to;
+		if (m->insertion_type)
+		  adjusted = 1;
+	      }
+	  }
+	else if (m->bytepos > from_byte)
+	  {
+	    m->bytepos += nbytes;
+	    m->charpos += nchars;
+	  }
+      }
+  maybe_index_markers (current_buffer, nmarkers);
 
   /* Adjusting only markers whose insertion-type is t may result in
-     - disordered start and end in overlays, and
-     - disordered overlays in the slot `overlays_before' of current_buffer.  */
+     disordered start and end in overlays, and may reorder the overlay
+     starts at FROM relative to each other.  */
   if (adjusted)
-    {
-      fix_start_end_in_overlays (from, to);
-      fix_overlays_before (current_buffer, from, to);
-    }
+    fix_start_end_in_overlays (from, to);
 }
 
 /* Adjust point for an insertion of NBYTES bytes, which are NCHARS characters.
@@ -353,21 +369,30 @@ adjust_markers_for_replace (ptrdiff_t from, ptrdiff_t from_byte,
   ptrdiff_t prev_to_byte = from_byte + old_bytes;
   ptrdiff_t diff_chars = new_chars - old_chars;
   ptrdiff_t diff_bytes = new_bytes - old_bytes;
+  ptrdiff_t nmarkers = 0;
 
   adjust_suspend_auto_hscroll (from, from + old_chars);
-  for (m = BUF_MARKERS (current_buffer); m; m = m->next)
-    {
-      if (m->bytepos >= prev_to_byte)
-	{
-	  m->charpos += diff_chars;
-	  m->bytepos += diff_bytes;
-	}
-      else if (m->bytepos > from_byte)
-	{
-	  m->charpos = from;
-	  m->bytepos = from_byte;
-	}
-    }
+  adjust_charpos_checkpoints (current_buffer, from, from_byte,
+			      old_chars, old_bytes, new_chars, new_bytes);
+  if (BUF_MARKER_INDEX (current_buffer))
+    adjust_marker_index_for_replace (current_buffer, from, from_byte,
+				     old_chars, old_bytes,
+				     new_chars, new_bytes);
+  else
+    for (m = BUF_MARKERS (current_buffer); m; m = m->next, nmarkers++)
+      {
+	if (m->bytepos >= prev_to_byte)
+	  {
+	    m->charpos += diff_chars;
+	    m->bytepos += diff_bytes;
+	  }
+	else if (m->bytepos > from_byte)
+	  {
+	    m->charpos = from;
+	    m->bytepos = from_byte;
+	  }
+      }
+  maybe_index_markers (current_buffer, nmarkers);
 
   check_markers ();
 }
@@ -407,6 +432,7 @@ adjust_markers_bytepos (ptrdiff_t from, ptrdiff_t from_byte,
   ptrdiff_t beg = from, begbyte = from_byte;
 
   adjust_suspend_auto_hscroll (from, to);
+  free_marker_index (current_buffer);
 
   if (Z == Z_BYTE || (!to_z && to == to_byte))
     {
@@ -444,6 +470,32 @@ adjust_markers_bytepos (ptrdiff_t from, ptrdiff_t from_byte,
   clear_charpos_cache (current_buffer);
 }
 
+/* Adjust byte positions of markers after the text at FROM (FROM_BYTE)
+   of NCHARS_DEL characters was replaced with INSCHARS characters and
+   INSBYTES bytes longer than NBYTES_DEL, without relocating markers.
+   Unlike adjust_markers_bytepos, this keeps the marker index when
+   the number of characters is the same, as with case changes.  The
+   checkpoints of character positions move with the text as usual.  */
+
+static void
+adjust_markers_bytepos_for_replace (ptrdiff_t from, ptrdiff_t from_byte,
+				    ptrdiff_t nchars_del, ptrdiff_t nbytes_del,
+				    ptrdiff_t inschars, ptrdiff_t insbytes)
+{
+  adjust_charpos_checkpoints (current_buffer, from, from_byte,
+			      nchars_del, nbytes_del, inschars, insbytes);
+  if (BUF_MARKER_INDEX (current_buffer) && nchars_del == inschars)
+    {
+      adjust_suspend_auto_hscroll (from, from + inschars);
+      adjust_marker_index_bytepos (current_buffer, from, from_byte,
+				   from + inschars, insbytes - nbytes_del);
+      clear_charpos_cache (current_buffer);
+    }
+  else
+    adjust_markers_bytepos (from, from_byte, from + inschars,
+			    from_byte + insbytes, 1);
+}
+
 
 void
 buffer_overflow (void)
@@ -930,7 +982,6 @@ insert_1_both (const char *string,
   if (Z - GPT < END_UNCHANGED)
     END_UNCHANGED = Z - GPT;
 
-  adjust_overlays_for_insert (PT, nchars);
   adjust_markers_for_insert (PT, PT_BYTE,
 			     PT + nchars, PT_BYTE + nbytes,
 			     before_markers);
@@ -1056,7 +1107,6 @@ insert_from_string_1 (Lisp_Object string, ptrdiff_t pos, ptrdiff_t pos_byte,
   if (Z - GPT < END_UNCHANGED)
     END_UNCHANGED = Z - GPT;
 
-  adjust_overlays_for_insert (PT, nchars);
   adjust_markers_for_insert (PT, PT_BYTE, PT + nchars,
 			     PT_BYTE + outgoing_nbytes,
 			     before_markers);
@@ -1127,7 +1177,6 @@ insert_from_gap (ptrdiff_t nchars, ptrdiff_t nbytes, bool text_at_gap_tail)
 
   insert_from_gap_1 (nchars, nbytes, text_at_gap_tail);
 
-  adjust_overlays_for_insert (ins_charpos, nchars);
   adjust_markers_for_insert (ins_charpos, ins_bytepos,
 			     ins_charpos + nchars, ins_bytepos + nbytes, 0);
 
@@ -1269,7 +1318,6 @@ insert_from_buffer_1 (struct buffer *buf,
   if (Z - GPT < END_UNCHANGED)
     END_UNCHANGED = Z - GPT;
 
-  adjust_overlays_for_insert (PT, nchars);
   adjust_markers_for_insert (PT, PT_BYTE, PT + nchars,
 			     PT_BYTE + outgoing_nbytes,
 			     0);
@@ -1334,11 +1382,6 @@ adjust_after_replace (ptrdiff_t from, ptrdiff_t from_byte,
     record_delete (from, prev_text, false);
   record_insert (from, len);
 
-  if (len > nchars_del)
-    adjust_overlays_for_insert (from, len - nchars_del);
-  else if (len < nchars_del)
-    adjust_overlays_for_delete (from, nchars_del - len);
-
   offset_intervals (current_buffer, from, len - nchars_del);
 
   if (from < PT)
@@ -1518,15 +1561,11 @@ replace_range (ptrdiff_t from, ptrdiff_t to, Lisp_Object new,
 	 deleted and the inserted text might have multibyte sequences
 	 which make the original byte positions of the markers
 	 invalid.  */
-      adjust_markers_bytepos (from, from_byte, from + inschars,
-			      from_byte + outgoing_insbytes, 1);
+      adjust_markers_bytepos_for_replace (from, from_byte,
+					  nchars_del, nbytes_del,
+					  inschars, outgoing_insbytes);
     }
 
-  /* Adjust the overlay center as needed.  This must be done after
-     adjusting the markers that bound the overlays.  */
-  adjust_overlays_for_delete (from, nchars_del);
-  adjust_overlays_for_insert (from, inschars);
-
   offset_intervals (current_buffer, from, inschars - nchars_del);
 
   /* Get the intervals for the part of the string we are inserting--
@@ -1648,19 +1687,12 @@ replace_range_2 (ptrdiff_t from, ptrdiff_t from_byte,
 	     deleted and the inserted text might have multibyte
 	     sequences which make the original byte positions of the
 	     markers invalid.  */
-	  adjust_markers_bytepos (from, from_byte, from + inschars,
-				  from_byte + insbytes, 1);
+	  adjust_markers_bytepos_for_replace (from, from_byte,
+					      nchars_del, nbytes_del,
+					      inschars, insbytes);
 	}
     }
 
-  /* Adjust the overlay center as needed.  This must be done after
-     adjusting the markers that bound the overlays.  */
-  if (nchars_del != inschars)
-    {
-      adjust_overlays_for_insert (from, inschars);
-      adjust_overlays_for_delete (from + inschars, nchars_del);
-    }
-
   offset_intervals (current_buffer, from, inschars - nchars_del);
 
   /* Relocate point as if it were a marker.  */
@@ -1863,10 +1895,6 @@ del_range_2 (ptrdiff_t from, ptrdiff_t from_byte,
 
   offset_intervals (current_buffer, from, - nchars_del);
 
-  /* Adjust the overlay center as needed.  This must be done after
-     adjusting the markers that bound the overlays.  */
-  adjust_overlays_for_delete (from, nchars_del);
-
   GAP_SIZE += nbytes_del;
   ZV_BYTE -= nbytes_del;
   Z_BYTE -= nbytes_del;
@@ -1954,10 +1982,12 @@ prepare_to_modify_buffer_1 (ptrdiff_t start, ptrdiff_t end,
   /* If we're about to modify a buffer the contents of which come from
      a dump file, copy the contents to private storage first so we
      don't take a COW fault on the buffer text and keep it around
-     forever.  */
-  if (pdumper_object_p (BEG_ADDR))
+     forever.  Likewise for contents mapped from a file, which would
+     otherwise keep the file mapped.  */
+  if (pdumper_object_p (BEG_ADDR) || current_buffer->text->mapped_size)
     enlarge_buffer_text (current_buffer, 0);
   eassert (!pdumper_object_p (BEG_ADDR));
+  eassert (!current_buffer->text->mapped_size);
 
   run_undoable_change();
 
@@ -2724,9 +2724,10 @@ read_char (int commandflag, Lisp_Object map,
 	    }
 	}
 
-      /* If there is still no input available, ask for GC.  */
+      /* If there is still no input available, ask for GC, or at
+	 least finish sweeping after the last one.  */
       if (!detect_input_pending_run_timers (0))
-	maybe_gc ();
+	gc_when_idle ();
     }
 
   /* Notify the caller if an autosave hook, or a timer, sentinel or
@@ -3564,7 +3564,7 @@ DEFUN ("apropos-internal", Fapropos_internal, Sapropos_internal, 1, 2, 0,
   apropos_predicate = predicate;
   apropos_accumulate = Qnil;
   map_obarray (Vobarray, apropos_accum, regexp);
-  tem = Fsort (apropos_accumulate, Qstring_lessp);
+  tem = CALLN (Fsort, apropos_accumulate, Qstring_lessp);
   apropos_accumulate = Qnil;
   apropos_predicate = Qnil;
   return tem;
@@ -793,6 +793,10 @@ #define XUNTAG(a, type, ctype) ((ctype *) \
   SYMBOL_TRAPPED_WRITE = 2
 };
 
+/* Number of bits of a symbol's name hash that are kept in the symbol.
+   They fit in the same word as the other bit-fields of the symbol.  */
+enum { SYMBOL_NAME_HASH_BITS = 16 };
+
 struct Lisp_Symbol
 {
   union
@@ -824,6 +828,11 @@ #define XUNTAG(a, type, ctype) ((ctype *) \
       /* True if pointed to from purespace and hence can't be GC'd.  */
       bool_bf pinned : 1;
 
+      /* The high-order bits of the hash code of the symbol's name, as
+	 computed by symbol_name_hash.  This lets oblookup skip most
+	 symbols in a bucket without looking at their names.  */
+      unsigned name_hash : SYMBOL_NAME_HASH_BITS;
+
       /* The symbol's name, as a Lisp string.  */
       Lisp_Object name;
 
@@ -2191,6 +2200,15 @@ SYMBOL_NAME (Lisp_Object sym)
   return XSYMBOL (sym)->u.s.name;
 }
 
+/* Return the part of HASH, a hash code of a symbol name computed by
+   hash_string, that is kept in the symbol's name_hash.  */
+
+INLINE unsigned int
+symbol_name_hash (EMACS_UINT hash)
+{
+  return hash >> (EMACS_INT_WIDTH - SYMBOL_NAME_HASH_BITS);
+}
+
 /* Value is true if SYM is an interned symbol.  */
 
 INLINE bool
@@ -2278,16 +2296,16 @@ #define DEFSYM(sym, name) /* empty */
      If the I-th entry is unused, then hash[I] should be nil.  */
   Lisp_Object hash;
 
-  /* Vector used to chain entries.  If entry I is free, next[I] is the
-     entry number of the next free item.  If entry I is non-free,
-     next[I] is the index of the next entry in the collision chain,
-     or -1 if there is such entry.  */
+  /* Vector used to chain free entries.  If entry I is free, next[I]
+     is the entry number of the next free item, or -1 if there is no
+     such entry.  If entry I is in use, next[I] is -1.  */
   Lisp_Object next;
 
-  /* Bucket vector.  An entry of -1 indicates no item is present,
-     and a nonnegative entry is the index of the first item in
-     a collision chain.  This vector's size can be larger than the
-     hash table size to reduce collisions.  */
+  /* Unibyte string holding the open-addressing index, which maps hash
+     codes to entry numbers.  It has more slots than the hash table
+     has entries, in groups of a few, and each slot has a control byte
+     that tells whether the slot is in use and gives seven bits of the
+     hash code of its entry.  See "Hash table index" in fns.c.  */
   Lisp_Object index;
 
   /* Only the fields above are traced normally by the GC.  The ones after
@@ -2321,6 +2339,11 @@ #define DEFSYM(sym, name) /* empty */
      new size is the old size times REHASH_SIZE + 1.  */
   float rehash_size;
 
+  /* Number of groups of INDEX, and number of its slots that are
+     marked as deleted.  */
+  ptrdiff_t index_groups;
+  ptrdiff_t index_deleted;
+
   /* Vector of keys and values.  The key of item I is found at index
      2 * I, the value is found at index 2 * I + 1.
      If the key is equal to Qunbound, then this slot is unused.
@@ -2413,12 +2436,16 @@ hash_rehash_if_needed (struct Lisp_Hash_Table *h)
 static float const DEFAULT_REHASH_SIZE = 1.5 - 1;
 
 /* Combine two integers X and Y for hashing.  The result might exceed
-   INTMASK.  */
+   INTMASK.  Rotate X so that earlier values reach the low-order bits
+   again, and multiply by an odd constant (2**64 divided by the golden
+   ratio) so that each bit of Y affects all higher-order bits; a mere
+   shift and add would make, e.g., (1 2) and (0 18) collide.  */
 
 INLINE EMACS_UINT
 sxhash_combine (EMACS_UINT x, EMACS_UINT y)
 {
-  return (x << 4) + (x >> (EMACS_INT_WIDTH - 4)) + y;
+  EMACS_UINT rotated = (x << 5) + (x >> (EMACS_INT_WIDTH - 5));
+  return (rotated ^ y) * (EMACS_UINT) 0x9e3779b97f4a7c15u;
 }
 
 /* Hash X, returning a value in the range 0..INTMASK.  */
@@ -2452,6 +2479,10 @@ SXHASH_REDUCE (EMACS_UINT x)
   /* True means normal insertion at the marker's position
      leaves the marker after the inserted text.  */
   bool_bf insertion_type : 1;
+  /* True if this is the start or end of an overlay that is in its
+     buffer's overlay tree, so moving it must reposition the overlay
+     in that tree.  */
+  bool_bf overlay_bound : 1;
 
   /* The remaining fields are meaningless in a marker that
      does not point anywhere.  */
@@ -2460,12 +2491,15 @@ SXHASH_REDUCE (EMACS_UINT x)
      this is used to chain of all the markers in a given buffer.
      The chain does not preserve markers from garbage collection;
      instead, markers are removed from the chain when freed by GC.  */
-  /* We could remove it and use an array in buffer_text instead.
-     That would also allow us to preserve it ordered.  */
   struct Lisp_Marker *next;
-  /* This is the char position where the marker points.  */
+  /* If the buffer text has a marker index, the block of the index that
+     holds this marker, and otherwise NULL.  See marker.c.  */
+  struct marker_block *block;
+  /* This is the char position where the marker points, relative to
+     the position of BLOCK if there is one.  Use marker_charpos or
+     marker_position to get the actual position.  */
   ptrdiff_t charpos;
-  /* This is the byte position.
+  /* This is the byte position, likewise relative to BLOCK.
      It's mostly used as a charpos<->bytepos cache (i.e. it's not directly
      used to implement the functionality of markers, but rather to (ab)use
      markers as a cache for char<->byte mappings).  */
@@ -2482,16 +2516,25 @@ SXHASH_REDUCE (EMACS_UINT x)
    - insertion type of both ends (per-marker fields)
    - start & start byte (of start marker)
    - end & end byte (of end marker)
-   - next (singly linked list of overlays)
+   - left, right and parent (tree of the buffer's overlays)
+   - maxend and red (balancing and searching that tree)
    - next fields of start and end markers (singly linked list of markers).
-   I.e. 9words plus 2 bits, 3words of which are for external linked lists.
+   I.e. 12words plus 3 bits, 6words of which are for external structures.
 */
   {
     union vectorlike_header header;
     Lisp_Object start;
     Lisp_Object end;
     Lisp_Object plist;
-    struct Lisp_Overlay *next;
+    /* The buffer's overlays form a red-black tree ordered by start
+       position; see the comment before overlay_tree_insert in
+       buffer.c.  These are the links of that tree, or all NULL when
+       the overlay is not in a buffer.  */
+    struct Lisp_Overlay *left, *right, *parent;
+    /* The overlay with the greatest end position in the subtree rooted
+       here.  */
+    struct Lisp_Overlay *maxend;
+    bool_bf red : 1;
   } GCALIGNED_STRUCT;
 
 struct Lisp_Misc_Ptr
@@ -3552,6 +3595,7 @@ modiff_to_integer (modiff_count a)
 };
 extern Lisp_Object arithcompare (Lisp_Object num1, Lisp_Object num2,
                                  enum Arith_Comparison comparison);
+extern int count_one_bits_word (bits_word);
 
 /* Convert the Emacs representation CONS back to an integer of type
    TYPE, storing the result the variable VAR.  Signal an error if CONS
@@ -3615,7 +3659,8 @@ #define CONS_TO_INTEGER(cons, type, var)				\
 extern ptrdiff_t list_length (Lisp_Object);
 extern EMACS_INT next_almost_prime (EMACS_INT) ATTRIBUTE_CONST;
 extern Lisp_Object larger_vector (Lisp_Object, ptrdiff_t, ptrdiff_t);
-extern bool sweep_weak_table (struct Lisp_Hash_Table *, bool);
+extern bool weak_entry_survives_p (Lisp_Object, bool, bool);
+extern void sweep_weak_table (struct Lisp_Hash_Table *);
 extern void hexbuf_digest (char *, void const *, int);
 extern char *extract_data_from_object (Lisp_Object, ptrdiff_t *, ptrdiff_t *);
 EMACS_UINT hash_string (char const *, ptrdiff_t);
@@ -3650,6 +3695,9 @@ #define CONS_TO_INTEGER(cons, type, var)				\
 extern Lisp_Object string_make_unibyte (Lisp_Object);
 extern void syms_of_fns (void);
 
+/* Defined in sort.c.  */
+extern void tim_sort (Lisp_Object, Lisp_Object, Lisp_Object *, ptrdiff_t);
+
 /* Defined in floatfns.c.  */
 #ifndef HAVE_TRUNC
 extern double trunc (double);
@@ -3782,6 +3830,8 @@ #define CONS_TO_INTEGER(cons, type, var)				\
 extern AVOID buffer_memory_full (ptrdiff_t);
 extern bool survives_gc_p (Lisp_Object);
 extern void mark_object (Lisp_Object);
+extern void gc_finish_sweep (void);
+extern void gc_when_idle (void);
 #if defined REL_ALLOC && !defined SYSTEM_MALLOC && !defined HYBRID_MALLOC
 extern void refill_memory_reserve (void);
 #endif
@@ -4234,14 +4284,13 @@ XMODULE_FUNCTION (Lisp_Object o)
 extern bool mouse_face_overlay_overlaps (Lisp_Object);
 extern Lisp_Object disable_line_numbers_overlay_at_eob (void);
 extern AVOID nsberror (Lisp_Object);
-extern void adjust_overlays_for_insert (ptrdiff_t, ptrdiff_t);
-extern void adjust_overlays_for_delete (ptrdiff_t, ptrdiff_t);
 extern void fix_start_end_in_overlays (ptrdiff_t, ptrdiff_t);
 extern void report_overlay_modification (Lisp_Object, Lisp_Object, bool,
                                          Lisp_Object, Lisp_Object, Lisp_Object);
 extern bool overlay_touches_p (ptrdiff_t);
 extern Lisp_Object other_buffer_safely (Lisp_Object);
 extern Lisp_Object get_truename_buffer (Lisp_Object);
+extern bool mapped_buffer_text_fault (void *);
 extern void init_buffer_once (void);
 extern void init_buffer (void);
 extern void syms_of_buffer (void);
@@ -4251,7 +4300,31 @@ XMODULE_FUNCTION (Lisp_Object o)
 
 extern ptrdiff_t marker_position (Lisp_Object);
 extern ptrdiff_t marker_byte_position (Lisp_Object);
+extern ptrdiff_t marker_charpos (struct Lisp_Marker const *);
+extern ptrdiff_t marker_bytepos (struct Lisp_Marker const *);
+extern void attach_marker (struct Lisp_Marker *, struct buffer *,
+			   ptrdiff_t, ptrdiff_t);
+extern void index_marker (struct Lisp_Marker *);
+extern void unindex_marker (struct Lisp_Marker *);
+extern void maybe_index_markers (struct buffer *, ptrdiff_t);
+extern void free_marker_index (struct buffer *);
+extern bool adjust_marker_index_for_insert (struct buffer *, ptrdiff_t,
+					    ptrdiff_t, ptrdiff_t, bool);
+extern void adjust_marker_index_for_replace (struct buffer *,
+					     ptrdiff_t, ptrdiff_t,
+					     ptrdiff_t, ptrdiff_t,
+					     ptrdiff_t, ptrdiff_t);
+extern void adjust_marker_index_bytepos (struct buffer *, ptrdiff_t,
+					 ptrdiff_t, ptrdiff_t, ptrdiff_t);
+extern void traverse_markers (struct buffer *, ptrdiff_t, ptrdiff_t,
+			      void (*) (struct Lisp_Marker *, void *), void *);
 extern void clear_charpos_cache (struct buffer *);
+extern void free_charpos_checkpoints (struct buffer *);
+extern void adjust_charpos_checkpoints (struct buffer *, ptrdiff_t, ptrdiff_t,
+					ptrdiff_t, ptrdiff_t,
+					ptrdiff_t, ptrdiff_t);
+extern void forget_charpos_checkpoints (struct buffer *,
+					ptrdiff_t, ptrdiff_t);
 extern ptrdiff_t buf_charpos_to_bytepos (struct buffer *, ptrdiff_t);
 extern ptrdiff_t buf_bytepos_to_charpos (struct buffer *, ptrdiff_t);
 extern void detach_marker (Lisp_Object);
@@ -4514,6 +4587,9 @@ #define DAEMON_RUNNING (w32_daemon_event != INVALID_HANDLE_VALUE)
 
 /* Defined in undo.c.  */
 extern void truncate_undo_list (struct buffer *);
+extern void flush_undo_log (struct buffer *);
+extern void discard_undo_log (struct buffer *);
+extern void mark_undo_log (struct buffer *);
 extern void record_insert (ptrdiff_t, ptrdiff_t);
 extern void record_delete (ptrdiff_t, Lisp_Object, bool);
 extern void record_first_change (void);
@@ -4700,6 +4776,9 @@ maybe_disable_address_randomization (bool dumping, int argc, char **argv)
 /* Defined in profiler.c.  */
 extern bool profiler_memory_running;
 extern void malloc_probe (size_t);
+extern bool profiler_alloc_running;
+extern void alloc_probe (Lisp_Object, Lisp_Object, size_t);
+extern void alloc_probe_survivors (void);
 extern void syms_of_profiler (void);
 
 
@@ -273,8 +273,8 @@ readchar (Lisp_Object readcharfun, bool *multibyte)
 	  bytepos++;
 	}
 
-      XMARKER (readcharfun)->bytepos = bytepos;
-      XMARKER (readcharfun)->charpos++;
+      attach_marker (XMARKER (readcharfun), inbuffer,
+		     marker_charpos (XMARKER (readcharfun)) + 1, bytepos);
 
       return c;
     }
@@ -442,15 +442,15 @@ unreadchar (Lisp_Object readcharfun, int c)
   else if (MARKERP (readcharfun))
     {
       struct buffer *b = XMARKER (readcharfun)->buffer;
-      ptrdiff_t bytepos = XMARKER (readcharfun)->bytepos;
+      ptrdiff_t charpos = marker_charpos (XMARKER (readcharfun));
+      ptrdiff_t bytepos = marker_bytepos (XMARKER (readcharfun));
 
-      XMARKER (readcharfun)->charpos--;
       if (! NILP (BVAR (b, enable_multibyte_characters)))
 	BUF_DEC_POS (b, bytepos);
       else
 	bytepos--;
 
-      XMARKER (readcharfun)->bytepos = bytepos;
+      attach_marker (XMARKER (readcharfun), b, charpos - 1, bytepos);
     }
   else if (STRINGP (readcharfun))
     {
@@ -4316,11 +4316,13 @@ oblookup (Lisp_Object obarray, register const char *ptr, ptrdiff_t size, ptrdiff
   size_t obsize;
   register Lisp_Object tail;
   Lisp_Object bucket, tem;
+  EMACS_UINT name_hash = hash_string (ptr, size_byte);
+  unsigned int short_hash = symbol_name_hash (name_hash);
 
   obarray = check_obarray (obarray);
   /* This is sometimes needed in the middle of GC.  */
   obsize = gc_asize (obarray);
-  hash = hash_string (ptr, size_byte) % obsize;
+  hash = name_hash % obsize;
   bucket = AREF (obarray, hash);
   oblookup_last_bucket_number = hash;
   if (EQ (bucket, make_fixnum (0)))
@@ -4330,7 +4332,8 @@ oblookup (Lisp_Object obarray, register const char *ptr, ptrdiff_t size, ptrdiff
   else
     for (tail = bucket; ; XSETSYMBOL (tail, XSYMBOL (tail)->u.s.next))
       {
-	if (SBYTES (SYMBOL_NAME (tail)) == size_byte
+	if (XSYMBOL (tail)->u.s.name_hash == short_hash
+	    && SBYTES (SYMBOL_NAME (tail)) == size_byte
 	    && SCHARS (SYMBOL_NAME (tail)) == size
 	    && !memcmp (SDATA (SYMBOL_NAME (tail)), ptr, size_byte))
 	  return tail;
@@ -4379,7 +4382,7 @@ DEFUN ("mapatoms", Fmapatoms, Smapatoms, 1, 2, 0,
   return Qnil;
 }
 
-#define OBARRAY_SIZE 15121
+#define OBARRAY_SIZE 65521
 
 void
 init_obarray_once (void)
@@ -20,6 +20,8 @@
 
 #include <config.h>
 
+#include <stdlib.h>
+
 #include "lisp.h"
 #include "character.h"
 #include "buffer.h"
@@ -75,7 +77,859 @@ clear_charpos_cache (struct buffer *b)
   if (cached_buffer == b)
     cached_buffer = 0;
 }
+
+/* The marker index.
+
+   The chain of markers of a buffer text is unordered, so a change to
+   the text has to look at every marker.  When a change finds
+   MARKER_INDEX_MIN markers or more, they are also put in an index
+   that keeps them ordered by position, and the index is freed again
+   when fewer than a quarter of that many markers are left.
+
+   The index is a sequence of blocks of at most MARKER_BLOCK_SIZE
+   markers.  The positions stored in the markers of a block are
+   relative to the position of the block, so a change can move all the
+   markers of a block that follows it just by moving the block, and
+   has to look at individual markers only in the block where the
+   change is.  The index also lets buf_charpos_to_bytepos and
+   buf_bytepos_to_charpos find the markers nearest to a position by
+   binary search, instead of looking through the chain.  */
+
+enum { MARKER_BLOCK_SIZE = 128 };
+enum { MARKER_INDEX_MIN = 256 };
+
+struct marker_block
+{
+  /* The position of this block, which is added to the positions
+     stored in its markers.  */
+  ptrdiff_t charpos, bytepos;
+
+  /* The index of this block in the blocks of its marker index.  */
+  ptrdiff_t index;
+
+  /* The markers of this block, ordered by position.  */
+  int nmarkers;
+  struct Lisp_Marker *markers[MARKER_BLOCK_SIZE];
+};
+
+struct marker_index
+{
+  /* The number of markers in all the blocks.  */
+  ptrdiff_t nmarkers;
+
+  /* The blocks, ordered by position, and the allocated size of
+     BLOCKS.  No block is empty.  */
+  ptrdiff_t nblocks, size;
+  struct marker_block **blocks;
+};
+
+/* Return the character position of marker M, which points somewhere.  */
+
+ptrdiff_t
+marker_charpos (struct Lisp_Marker const *m)
+{
+  return m->block ? m->block->charpos + m->charpos : m->charpos;
+}
+
+/* Return the byte position of marker M, which points somewhere.  */
+
+ptrdiff_t
+marker_bytepos (struct Lisp_Marker const *m)
+{
+  return m->block ? m->block->bytepos + m->bytepos : m->bytepos;
+}
+
+/* Put marker M in block BLK at CHARPOS and BYTEPOS.  This does not
+   change the markers of BLK.  */
+
+static void
+set_block_marker (struct marker_block *blk, struct Lisp_Marker *m,
+		  ptrdiff_t charpos, ptrdiff_t bytepos)
+{
+  m->block = blk;
+  m->charpos = charpos - blk->charpos;
+  m->bytepos = bytepos - blk->bytepos;
+}
+
+/* Return true if marker M is before POS, a byte position if BYTE is
+   true and a character position otherwise.  */
+
+static bool
+marker_precedes (struct Lisp_Marker const *m, ptrdiff_t pos, bool byte)
+{
+  return (byte ? marker_bytepos (m) : marker_charpos (m)) < pos;
+}
+
+/* Store in *K and *I the block and the slot in the block of the first
+   marker of X that is not before POS (see marker_precedes), or
+   X->nblocks and 0 if there is no such marker.  */
+
+static void
+search_marker_index (struct marker_index *x, ptrdiff_t pos, bool byte,
+		     ptrdiff_t *k, int *i)
+{
+  ptrdiff_t lo = 0, hi = x->nblocks;
+
+  while (lo < hi)
+    {
+      ptrdiff_t mid = lo + (hi - lo) / 2;
+      struct marker_block *blk = x->blocks[mid];
+      if (marker_precedes (blk->markers[blk->nmarkers - 1], pos, byte))
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+
+  *k = lo;
+  *i = 0;
+  if (lo < x->nblocks)
+    {
+      struct marker_block *blk = x->blocks[lo];
+      int l = 0, h = blk->nmarkers - 1;
+      while (l < h)
+	{
+	  int mid = l + (h - l) / 2;
+	  if (marker_precedes (blk->markers[mid], pos, byte))
+	    l = mid + 1;
+	  else
+	    h = mid;
+	}
+      *i = l;
+    }
+}
+
+/* Advance the slot *I of block *K of X to the next marker.  */
+
+static void
+next_marker_slot (struct marker_index *x, ptrdiff_t *k, int *i)
+{
+  if (++*i == x->blocks[*k]->nmarkers)
+    {
+      ++*k;
+      *i = 0;
+    }
+}
+
+/* Return the marker of X before slot I of block K, or NULL if there
+   is none.  */
+
+static struct Lisp_Marker *
+previous_marker (struct marker_index *x, ptrdiff_t k, int i)
+{
+  if (i > 0)
+    return x->blocks[k]->markers[i - 1];
+  if (k > 0)
+    {
+      struct marker_block *blk = x->blocks[k - 1];
+      return blk->markers[blk->nmarkers - 1];
+    }
+  return NULL;
+}
+
+/* Insert BLK in X as its block number K.  */
+
+static void
+insert_marker_block (struct marker_index *x, ptrdiff_t k,
+		     struct marker_block *blk)
+{
+  if (x->nblocks == x->size)
+    x->blocks = xpalloc (x->blocks, &x->size, 1, -1, sizeof *x->blocks);
+  memmove (x->blocks + k + 1, x->blocks + k,
+	   (x->nblocks - k) * sizeof *x->blocks);
+  x->blocks[k] = blk;
+  x->nblocks++;
+  for (; k < x->nblocks; k++)
+    x->blocks[k]->index = k;
+}
+
+/* Remove block number K from X, and free it.  */
+
+static void
+delete_marker_block (struct marker_index *x, ptrdiff_t k)
+{
+  xfree (x->blocks[k]);
+  x->nblocks--;
+  memmove (x->blocks + k, x->blocks + k + 1,
+	   (x->nblocks - k) * sizeof *x->blocks);
+  for (; k < x->nblocks; k++)
+    x->blocks[k]->index = k;
+}
+
+/* Return a new empty block at position zero.  */
+
+static struct marker_block *
+make_marker_block (void)
+{
+  struct marker_block *blk = xmalloc (sizeof *blk);
+  blk->charpos = blk->bytepos = 0;
+  blk->nmarkers = 0;
+  return blk;
+}
+
+/* Move the second half of the markers of block K of X to a new block
+   after it.  */
+
+static void
+split_marker_block (struct marker_index *x, ptrdiff_t k)
+{
+  struct marker_block *blk = x->blocks[k];
+  struct marker_block *new = make_marker_block ();
+  int half = blk->nmarkers / 2;
+
+  new->charpos = blk->charpos;
+  new->bytepos = blk->bytepos;
+  new->nmarkers = blk->nmarkers - half;
+  memcpy (new->markers, blk->markers + half,
+	  new->nmarkers * sizeof *new->markers);
+  for (int i = 0; i < new->nmarkers; i++)
+    new->markers[i]->block = new;
+  blk->nmarkers = half;
+  insert_marker_block (x, k + 1, new);
+}
+
+/* Move the markers of block K + 1 of X to the end of block K, and
+   delete block K + 1.  */
+
+static void
+merge_marker_blocks (struct marker_index *x, ptrdiff_t k)
+{
+  struct marker_block *blk = x->blocks[k], *next = x->blocks[k + 1];
+
+  for (int i = 0; i < next->nmarkers; i++)
+    {
+      struct Lisp_Marker *m = next->markers[i];
+      set_block_marker (blk, m, marker_charpos (m), marker_bytepos (m));
+      blk->markers[blk->nmarkers++] = m;
+    }
+  delete_marker_block (x, k + 1);
+}
+
+/* Put marker M in X at CHARPOS and BYTEPOS.  */
+
+static void
+marker_index_insert (struct marker_index *x, struct Lisp_Marker *m,
+		     ptrdiff_t charpos, ptrdiff_t bytepos)
+{
+  ptrdiff_t k;
+  int i;
+  struct marker_block *blk;
+
+  search_marker_index (x, charpos, false, &k, &i);
+  if (k == x->nblocks)
+    {
+      if (k == 0)
+	insert_marker_block (x, 0, make_marker_block ());
+      else
+	i = x->blocks[--k]->nmarkers;
+    }
+
+  blk = x->blocks[k];
+  if (blk->nmarkers == MARKER_BLOCK_SIZE)
+    {
+      split_marker_block (x, k);
+      if (i > blk->nmarkers)
+	{
+	  i -= blk->nmarkers;
+	  blk = x->blocks[k + 1];
+	}
+    }
+
+  memmove (blk->markers + i + 1, blk->markers + i,
+	   (blk->nmarkers - i) * sizeof *blk->markers);
+  blk->markers[i] = m;
+  blk->nmarkers++;
+  set_block_marker (blk, m, charpos, bytepos);
+  x->nmarkers++;
+}
+
+/* Return the slot of marker M in its block.  */
+
+static int
+marker_slot (struct Lisp_Marker const *m)
+{
+  int i = 0;
+  while (m->block->markers[i] != m)
+    i++;
+  return i;
+}
+
+/* Remove marker M from X, leaving its position as it was.  */
+
+static void
+marker_index_remove (struct marker_index *x, struct Lisp_Marker *m)
+{
+  struct marker_block *blk = m->block;
+  int i = marker_slot (m);
+  ptrdiff_t k = blk->index;
+
+  m->charpos += blk->charpos;
+  m->bytepos += blk->bytepos;
+  m->block = NULL;
+  blk->nmarkers--;
+  memmove (blk->markers + i, blk->markers + i + 1,
+	   (blk->nmarkers - i) * sizeof *blk->markers);
+  x->nmarkers--;
+
+  /* Keep the blocks from getting too many and too small.  */
+  if (blk->nmarkers == 0)
+    delete_marker_block (x, k);
+  else if (k + 1 < x->nblocks
+	   && (blk->nmarkers + x->blocks[k + 1]->nmarkers
+	       <= MARKER_BLOCK_SIZE / 2))
+    merge_marker_blocks (x, k);
+  else if (k > 0
+	   && (blk->nmarkers + x->blocks[k - 1]->nmarkers
+	       <= MARKER_BLOCK_SIZE / 2))
+    merge_marker_blocks (x, k - 1);
+}
+
+/* Move marker M of X to CHARPOS and BYTEPOS.  */
+
+static void
+move_indexed_marker (struct marker_index *x, struct Lisp_Marker *m,
+		     ptrdiff_t charpos, ptrdiff_t bytepos)
+{
+  struct marker_block *blk = m->block;
+  ptrdiff_t k = blk->index;
+  int i = marker_slot (m);
+  struct Lisp_Marker *prev = previous_marker (x, k, i);
+  struct Lisp_Marker *next
+    = (i + 1 < blk->nmarkers ? blk->markers[i + 1]
+       : k + 1 < x->nblocks ? x->blocks[k + 1]->markers[0]
+       : NULL);
+
+  /* The marker can usually stay where it is in the index.  */
+  if ((!prev || marker_charpos (prev) <= charpos)
+      && (!next || charpos <= marker_charpos (next)))
+    set_block_marker (blk, m, charpos, bytepos);
+  else
+    {
+      marker_index_remove (x, m);
+      marker_index_insert (x, m, charpos, bytepos);
+    }
+}
+
+/* If marker M, which has just been put in the chain of its buffer,
+   belongs to a buffer text with a marker index, add it to the
+   index.  */
+
+void
+index_marker (struct Lisp_Marker *m)
+{
+  struct marker_index *x = BUF_MARKER_INDEX (m->buffer);
+
+  if (x)
+    marker_index_insert (x, m, m->charpos, m->bytepos);
+}
+
+/* Remove marker M from the marker index of its buffer, if it is in
+   one.  Free the index if only a few markers are left in it.  */
+
+void
+unindex_marker (struct Lisp_Marker *m)
+{
+  if (m->block)
+    {
+      struct marker_index *x = BUF_MARKER_INDEX (m->buffer);
+
+      marker_index_remove (x, m);
+      if (x->nmarkers < MARKER_INDEX_MIN / 4)
+	free_marker_index (m->buffer);
+    }
+}
+
+static int
+compare_marker_positions (void const *a, void const *b)
+{
+  struct Lisp_Marker const *m1 = *(struct Lisp_Marker *const *) a;
+  struct Lisp_Marker const *m2 = *(struct Lisp_Marker *const *) b;
+
+  return (m1->charpos > m2->charpos) - (m1->charpos < m2->charpos);
+}
+
+/* Build a marker index for the text of B, if it has none and
+   NMARKERS, the number of markers that a change to it has just
+   adjusted, is large.  */
+
+void
+maybe_index_markers (struct buffer *b, ptrdiff_t nmarkers)
+{
+  struct buffer_text *text = b->text;
+  struct Lisp_Marker *m;
+  struct Lisp_Marker **v;
+  struct marker_index *x;
+  ptrdiff_t n = 0;
+  /* Leave room in each block for markers to come.  */
+  int per_block = MARKER_BLOCK_SIZE * 3 / 4;
+
+  if (nmarkers < MARKER_INDEX_MIN || text->marker_index)
+    return;
+
+  for (m = text->markers; m; m = m->next)
+    n++;
+  v = xnmalloc (n, sizeof *v);
+  n = 0;
+  for (m = text->markers; m; m = m->next)
+    v[n++] = m;
+  qsort (v, n, sizeof *v, compare_marker_positions);
+
+  x = xzalloc (sizeof *x);
+  for (ptrdiff_t i = 0; i < n; i += per_block)
+    {
+      struct marker_block *blk = make_marker_block ();
+      blk->nmarkers = min (per_block, n - i);
+      memcpy (blk->markers, v + i, blk->nmarkers * sizeof *v);
+      for (int j = 0; j < blk->nmarkers; j++)
+	blk->markers[j]->block = blk;
+      insert_marker_block (x, x->nblocks, blk);
+    }
+  x->nmarkers = n;
+  xfree (v);
+  text->marker_index = x;
+}
+
+/* Free the marker index of the text of B, if it has one.  */
+
+void
+free_marker_index (struct buffer *b)
+{
+  struct marker_index *x = BUF_MARKER_INDEX (b);
+
+  if (x)
+    {
+      for (ptrdiff_t k = 0; k < x->nblocks; k++)
+	{
+	  struct marker_block *blk = x->blocks[k];
+	  for (int i = 0; i < blk->nmarkers; i++)
+	    {
+	      struct Lisp_Marker *m = blk->markers[i];
+	      m->charpos += blk->charpos;
+	      m->bytepos += blk->bytepos;
+	      m->block = NULL;
+	    }
+	  xfree (blk);
+	}
+      xfree (x->blocks);
+      xfree (x);
+      BUF_MARKER_INDEX (b) = NULL;
+    }
+}
+
+/* Move the markers of X from slot I of block K onward by NCHARS and
+   NBYTES.  */
+
+static void
+shift_markers (struct marker_index *x, ptrdiff_t k, int i,
+	       ptrdiff_t nchars, ptrdiff_t nbytes)
+{
+  if (k < x->nblocks && i > 0)
+    {
+      struct marker_block *blk = x->blocks[k++];
+      for (; i < blk->nmarkers; i++)
+	{
+	  blk->markers[i]->charpos += nchars;
+	  blk->markers[i]->bytepos += nbytes;
+	}
+    }
+  for (; k < x->nblocks; k++)
+    {
+      x->blocks[k]->charpos += nchars;
+      x->blocks[k]->bytepos += nbytes;
+    }
+}
+
+/* Adjust the marker index of B for the insertion of NCHARS characters
+   and NBYTES bytes at FROM.  If BEFORE_MARKERS, all the markers at
+   FROM advance, otherwise just those whose insertion type is t.
+   Return true if there were markers of insertion type t at FROM.  */
+
+bool
+adjust_marker_index_for_insert (struct buffer *b, ptrdiff_t from,
+				ptrdiff_t nchars, ptrdiff_t nbytes,
+				bool before_markers)
+{
+  struct marker_index *x = BUF_MARKER_INDEX (b);
+  ptrdiff_t k, w;
+  int i, j;
+  bool advancing = false;
+
+  /* Reorder the markers at FROM so that the ones that advance come
+     last, and find the first of them.  */
+  search_marker_index (x, from, false, &k, &i);
+  w = k, j = i;
+  while (k < x->nblocks)
+    {
+      struct marker_block *blk = x->blocks[k];
+      struct Lisp_Marker *m = blk->markers[i];
+
+      if (marker_charpos (m) != from)
+	break;
+      if (m->insertion_type)
+	advancing = true;
+      else
+	{
+	  if (advancing)
+	    {
+	      /* Swap M with the first advancing marker.  */
+	      struct marker_block *wblk = x->blocks[w];
+	      struct Lisp_Marker *a = wblk->markers[j];
+	      ptrdiff_t bytepos = marker_bytepos (m);
+	      wblk->markers[j] = m;
+	      blk->markers[i] = a;
+	      set_block_marker (wblk, m, from, bytepos);
+	      set_block_marker (blk, a, from, bytepos);
+	    }
+	  next_marker_slot (x, &w, &j);
+	}
+      next_marker_slot (x, &k, &i);
+    }
+
+  if (before_markers)
+    search_marker_index (x, from, false, &w, &j);
+  shift_markers (x, w, j, nchars, nbytes);
+  return advancing;
+}
+
+/* Adjust the marker index of B for the replacement of OLD_CHARS
+   characters and OLD_BYTES bytes at FROM (FROM_BYTE) with NEW_CHARS
+   characters and NEW_BYTES bytes.  The markers inside the replaced
+   text move to FROM, and the markers at its end or after it move
+   with the text.  A deletion is a replacement with nothing.  */
+
+void
+adjust_marker_index_for_replace (struct buffer *b,
+				 ptrdiff_t from, ptrdiff_t from_byte,
+				 ptrdiff_t old_chars, ptrdiff_t old_bytes,
+				 ptrdiff_t new_chars, ptrdiff_t new_bytes)
+{
+  struct marker_index *x = BUF_MARKER_INDEX (b);
+  ptrdiff_t k, end;
+  int i, end_slot;
+
+  search_marker_index (x, from + old_chars, false, &end, &end_slot);
+  if (old_chars > 1)
+    for (search_marker_index (x, from + 1, false, &k, &i);
+	 k < end || (k == end && i < end_slot);
+	 next_marker_slot (x, &k, &i))
+      {
+	struct marker_block *blk = x->blocks[k];
+	set_block_marker (blk, blk->markers[i], from, from_byte);
+      }
+  shift_markers (x, end, end_slot, new_chars - old_chars,
+		 new_bytes - old_bytes);
+}
+
+/* Adjust the byte positions in the marker index of B after text
+   between FROM (FROM_BYTE) and TO was replaced with text of the same
+   number of characters, NBYTES bytes longer than before.  The
+   character positions of the markers stay the same.  */
+
+void
+adjust_marker_index_bytepos (struct buffer *b,
+			     ptrdiff_t from, ptrdiff_t from_byte,
+			     ptrdiff_t to, ptrdiff_t nbytes)
+{
+  struct marker_index *x = BUF_MARKER_INDEX (b);
+  ptrdiff_t k, end;
+  int i, end_slot;
+  ptrdiff_t charpos = from, bytepos = from_byte;
+
+  search_marker_index (x, to, false, &end, &end_slot);
+  for (search_marker_index (x, from + 1, false, &k, &i);
+       k < end || (k == end && i < end_slot);
+       next_marker_slot (x, &k, &i))
+    {
+      struct marker_block *blk = x->blocks[k];
+      struct Lisp_Marker *m = blk->markers[i];
+      ptrdiff_t pos = marker_charpos (m);
+
+      while (charpos < pos)
+	{
+	  charpos++;
+	  BUF_INC_POS (b, bytepos);
+	}
+      set_block_marker (blk, m, pos, bytepos);
+    }
+  shift_markers (x, end, end_slot, 0, nbytes);
+}
+
+/* Call FN with the markers of B whose positions are between FROM and
+   TO, inclusive, and with ARG.  FN must not change any markers.  */
+
+void
+traverse_markers (struct buffer *b, ptrdiff_t from, ptrdiff_t to,
+		  void (*fn) (struct Lisp_Marker *, void *), void *arg)
+{
+  struct marker_index *x = BUF_MARKER_INDEX (b);
+
+  if (x)
+    {
+      ptrdiff_t k;
+      int i;
+      for (search_marker_index (x, from, false, &k, &i);
+	   k < x->nblocks && marker_charpos (x->blocks[k]->markers[i]) <= to;
+	   next_marker_slot (x, &k, &i))
+	fn (x->blocks[k]->markers[i], arg);
+    }
+  else
+    for (struct Lisp_Marker *m = BUF_MARKERS (b); m; m = m->next)
+      if (from <= m->charpos && m->charpos <= to)
+	fn (m, arg);
+}
 
+/* Checkpoints of the correspondence between character and byte
+   positions in a large multibyte buffer text.
+
+   Without them, converting a position far from point, the gap and
+   the markers has to scan the text in between.  The checkpoints are
+   made the first time a conversion needs them, about every
+   CHARPOS_CHECKPOINT_INTERVAL bytes from the beginning of the text up
+   to the position, and the changes to the text keep them up to date.
+   A conversion then has a checkpoint at most that many bytes away,
+   and if the text between the two checkpoints around the position is
+   all ASCII, it needs no scanning at all.
+
+   As with the gap in the text, a change only moves the checkpoints
+   between the previous change and this one: the checkpoints from
+   SPLIT on are stored without the pending offsets DCHARS and DBYTES,
+   which are added when they are read.  */
+
+enum { CHARPOS_CHECKPOINT_INTERVAL = 4096 };
+enum { CHARPOS_CHECKPOINTS_MIN = 64 * 1024 };
+
+struct charpos_checkpoint
+{
+  ptrdiff_t charpos, bytepos;
+};
+
+struct charpos_checkpoints
+{
+  /* The checkpoints, ordered by position, and the allocated size of
+     V.  They cover the text from its beginning up to the last one.  */
+  ptrdiff_t n, size;
+  struct charpos_checkpoint *v;
+
+  /* The checkpoints from V[SPLIT] on are DCHARS characters and DBYTES
+     bytes further into the text than they say.  */
+  ptrdiff_t split, dchars, dbytes;
+};
+
+/* Return the character position of checkpoint I of T.  */
+
+static ptrdiff_t
+checkpoint_charpos (struct charpos_checkpoints const *t, ptrdiff_t i)
+{
+  return t->v[i].charpos + (i < t->split ? 0 : t->dchars);
+}
+
+/* Return the byte position of checkpoint I of T.  */
+
+static ptrdiff_t
+checkpoint_bytepos (struct charpos_checkpoints const *t, ptrdiff_t i)
+{
+  return t->v[i].bytepos + (i < t->split ? 0 : t->dbytes);
+}
+
+/* Return the index of the first checkpoint of T that is not before
+   POS, a byte position if BYTE is true and a character position
+   otherwise, or T->n if there is none.  */
+
+static ptrdiff_t
+search_checkpoints (struct charpos_checkpoints const *t, ptrdiff_t pos,
+		    bool byte)
+{
+  ptrdiff_t lo = 0, hi = t->n;
+
+  while (lo < hi)
+    {
+      ptrdiff_t mid = lo + (hi - lo) / 2;
+      if ((byte ? checkpoint_bytepos (t, mid) : checkpoint_charpos (t, mid))
+	  < pos)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+  return lo;
+}
+
+/* Move the split of T to checkpoint I.  */
+
+static void
+move_checkpoint_split (struct charpos_checkpoints *t, ptrdiff_t i)
+{
+  for (; t->split < i; t->split++)
+    {
+      t->v[t->split].charpos += t->dchars;
+      t->v[t->split].bytepos += t->dbytes;
+    }
+  for (; i < t->split; t->split--)
+    {
+      t->v[t->split - 1].charpos -= t->dchars;
+      t->v[t->split - 1].bytepos -= t->dbytes;
+    }
+  if (t->split == t->n)
+    t->dchars = t->dbytes = 0;
+}
+
+/* Insert into T a checkpoint at CHARPOS and BYTEPOS, which is to be
+   checkpoint I.  */
+
+static void
+insert_checkpoint (struct charpos_checkpoints *t, ptrdiff_t i,
+		   ptrdiff_t charpos, ptrdiff_t bytepos)
+{
+  if (t->n == t->size)
+    t->v = xpalloc (t->v, &t->size, 1, -1, sizeof *t->v);
+  memmove (t->v + i + 1, t->v + i, (t->n - i) * sizeof *t->v);
+  t->n++;
+  if (i < t->split)
+    t->split++;
+  else
+    {
+      charpos -= t->dchars;
+      bytepos -= t->dbytes;
+    }
+  t->v[i].charpos = charpos;
+  t->v[i].bytepos = bytepos;
+}
+
+/* Remove checkpoints I through J - 1 from T.  */
+
+static void
+remove_checkpoints (struct charpos_checkpoints *t, ptrdiff_t i, ptrdiff_t j)
+{
+  move_checkpoint_split (t, i);
+  memmove (t->v + i, t->v + j, (t->n - j) * sizeof *t->v);
+  t->n -= j - i;
+  if (t->split == t->n)
+    t->dchars = t->dbytes = 0;
+}
+
+/* Return the number of characters in the text of B from FROM_BYTE to
+   TO_BYTE, which are at character boundaries.  */
+
+static ptrdiff_t
+count_chars_between (struct buffer *b, ptrdiff_t from_byte, ptrdiff_t to_byte)
+{
+  ptrdiff_t nchars = to_byte - from_byte;
+
+  while (from_byte < to_byte)
+    {
+      /* Look at the bytes up to the gap or TO_BYTE, whichever comes
+	 first.  */
+      ptrdiff_t end = (from_byte < BUF_GPT_BYTE (b)
+		       ? min (to_byte, BUF_GPT_BYTE (b)) : to_byte);
+      unsigned char const *p = BUF_BYTE_ADDRESS (b, from_byte);
+      unsigned char const *pend = p + (end - from_byte);
+      for (; p < pend; p++)
+	nchars -= !CHAR_HEAD_P (*p);
+      from_byte = end;
+    }
+  return nchars;
+}
+
+/* Return the checkpoints of the text of B, making them if there are
+   none, or NULL if the text is too small to need them.  */
+
+static struct charpos_checkpoints *
+charpos_checkpoints (struct buffer *b)
+{
+  struct charpos_checkpoints *t = b->text->charpos_checkpoints;
+
+  if (!t && BUF_Z_BYTE (b) - BUF_BEG_BYTE (b) >= CHARPOS_CHECKPOINTS_MIN)
+    t = b->text->charpos_checkpoints = xzalloc (sizeof *t);
+  return t;
+}
+
+/* Add checkpoints to T, which belongs to the text of B, until there
+   is one at or after POS or the end of the text is near.  POS is a
+   byte position if BYTE is true and a character position
+   otherwise.  */
+
+static void
+extend_checkpoints (struct charpos_checkpoints *t, struct buffer *b,
+		    ptrdiff_t pos, bool byte)
+{
+  ptrdiff_t charpos = BUF_BEG (b), bytepos = BUF_BEG_BYTE (b);
+
+  if (t->n)
+    {
+      charpos = checkpoint_charpos (t, t->n - 1);
+      bytepos = checkpoint_bytepos (t, t->n - 1);
+    }
+
+  while ((byte ? bytepos : charpos) < pos
+	 && bytepos + CHARPOS_CHECKPOINT_INTERVAL < BUF_Z_BYTE (b))
+    {
+      ptrdiff_t next = bytepos + CHARPOS_CHECKPOINT_INTERVAL;
+      while (!CHAR_HEAD_P (BUF_FETCH_BYTE (b, next)))
+	next++;
+      charpos += count_chars_between (b, bytepos, next);
+      bytepos = next;
+      insert_checkpoint (t, t->n, charpos, bytepos);
+    }
+}
+
+/* Free the checkpoints of the text of B, if it has any.  */
+
+void
+free_charpos_checkpoints (struct buffer *b)
+{
+  struct charpos_checkpoints *t = b->text->charpos_checkpoints;
+
+  if (t)
+    {
+      xfree (t->v);
+      xfree (t);
+      b->text->charpos_checkpoints = NULL;
+    }
+}
+
+/* Adjust the checkpoints of the text of B for the replacement of
+   OLD_CHARS characters and OLD_BYTES bytes at FROM (FROM_BYTE) with
+   NEW_CHARS characters and NEW_BYTES bytes.  An insertion replaces
+   nothing, and a deletion inserts nothing.  */
+
+void
+adjust_charpos_checkpoints (struct buffer *b,
+			    ptrdiff_t from, ptrdiff_t from_byte,
+			    ptrdiff_t old_chars, ptrdiff_t old_bytes,
+			    ptrdiff_t new_chars, ptrdiff_t new_bytes)
+{
+  struct charpos_checkpoints *t = b->text->charpos_checkpoints;
+
+  if (t)
+    {
+      /* The checkpoints inside the old text go, and the ones after
+	 it move with the text.  */
+      ptrdiff_t i = search_checkpoints (t, from_byte + 1, true);
+      ptrdiff_t j = search_checkpoints (t, from_byte + old_bytes, true);
+      remove_checkpoints (t, i, max (i, j));
+      if (i < t->n)
+	{
+	  t->dchars += new_chars - old_chars;
+	  t->dbytes += new_bytes - old_bytes;
+	}
+    }
+}
+
+/* Forget the checkpoints of the text of B between FROM_BYTE and
+   TO_BYTE, exclusive, after the text there changed in place.  */
+
+void
+forget_charpos_checkpoints (struct buffer *b,
+			    ptrdiff_t from_byte, ptrdiff_t to_byte)
+{
+  struct charpos_checkpoints *t = b->text->charpos_checkpoints;
+
+  if (t)
+    {
+      ptrdiff_t i = search_checkpoints (t, from_byte + 1, true);
+      ptrdiff_t j = search_checkpoints (t, to_byte, true);
+      remove_checkpoints (t, i, max (i, j));
+    }
+}
+
 /* Converting between character positions and byte positions.  */
 
 /* There are several places in the buffer where we know
@@ -151,7 +1005,9 @@ CHECK_MARKER (Lisp_Object x)
    worst case and it was rarely slower and never by much.
 
    The asymptotic behavior is still poor, tho, so in largish buffers with many
-   overlays (e.g. 300KB and 30K overlays), it can still be a bottleneck.  */
+   overlays (e.g. 300KB and 30K overlays), it can still be a bottleneck.
+   That is why, when the buffer text has a marker index, we look just
+   at the two markers around the position in it instead.  */
 #define BYTECHAR_DISTANCE_INITIAL 50
 #define BYTECHAR_DISTANCE_INCREMENT 50
 
@@ -161,6 +1017,7 @@ #define BYTECHAR_DISTANCE_INCREMENT 50
 buf_charpos_to_bytepos (struct buffer *b, ptrdiff_t charpos)
 {
   struct Lisp_Marker *tail;
+  struct charpos_checkpoints *t;
   ptrdiff_t best_above, best_above_byte;
   ptrdiff_t best_below, best_below_byte;
   ptrdiff_t distance = BYTECHAR_DISTANCE_INITIAL;
@@ -196,19 +1053,50 @@ buf_charpos_to_bytepos (struct buffer *b, ptrdiff_t charpos)
   if (b == cached_buffer && BUF_MODIFF (b) == cached_modiff)
     CONSIDER (cached_charpos, cached_bytepos);
 
-  for (tail = BUF_MARKERS (b); tail; tail = tail->next)
+  t = charpos_checkpoints (b);
+  if (t)
     {
-      CONSIDER (tail->charpos, tail->bytepos);
+      ptrdiff_t i;
+      extend_checkpoints (t, b, charpos, false);
+      i = search_checkpoints (t, charpos, false);
+      if (i < t->n)
+	CONSIDER (checkpoint_charpos (t, i), checkpoint_bytepos (t, i));
+      if (i > 0)
+	CONSIDER (checkpoint_charpos (t, i - 1),
+		  checkpoint_bytepos (t, i - 1));
+    }
 
-      /* If we are down to a range of 50 chars,
-	 don't bother checking any other markers;
-	 scan the intervening chars directly now.  */
-      if (best_above - charpos < distance
-          || charpos - best_below < distance)
-	break;
-      else
-        distance += BYTECHAR_DISTANCE_INCREMENT;
+  if (BUF_MARKER_INDEX (b))
+    {
+      /* The markers nearest CHARPOS are next to each other in the
+	 index.  */
+      struct marker_index *x = BUF_MARKER_INDEX (b);
+      ptrdiff_t k;
+      int i;
+      search_marker_index (x, charpos, false, &k, &i);
+      if (k < x->nblocks)
+	{
+	  tail = x->blocks[k]->markers[i];
+	  CONSIDER (marker_charpos (tail), marker_bytepos (tail));
+	}
+      tail = previous_marker (x, k, i);
+      if (tail)
+	CONSIDER (marker_charpos (tail), marker_bytepos (tail));
     }
+  else if (!t)
+    for (tail = BUF_MARKERS (b); tail; tail = tail->next)
+      {
+	CONSIDER (tail->charpos, tail->bytepos);
+
+	/* If we are down to a range of 50 chars,
+	   don't bother checking any other markers;
+	   scan the intervening chars directly now.  */
+	if (best_above - charpos < distance
+	    || charpos - best_below < distance)
+	  break;
+	else
+	  distance += BYTECHAR_DISTANCE_INCREMENT;
+      }
 
   /* We get here if we did not exactly hit one of the known places.
      We have one known above and one known below.
@@ -225,9 +1113,12 @@ buf_charpos_to_bytepos (struct buffer *b, ptrdiff_t charpos)
 	}
 
       /* If this position is quite far from the nearest known position,
-	 cache the correspondence by creating a marker here.
-	 It will last until the next GC.  */
-      if (record)
+	 cache the correspondence by creating a checkpoint here, or a
+	 marker that will last until the next GC.  */
+      if (record && t)
+	insert_checkpoint (t, search_checkpoints (t, best_below, false),
+			   best_below, best_below_byte);
+      else if (record)
 	build_marker (b, best_below, best_below_byte);
 
       byte_char_debug_check (b, best_below, best_below_byte);
@@ -250,9 +1141,12 @@ buf_charpos_to_bytepos (struct buffer *b, ptrdiff_t charpos)
 	}
 
       /* If this position is quite far from the nearest known position,
-	 cache the correspondence by creating a marker here.
-	 It will last until the next GC.  */
-      if (record)
+	 cache the correspondence by creating a checkpoint here, or a
+	 marker that will last until the next GC.  */
+      if (record && t)
+	insert_checkpoint (t, search_checkpoints (t, best_above, false),
+			   best_above, best_above_byte);
+      else if (record)
 	build_marker (b, best_above, best_above_byte);
 
       byte_char_debug_check (b, best_above, best_above_byte);
@@ -317,6 +1211,7 @@ #define CONSIDER(BYTEPOS, CHARPOS)					\
 buf_bytepos_to_charpos (struct buffer *b, ptrdiff_t bytepos)
 {
   struct Lisp_Marker *tail;
+  struct charpos_checkpoints *t;
   ptrdiff_t best_above, best_above_byte;
   ptrdiff_t best_below, best_below_byte;
   ptrdiff_t distance = BYTECHAR_DISTANCE_INITIAL;
@@ -347,19 +1242,48 @@ buf_bytepos_to_charpos (struct buffer *b, ptrdiff_t bytepos)
   if (b == cached_buffer && BUF_MODIFF (b) == cached_modiff)
     CONSIDER (cached_bytepos, cached_charpos);
 
-  for (tail = BUF_MARKERS (b); tail; tail = tail->next)
+  t = charpos_checkpoints (b);
+  if (t)
     {
-      CONSIDER (tail->bytepos, tail->charpos);
+      ptrdiff_t i;
+      extend_checkpoints (t, b, bytepos, true);
+      i = search_checkpoints (t, bytepos, true);
+      if (i < t->n)
+	CONSIDER (checkpoint_bytepos (t, i), checkpoint_charpos (t, i));
+      if (i > 0)
+	CONSIDER (checkpoint_bytepos (t, i - 1),
+		  checkpoint_charpos (t, i - 1));
+    }
 
-      /* If we are down to a range of 50 chars,
-	 don't bother checking any other markers;
-	 scan the intervening chars directly now.  */
-      if (best_above - bytepos < distance
-          || bytepos - best_below < distance)
-	break;
-      else
-        distance += BYTECHAR_DISTANCE_INCREMENT;
+  if (BUF_MARKER_INDEX (b))
+    {
+      struct marker_index *x = BUF_MARKER_INDEX (b);
+      ptrdiff_t k;
+      int i;
+      search_marker_index (x, bytepos, true, &k, &i);
+      if (k < x->nblocks)
+	{
+	  tail = x->blocks[k]->markers[i];
+	  CONSIDER (marker_bytepos (tail), marker_charpos (tail));
+	}
+      tail = previous_marker (x, k, i);
+      if (tail)
+	CONSIDER (marker_bytepos (tail), marker_charpos (tail));
     }
+  else if (!t)
+    for (tail = BUF_MARKERS (b); tail; tail = tail->next)
+      {
+	CONSIDER (tail->bytepos, tail->charpos);
+
+	/* If we are down to a range of 50 chars,
+	   don't bother checking any other markers;
+	   scan the intervening chars directly now.  */
+	if (best_above - bytepos < distance
+	    || bytepos - best_below < distance)
+	  break;
+	else
+	  distance += BYTECHAR_DISTANCE_INCREMENT;
+      }
 
   /* We get here if we did not exactly hit one of the known places.
      We have one known above and one known below.
@@ -376,11 +1300,14 @@ buf_bytepos_to_charpos (struct buffer *b, ptrdiff_t bytepos)
 	}
 
       /* If this position is quite far from the nearest known position,
-	 cache the correspondence by creating a marker here.
-	 It will last until the next GC.
-	 But don't do it if BUF_MARKERS is nil;
+	 cache the correspondence by creating a checkpoint here, or a
+	 marker that will last until the next GC.
+	 But don't make a marker if BUF_MARKERS is nil;
 	 that is a signal from Fset_buffer_multibyte.  */
-      if (record && BUF_MARKERS (b))
+      if (record && t)
+	insert_checkpoint (t, search_checkpoints (t, best_below, false),
+			   best_below, best_below_byte);
+      else if (record && BUF_MARKERS (b))
 	build_marker (b, best_below, best_below_byte);
 
       byte_char_debug_check (b, best_below, best_below_byte);
@@ -403,11 +1330,14 @@ buf_bytepos_to_charpos (struct buffer *b, ptrdiff_t bytepos)
 	}
 
       /* If this position is quite far from the nearest known position,
-	 cache the correspondence by creating a marker here.
-	 It will last until the next GC.
-	 But don't do it if BUF_MARKERS is nil;
+	 cache the correspondence by creating a checkpoint here, or a
+	 marker that will last until the next GC.
+	 But don't make a marker if BUF_MARKERS is nil;
 	 that is a signal from Fset_buffer_multibyte.  */
-      if (record && BUF_MARKERS (b))
+      if (record && t)
+	insert_checkpoint (t, search_checkpoints (t, best_above, false),
+			   best_above, best_above_byte);
+      else if (record && BUF_MARKERS (b))
 	build_marker (b, best_above, best_above_byte);
 
       byte_char_debug_check (b, best_above, best_above_byte);
@@ -451,14 +1381,14 @@ DEFUN ("marker-position", Fmarker_position, Smarker_position, 1, 1, 0,
 {
   CHECK_MARKER (marker);
   if (XMARKER (marker)->buffer)
-    return make_fixnum (XMARKER (marker)->charpos);
+    return make_fixnum (marker_charpos (XMARKER (marker)));
 
   return Qnil;
 }
 
 /* Change M so it points to B at CHARPOS and BYTEPOS.  */
 
-static void
+void
 attach_marker (struct Lisp_Marker *m, struct buffer *b,
 	       ptrdiff_t charpos, ptrdiff_t bytepos)
 {
@@ -469,16 +1399,31 @@ attach_marker (struct Lisp_Marker *m, struct buffer *b,
   else
     eassert (charpos <= bytepos);
 
-  m->charpos = charpos;
-  m->bytepos = bytepos;
+  /* Moving a bound of an overlay can disorder its buffer's overlay
+     tree, so take the overlay out of the tree meanwhile.  */
+  struct Lisp_Overlay *ov
+    = m->overlay_bound ? unlink_marker_overlay (m) : NULL;
 
   if (m->buffer != b)
     {
       unchain_marker (m);
+      m->charpos = charpos;
+      m->bytepos = bytepos;
       m->buffer = b;
       m->next = BUF_MARKERS (b);
       BUF_MARKERS (b) = m;
+      index_marker (m);
     }
+  else if (m->block)
+    move_indexed_marker (BUF_MARKER_INDEX (b), m, charpos, bytepos);
+  else
+    {
+      m->charpos = charpos;
+      m->bytepos = bytepos;
+    }
+
+  if (ov)
+    relink_overlay (ov);
 }
 
 /* If BUFFER is nil, return current buffer pointer.  Next, check
@@ -516,10 +1461,8 @@ set_marker_internal (Lisp_Object marker, Lisp_Object position,
      an existing marker, and MARKER is already in the same buffer.  */
   else if (MARKERP (position) && b == XMARKER (position)->buffer
 	   && b == m->buffer)
-    {
-      m->bytepos = XMARKER (position)->bytepos;
-      m->charpos = XMARKER (position)->charpos;
-    }
+    attach_marker (m, b, marker_charpos (XMARKER (position)),
+		   marker_bytepos (XMARKER (position)));
 
   else
     {
@@ -532,8 +1475,8 @@ set_marker_internal (Lisp_Object marker, Lisp_Object position,
 	charpos = XFIXNUM (position), bytepos = -1;
       else if (MARKERP (position))
 	{
-	  charpos = XMARKER (position)->charpos;
-	  bytepos = XMARKER (position)->bytepos;
+	  charpos = marker_charpos (XMARKER (position));
+	  bytepos = marker_bytepos (XMARKER (position));
 	}
       else
 	wrong_type_argument (Qinteger_or_marker_p, position);
@@ -646,6 +1589,10 @@ unchain_marker (register struct Lisp_Marker *marker)
       /* No dead buffers here.  */
       eassert (BUFFER_LIVE_P (b));
 
+      /* An overlay cannot stay in the tree without its bound.  */
+      if (marker->overlay_bound)
+	unlink_marker_overlay (marker);
+      unindex_marker (marker);
       marker->buffer = NULL;
       prev = &BUF_MARKERS (b);
 
@@ -683,9 +1630,10 @@ marker_position (Lisp_Object marker)
   if (!buf)
     error ("Marker does not point anywhere");
 
-  eassert (BUF_BEG (buf) <= m->charpos && m->charpos <= BUF_Z (buf));
+  ptrdiff_t charpos = marker_charpos (m);
+  eassert (BUF_BEG (buf) <= charpos && charpos <= BUF_Z (buf));
 
-  return m->charpos;
+  return charpos;
 }
 
 /* Return the byte position of marker MARKER, as a C integer.  */
@@ -699,9 +1647,10 @@ marker_byte_position (Lisp_Object marker)
   if (!buf)
     error ("Marker does not point anywhere");
 
-  eassert (BUF_BEG_BYTE (buf) <= m->bytepos && m->bytepos <= BUF_Z_BYTE (buf));
+  ptrdiff_t bytepos = marker_bytepos (m);
+  eassert (BUF_BEG_BYTE (buf) <= bytepos && bytepos <= BUF_Z_BYTE (buf));
 
-  return m->bytepos;
+  return bytepos;
 }
 
 DEFUN ("copy-marker", Fcopy_marker, Scopy_marker, 0, 2, 0,
@@ -758,6 +1707,17 @@ DEFUN ("buffer-has-markers-at", Fbuffer_has_markers_at, Sbuffer_has_markers_at,
 
   charpos = clip_to_bounds (BEG, XFIXNUM (position), Z);
 
+  if (BUF_MARKER_INDEX (current_buffer))
+    {
+      struct marker_index *x = BUF_MARKER_INDEX (current_buffer);
+      ptrdiff_t k;
+      int i;
+      search_marker_index (x, charpos, false, &k, &i);
+      return (k < x->nblocks
+	      && marker_charpos (x->blocks[k]->markers[i]) == charpos
+	      ? Qt : Qnil);
+    }
+
   for (tail = BUF_MARKERS (current_buffer); tail; tail = tail->next)
     if (tail->charpos == charpos)
       return Qt;
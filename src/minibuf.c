@@ -658,6 +658,7 @@ read_minibuf (Lisp_Object map, Lisp_Object initial, Lisp_Object prompt,
   run_hook (Qminibuffer_setup_hook);
 
   /* Don't allow the user to undo past this point.  */
+  discard_undo_log (current_buffer);
   bset_undo_list (current_buffer, Qnil);
 
   recursive_edit_1 ();
@@ -738,7 +739,7 @@ get_minibuffer (EMACS_INT depth)
   else
     {
       ptrdiff_t count = SPECPDL_INDEX ();
-      /* We have to empty both overlay lists.  Otherwise we end
+      /* We have to empty the overlay tree.  Otherwise we end
 	 up with overlays that think they belong to this buffer
 	 while the buffer doesn't know about them any more.  */
       delete_all_overlays (XBUFFER (buf));
@@ -74,6 +74,21 @@ make_log (void)
   return log;
 }
 
+/* Prepare LOG to be returned to Lisp.  Its unused entries still hold
+   the pre-filled vectors, which `maphash' would take for keys.  */
+
+static Lisp_Object
+export_log (Lisp_Object log)
+{
+  if (HASH_TABLE_P (log))
+    {
+      struct Lisp_Hash_Table *h = XHASH_TABLE (log);
+      for (ptrdiff_t i = h->next_free; 0 <= i; i = XFIXNUM (AREF (h->next, i)))
+	set_hash_key_slot (h, i, Qunbound);
+    }
+  return log;
+}
+
 /* Evict the least used half of the hash_table.
 
    When the table is full, we have to evict someone.
@@ -142,22 +157,27 @@ make_log (void)
       }
 }
 
-/* Record the current backtrace in LOG.  COUNT is the weight of this
-   current backtrace: interrupt counts for CPU, and the allocation
-   size for memory.  */
+/* Return the "working memory" vector of LOG, making room for a new
+   entry first if LOG is full.  */
 
-static void
-record_backtrace (log_t *log, EMACS_INT count)
+static Lisp_Object
+log_working_backtrace (log_t *log)
 {
   if (log->next_free < 0)
     /* FIXME: transfer the evicted counts to a special entry rather
        than dropping them on the floor.  */
     evict_lower_half (log);
-  ptrdiff_t index = log->next_free;
+  return HASH_KEY (log, log->next_free);
+}
+
+/* Add COUNT to the entry of LOG for the backtrace that was just stored
+   in its working memory vector.  */
 
-  /* Get a "working memory" vector.  */
+static void
+record_working_backtrace (log_t *log, EMACS_INT count)
+{
+  ptrdiff_t index = log->next_free;
   Lisp_Object backtrace = HASH_KEY (log, index);
-  get_backtrace (backtrace);
 
   { /* We basically do a `gethash+puthash' here, except that we have to be
        careful to avoid memory allocation since we're in a signal
@@ -175,6 +195,8 @@ record_backtrace (log_t *log, EMACS_INT count)
       { /* BEWARE!  hash_put in general can allocate memory.
 	   But currently it only does that if log->next_free is -1.  */
 	eassert (0 <= log->next_free);
+	/* hash_put expects the free entry to hold no key.  */
+	set_hash_key_slot (log, index, Qunbound);
 	ptrdiff_t j = hash_put (log, backtrace, make_fixnum (count), hash);
 	/* Let's make sure we've put `backtrace' right where it
 	   already was to start with.  */
@@ -197,6 +219,17 @@ record_backtrace (log_t *log, EMACS_INT count)
       }
   }
 }
+
+/* Record the current backtrace in LOG.  COUNT is the weight of this
+   current backtrace: interrupt counts for CPU, and the allocation
+   size for memory.  */
+
+static void
+record_backtrace (log_t *log, EMACS_INT count)
+{
+  get_backtrace (log_working_backtrace (log));
+  record_working_backtrace (log, count);
+}
 
 /* Sampling profiler.  */
 
@@ -419,8 +452,11 @@ DEFUN ("profiler-cpu-log", Fprofiler_cpu_log, Sprofiler_cpu_log,
   Lisp_Object result = cpu_log;
   /* Here we're making the log visible to Elisp, so it's not safe any
      more for our use afterwards since we can't rely on its special
-     pre-allocated keys anymore.  So we have to allocate a new one.  */
+     pre-allocated keys anymore.  So we have to allocate a new one.
+     Do that before exporting the old one, which a signal may still
+     record a sample into meanwhile.  */
   cpu_log = profiler_cpu_running ? make_log () : Qnil;
+  export_log (result);
   Fputhash (make_vector (1, QAutomatic_GC),
 	    make_fixnum (cpu_gc_count),
 	    result);
@@ -491,9 +527,10 @@ DEFUN ("profiler-memory-log",
   Lisp_Object result = memory_log;
   /* Here we're making the log visible to Elisp , so it's not safe any
      more for our use afterwards since we can't rely on its special
-     pre-allocated keys anymore.  So we have to allocate a new one.  */
+     pre-allocated keys anymore.  So we have to allocate a new one,
+     before exporting the old one as its allocation is sampled.  */
   memory_log = profiler_memory_running ? make_log () : Qnil;
-  return result;
+  return export_log (result);
 }
 
 
@@ -503,10 +540,177 @@ DEFUN ("profiler-memory-log",
 void
 malloc_probe (size_t size)
 {
+  if (EQ (backtrace_top_function (), QAutomatic_GC))
+    /* The GC allocates its mark stack, and the hash-table code can't
+       be used while it runs; see handle_profiler_signal.  */
+    return;
   eassert (HASH_TABLE_P (memory_log));
   record_backtrace (XHASH_TABLE (memory_log), min (size, MOST_POSITIVE_FIXNUM));
 }
 
+/* Allocation profiler.  */
+
+/* True if the allocation profiler is running.  */
+bool profiler_alloc_running;
+
+/* Logs of the bytes allocated, and of the bytes that survived a
+   garbage collection.  Their backtraces start with the type of the
+   objects allocated.  */
+static Lisp_Object alloc_log, alloc_survival_log;
+
+/* A key-weak hash table mapping sampled objects to (WEIGHT
+   . BACKTRACE), so that the survivors can be counted after the next
+   garbage collection.  */
+static Lisp_Object alloc_samples;
+
+/* Number of bytes allocated between samples, and since the last one.  */
+static EMACS_INT alloc_sampling_interval, alloc_since_sample;
+
+/* True while a sample is being recorded, so that the allocations made
+   for it are not sampled themselves.  */
+static bool alloc_probe_active;
+
+DEFUN ("profiler-alloc-start", Fprofiler_alloc_start, Sprofiler_alloc_start,
+       1, 1, 0,
+       doc: /* Start/restart the allocation profiler.
+The allocation profiler takes a sample of the call-stack about every
+SAMPLING-INTERVAL bytes of conses, floats, strings, vectors and
+intervals allocated, recording the type of the object allocated at that
+point, and checks at the next garbage collection whether the object
+survived it.
+See also `profiler-log-size' and `profiler-max-stack-depth'.  */)
+  (Lisp_Object sampling_interval)
+{
+  if (profiler_alloc_running)
+    error ("Allocation profiler is already running");
+  CHECK_FIXNAT (sampling_interval);
+
+  if (NILP (alloc_log))
+    {
+      alloc_log = make_log ();
+      alloc_survival_log = make_log ();
+    }
+  if (NILP (alloc_samples))
+    alloc_samples = make_hash_table (hashtest_eq, DEFAULT_HASH_SIZE,
+				     DEFAULT_REHASH_SIZE,
+				     DEFAULT_REHASH_THRESHOLD,
+				     Qkey, false);
+
+  alloc_sampling_interval = max (XFIXNAT (sampling_interval), 1);
+  alloc_since_sample = 0;
+  profiler_alloc_running = true;
+
+  return Qt;
+}
+
+DEFUN ("profiler-alloc-stop",
+       Fprofiler_alloc_stop, Sprofiler_alloc_stop,
+       0, 0, 0,
+       doc: /* Stop the allocation profiler.  The profiler log is not affected.
+Return non-nil if the profiler was running.  */)
+  (void)
+{
+  if (!profiler_alloc_running)
+    return Qnil;
+  profiler_alloc_running = false;
+  alloc_samples = Qnil;
+  return Qt;
+}
+
+DEFUN ("profiler-alloc-running-p",
+       Fprofiler_alloc_running_p, Sprofiler_alloc_running_p,
+       0, 0, 0,
+       doc: /* Return non-nil if the allocation profiler is running.  */)
+  (void)
+{
+  return profiler_alloc_running ? Qt : Qnil;
+}
+
+DEFUN ("profiler-alloc-log",
+       Fprofiler_alloc_log, Sprofiler_alloc_log,
+       0, 0, 0,
+       doc: /* Return the current allocation profiler logs.
+The value is a list (ALLOCATED SURVIVED) of two hash-tables mapping
+backtraces to the number of bytes allocated at those points, and to
+the number of those bytes whose objects survived a garbage collection.
+Every backtrace is a vector whose first element is the type of the
+objects allocated, `conses', `floats', `strings', `vectors' or
+`intervals', followed by functions, where the last few elements may be
+nil.  Intervals are not checked for survival.
+Before returning, new logs are allocated for future samples.  */)
+  (void)
+{
+  Lisp_Object log = alloc_log, survival_log = alloc_survival_log;
+  /* Here we're making the logs visible to Elisp, so we have to
+     allocate new ones, like `profiler-memory-log'.  */
+  if (profiler_alloc_running)
+    {
+      /* Do not sample the allocation of the new logs into the old.  */
+      alloc_probe_active = true;
+      alloc_log = make_log ();
+      alloc_survival_log = make_log ();
+      alloc_probe_active = false;
+    }
+  else
+    alloc_log = alloc_survival_log = Qnil;
+  return list2 (export_log (log), export_log (survival_log));
+}
+
+/* Record that the current backtrace allocated OBJ of TYPE, taking
+   SIZE bytes.  OBJ is nil if it cannot be checked for survival.  */
+
+void
+alloc_probe (Lisp_Object type, Lisp_Object obj, size_t size)
+{
+  alloc_since_sample = saturated_add (alloc_since_sample,
+				      min (size, MOST_POSITIVE_FIXNUM));
+  if (alloc_since_sample < alloc_sampling_interval || alloc_probe_active)
+    return;
+
+  EMACS_INT weight = alloc_since_sample;
+  alloc_since_sample = 0;
+  alloc_probe_active = true;
+
+  /* Store TYPE in the innermost frame, followed by the backtrace.  */
+  log_t *log = XHASH_TABLE (alloc_log);
+  Lisp_Object backtrace = log_working_backtrace (log);
+  get_backtrace (backtrace);
+  for (ptrdiff_t i = ASIZE (backtrace) - 1; 0 < i; i--)
+    ASET (backtrace, i, AREF (backtrace, i - 1));
+  ASET (backtrace, 0, type);
+
+  if (!NILP (obj))
+    Fputhash (obj, Fcons (make_fixnum (weight), Fcopy_sequence (backtrace)),
+	      alloc_samples);
+  record_working_backtrace (log, weight);
+
+  alloc_probe_active = false;
+}
+
+/* After a garbage collection, record the sampled objects that
+   survived it, and stop tracking them.  */
+
+void
+alloc_probe_survivors (void)
+{
+  struct Lisp_Hash_Table *h = XHASH_TABLE (alloc_samples);
+  log_t *log = XHASH_TABLE (alloc_survival_log);
+
+  alloc_probe_active = true;
+  for (ptrdiff_t i = 0; i < HASH_TABLE_SIZE (h); i++)
+    if (!EQ (HASH_KEY (h, i), Qunbound))
+      {
+	Lisp_Object sample = HASH_VALUE (h, i);
+	Lisp_Object saved = XCDR (sample);
+	Lisp_Object backtrace = log_working_backtrace (log);
+	for (ptrdiff_t j = 0; j < ASIZE (backtrace); j++)
+	  ASET (backtrace, j, j < ASIZE (saved) ? AREF (saved, j) : Qnil);
+	record_working_backtrace (log, XFIXNUM (XCAR (sample)));
+      }
+  Fclrhash (alloc_samples);
+  alloc_probe_active = false;
+}
+
 DEFUN ("function-equal", Ffunction_equal, Sfunction_equal, 2, 2, 0,
        doc: /* Return non-nil if F1 and F2 come from the same source.
 Used to determine if different closures are just different instances of
@@ -604,6 +808,16 @@ syms_of_profiler (void)
   defsubr (&Sprofiler_memory_running_p);
   defsubr (&Sprofiler_memory_log);
 
+  profiler_alloc_running = false;
+  alloc_log = alloc_survival_log = alloc_samples = Qnil;
+  staticpro (&alloc_log);
+  staticpro (&alloc_survival_log);
+  staticpro (&alloc_samples);
+  defsubr (&Sprofiler_alloc_start);
+  defsubr (&Sprofiler_alloc_stop);
+  defsubr (&Sprofiler_alloc_running_p);
+  defsubr (&Sprofiler_alloc_log);
+
   pdumper_do_now_and_after_load (syms_of_profiler_for_pdumper);
 }
 
@@ -616,6 +830,7 @@ syms_of_profiler_for_pdumper (void)
       cpu_log = Qnil;
 #endif
       memory_log = Qnil;
+      alloc_log = alloc_survival_log = alloc_samples = Qnil;
     }
   else
     {
@@ -623,6 +838,7 @@ syms_of_profiler_for_pdumper (void)
       eassert (NILP (cpu_log));
 #endif
       eassert (NILP (memory_log));
+      eassert (NILP (alloc_log));
     }
 
 }
@@ -0,0 +1,993 @@
+/* Timsort for sequences.
+
+Copyright 2019 Free Software Foundation, Inc.
+
+This file is part of GNU Emacs.
+
+GNU Emacs is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or (at
+your option) any later version.
+
+GNU Emacs is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* This is an adaptation of the TimSort implementation in CPython
+   (Objects/listobject.c), whose design is described at length in
+   Objects/listsort.txt there.  In short: the input is split into
+   maximal runs that are already ascending or strictly descending
+   (the latter are reversed in place, which keeps the sort stable),
+   short runs are extended with a binary insertion sort, and runs are
+   merged pairwise under invariants that keep the pending-run stack
+   logarithmically small.  When one run keeps winning during a merge
+   the merge switches to "galloping", an exponential search, so that
+   partially ordered input costs far fewer than N log N comparisons.
+
+   Unlike in CPython the comparison function can exit nonlocally.
+   The merge loops therefore publish where their not yet merged
+   elements live, so that an unwind handler can put every element back
+   into the sequence if PREDICATE signals or throws.  */
+
+#include <config.h>
+
+#include "lisp.h"
+
+/* MAX_MERGE_PENDING is the maximum number of entries in the
+   pending-runs stack.  The merge invariants make the run lengths grow
+   at least as fast as the Fibonacci numbers, so 85 entries suffice
+   for any sequence that fits in memory on a 64-bit host.  */
+enum { MAX_MERGE_PENDING = 85 };
+
+/* Once we get into galloping mode, we stay there as long as both runs
+   win at least MIN_GALLOP times in a row.  */
+enum { MIN_GALLOP = 7 };
+
+/* Runs shorter than this are extended by binary insertion sort; see
+   merge_compute_minrun.  */
+enum { MIN_MERGE = 64 };
+
+/* A stretch of the sequence being sorted.  KEYS are the objects passed
+   to the predicate; VALUES, if non-null, are the corresponding
+   elements of the sequence and move in lockstep with KEYS.  */
+
+typedef struct
+{
+  Lisp_Object *keys;
+  Lisp_Object *values;
+} sortslice;
+
+/* A pending run, starting at BASE and LEN elements long.  */
+
+struct stretch
+{
+  sortslice base;
+  ptrdiff_t len;
+};
+
+/* Where the merge in progress keeps the elements it has not yet
+   written back.  If ORDER is nonzero, the *SIZE elements at *SRC belong
+   at *DST, or ending at *DST if ORDER is negative.  */
+
+struct reloc
+{
+  sortslice *src;
+  sortslice *dst;
+  ptrdiff_t *size;
+  int order;
+};
+
+/* A function that returns true if A sorts strictly before B.  */
+
+typedef bool (*sort_lessp) (Lisp_Object predicate,
+			    Lisp_Object a, Lisp_Object b);
+
+typedef struct
+{
+  /* The comparison: LESSP called with PREDICATE.  */
+  sort_lessp lessp;
+  Lisp_Object predicate;
+
+  /* This controls when we get *into* galloping mode.  It's initialized
+     to MIN_GALLOP.  merge_lo and merge_hi tend to nudge it higher for
+     random data, and lower for highly structured data.  */
+  ptrdiff_t min_gallop;
+
+  /* Temporary storage for a merge, large enough for half of the
+     sequence.  A.VALUES is null if there are no separate keys.  */
+  sortslice a;
+
+  /* A stack of N pending runs yet to be merged.  Run #i starts at
+     address pending[i].base and extends for pending[i].len elements.
+     It's always true (so long as the indices are in bounds) that
+
+     pending[i].base + pending[i].len == pending[i+1].base
+
+     so we could cut the storage for this, but it's a minor amount,
+     and keeping all the info explicit simplifies the code.  */
+  int n;
+  struct stretch pending[MAX_MERGE_PENDING];
+
+  /* The merge in progress, for reloc_cleanup.  */
+  struct reloc reloc;
+} merge_state;
+
+
+static bool
+lessp_funcall (Lisp_Object predicate, Lisp_Object a, Lisp_Object b)
+{
+  return !NILP (call2 (predicate, a, b));
+}
+
+/* Fast paths for the common built-in predicates.  They behave exactly
+   like calling the predicate, signals included, minus the funcall.  */
+
+static bool
+lessp_lss (Lisp_Object predicate, Lisp_Object a, Lisp_Object b)
+{
+  if (FIXNUMP (a) && FIXNUMP (b))
+    return XFIXNUM (a) < XFIXNUM (b);
+  return !NILP (arithcompare (a, b, ARITH_LESS));
+}
+
+static bool
+lessp_grtr (Lisp_Object predicate, Lisp_Object a, Lisp_Object b)
+{
+  if (FIXNUMP (a) && FIXNUMP (b))
+    return XFIXNUM (a) > XFIXNUM (b);
+  return !NILP (arithcompare (a, b, ARITH_GRTR));
+}
+
+static bool
+lessp_string_lessp (Lisp_Object predicate, Lisp_Object a, Lisp_Object b)
+{
+  return !NILP (Fstring_lessp (a, b));
+}
+
+/* Return the comparison function to use for PREDICATE.  */
+
+static sort_lessp
+resolve_lessp (Lisp_Object predicate)
+{
+  Lisp_Object fun = SYMBOLP (predicate) ? indirect_function (predicate)
+					: predicate;
+  if (SUBRP (fun))
+    {
+      struct Lisp_Subr *subr = XSUBR (fun);
+      if (subr->max_args == MANY && subr->function.aMANY == Flss)
+	return lessp_lss;
+      if (subr->max_args == MANY && subr->function.aMANY == Fgtr)
+	return lessp_grtr;
+      if (subr->max_args == 2 && subr->function.a2 == Fstring_lessp)
+	return lessp_string_lessp;
+    }
+  return lessp_funcall;
+}
+
+/* Return true if A sorts strictly before B according to MS.  */
+
+static bool
+inorder (merge_state *ms, Lisp_Object a, Lisp_Object b)
+{
+  return ms->lessp (ms->predicate, a, b);
+}
+
+static void
+sortslice_copy (sortslice *s1, ptrdiff_t i, sortslice *s2, ptrdiff_t j)
+{
+  s1->keys[i] = s2->keys[j];
+  if (s1->values != NULL)
+    s1->values[i] = s2->values[j];
+}
+
+static void
+sortslice_copy_incr (sortslice *dst, sortslice *src)
+{
+  *dst->keys++ = *src->keys++;
+  if (dst->values != NULL)
+    *dst->values++ = *src->values++;
+}
+
+static void
+sortslice_copy_decr (sortslice *dst, sortslice *src)
+{
+  *dst->keys-- = *src->keys--;
+  if (dst->values != NULL)
+    *dst->values-- = *src->values--;
+}
+
+static void
+sortslice_memcpy (sortslice *s1, ptrdiff_t i, sortslice *s2, ptrdiff_t j,
+		  ptrdiff_t n)
+{
+  memcpy (&s1->keys[i], &s2->keys[j], sizeof s1->keys[0] * n);
+  if (s1->values != NULL)
+    memcpy (&s1->values[i], &s2->values[j], sizeof s1->values[0] * n);
+}
+
+static void
+sortslice_memmove (sortslice *s1, ptrdiff_t i, sortslice *s2, ptrdiff_t j,
+		   ptrdiff_t n)
+{
+  memmove (&s1->keys[i], &s2->keys[j], sizeof s1->keys[0] * n);
+  if (s1->values != NULL)
+    memmove (&s1->values[i], &s2->values[j], sizeof s1->values[0] * n);
+}
+
+static void
+sortslice_advance (sortslice *slice, ptrdiff_t n)
+{
+  slice->keys += n;
+  if (slice->values != NULL)
+    slice->values += n;
+}
+
+/* Reverse the N elements starting at LO.  */
+
+static void
+reverse_slice (Lisp_Object *lo, ptrdiff_t n)
+{
+  for (Lisp_Object *hi = lo + n - 1; lo < hi; lo++, hi--)
+    {
+      Lisp_Object t = *lo;
+      *lo = *hi;
+      *hi = t;
+    }
+}
+
+static void
+reverse_sortslice (sortslice *s, ptrdiff_t n)
+{
+  reverse_slice (s->keys, n);
+  if (s->values != NULL)
+    reverse_slice (s->values, n);
+}
+
+/* Sort the segment from LO.KEYS to HI with a binary insertion sort,
+   which is stable and does few comparisons but O(N**2) data movement.
+   The elements before START are already sorted.  All comparisons
+   are done before anything moves, so a nonlocal exit from the
+   predicate loses nothing.  */
+
+static void
+binarysort (merge_state *ms, sortslice lo, const Lisp_Object *hi,
+	    Lisp_Object *start)
+{
+  eassume (lo.keys <= start && start <= hi);
+  if (lo.keys == start)
+    ++start;
+  for (; start < hi; ++start)
+    {
+      Lisp_Object *l = lo.keys;
+      Lisp_Object *r = start;
+      Lisp_Object pivot = *r;
+
+      /* Invariants:
+	 pivot >= all in [lo, l).
+	 pivot  < all in [r, start).
+	 The second is vacuously true at the start.  */
+      eassume (l < r);
+      do
+	{
+	  Lisp_Object *p = l + ((r - l) >> 1);
+	  if (inorder (ms, pivot, *p))
+	    r = p;
+	  else
+	    l = p + 1;
+	}
+      while (l < r);
+      eassume (l == r);
+
+      /* The invariants still hold, so pivot >= all in [lo, l) and
+	 pivot < all in [l, start), so pivot belongs at l.  Note that
+	 if there are elements equal to pivot, l points to the first
+	 slot after them -- that's why this sort is stable.  */
+      for (Lisp_Object *p = start; p > l; --p)
+	p[0] = p[-1];
+      *l = pivot;
+      if (lo.values != NULL)
+	{
+	  ptrdiff_t offset = lo.values - lo.keys;
+	  Lisp_Object *p = start + offset;
+	  pivot = *p;
+	  l += offset;
+	  for (; p > l; --p)
+	    p[0] = p[-1];
+	  *l = pivot;
+	}
+    }
+}
+
+/* Return the length of the run beginning at LO, in the slice
+   [LO, HI).  LO < HI is required on entry.  A "run" is the longest
+   ascending sequence, with
+
+     lo[0] <= lo[1] <= lo[2] <= ...
+
+   or the longest strictly descending sequence, with
+
+     lo[0] > lo[1] > lo[2] > ...
+
+   Set *DESCENDING to false in the former case and to true in the
+   latter.  The strictness of the descending case is what lets the
+   caller reverse such a run in place without breaking stability.  */
+
+static ptrdiff_t
+count_run (merge_state *ms, Lisp_Object *lo, const Lisp_Object *hi,
+	   bool *descending)
+{
+  eassume (lo < hi);
+  *descending = false;
+  ++lo;
+  if (lo == hi)
+    return 1;
+
+  ptrdiff_t n = 2;
+  if (inorder (ms, lo[0], lo[-1]))
+    {
+      *descending = true;
+      for (lo = lo + 1; lo < hi; ++lo, ++n)
+	if (!inorder (ms, lo[0], lo[-1]))
+	  break;
+    }
+  else
+    {
+      for (lo = lo + 1; lo < hi; ++lo, ++n)
+	if (inorder (ms, lo[0], lo[-1]))
+	  break;
+    }
+  return n;
+}
+
+/* Locate the proper position of KEY in the sorted N-element vector
+   A; return the integer K, 0 <= K <= N, such that
+
+     a[k-1] < key <= a[k]
+
+   pretending that a[-1] is minus infinity and a[n] is plus infinity.
+   IOW, key belongs at index k; or, IOW, the first k elements of a
+   should precede key, and the last n-k should follow key.
+
+   HINT, 0 <= HINT < N, is where to start searching; the closer it is
+   to the answer, the faster this goes.  */
+
+static ptrdiff_t
+gallop_left (merge_state *ms, const Lisp_Object key, Lisp_Object *a,
+	     const ptrdiff_t n, const ptrdiff_t hint)
+{
+  eassume (a && n > 0 && hint >= 0 && hint < n);
+
+  a += hint;
+  ptrdiff_t lastofs = 0;
+  ptrdiff_t ofs = 1;
+  if (inorder (ms, *a, key))
+    {
+      /* When a[hint] < key, gallop right until
+	 a[hint + lastofs] < key <= a[hint + ofs].  */
+      const ptrdiff_t maxofs = n - hint; /* This is one after the end of a.  */
+      while (ofs < maxofs)
+	{
+	  if (inorder (ms, a[ofs], key))
+	    {
+	      lastofs = ofs;
+	      eassume (ofs <= (PTRDIFF_MAX - 1) / 2);
+	      ofs = (ofs << 1) + 1;
+	    }
+	  else
+	    break; /* key <= a[hint + ofs].  */
+	}
+      if (ofs > maxofs)
+	ofs = maxofs;
+      /* Translate back to offsets relative to &a[0].  */
+      lastofs += hint;
+      ofs += hint;
+    }
+  else
+    {
+      /* When key <= a[hint], gallop left, until
+	 a[hint - ofs] < key <= a[hint - lastofs].  */
+      const ptrdiff_t maxofs = hint + 1; /* &a[0] is lowest.  */
+      while (ofs < maxofs)
+	{
+	  if (inorder (ms, a[-ofs], key))
+	    break;
+	  /* key <= a[hint - ofs].  */
+	  lastofs = ofs;
+	  eassume (ofs <= (PTRDIFF_MAX - 1) / 2);
+	  ofs = (ofs << 1) + 1;
+	}
+      if (ofs > maxofs)
+	ofs = maxofs;
+      /* Translate back to use positive offsets relative to &a[0].  */
+      ptrdiff_t k = lastofs;
+      lastofs = hint - ofs;
+      ofs = hint - k;
+    }
+  a -= hint;
+
+  eassume (-1 <= lastofs && lastofs < ofs && ofs <= n);
+  /* Now a[lastofs] < key <= a[ofs], so key belongs somewhere to the
+     right of lastofs but no farther right than ofs.  Do a binary
+     search, with invariant a[lastofs - 1] < key <= a[ofs].  */
+  ++lastofs;
+  while (lastofs < ofs)
+    {
+      ptrdiff_t m = lastofs + ((ofs - lastofs) >> 1);
+
+      if (inorder (ms, a[m], key))
+	lastofs = m + 1; /* a[m] < key.  */
+      else
+	ofs = m; /* key <= a[m].  */
+    }
+  eassume (lastofs == ofs); /* Now a[ofs-1] < key <= a[ofs].  */
+  return ofs;
+}
+
+/* Exactly like gallop_left, except that if KEY already exists in
+   A[0:N], find the position immediately to the right of the rightmost
+   equal value.  The return value is the integer K, 0 <= K <= N, such
+   that
+
+     a[k-1] <= key < a[k]  */
+
+static ptrdiff_t
+gallop_right (merge_state *ms, const Lisp_Object key, Lisp_Object *a,
+	      const ptrdiff_t n, const ptrdiff_t hint)
+{
+  eassume (a && n > 0 && hint >= 0 && hint < n);
+
+  a += hint;
+  ptrdiff_t lastofs = 0;
+  ptrdiff_t ofs = 1;
+  if (inorder (ms, key, *a))
+    {
+      /* When key < a[hint], gallop left until
+	 a[hint - ofs] <= key < a[hint - lastofs].  */
+      const ptrdiff_t maxofs = hint + 1; /* &a[0] is lowest.  */
+      while (ofs < maxofs)
+	{
+	  if (inorder (ms, key, a[-ofs]))
+	    {
+	      lastofs = ofs;
+	      eassume (ofs <= (PTRDIFF_MAX - 1) / 2);
+	      ofs = (ofs << 1) + 1;
+	    }
+	  else /* a[hint - ofs] <= key.  */
+	    break;
+	}
+      if (ofs > maxofs)
+	ofs = maxofs;
+      /* Translate back to use positive offsets relative to &a[0].  */
+      ptrdiff_t k = lastofs;
+      lastofs = hint - ofs;
+      ofs = hint - k;
+    }
+  else
+    {
+      /* When a[hint] <= key, gallop right until
+	 a[hint + lastofs] <= key < a[hint + ofs].  */
+      const ptrdiff_t maxofs = n - hint; /* This is one after the end of a.  */
+      while (ofs < maxofs)
+	{
+	  if (inorder (ms, key, a[ofs]))
+	    break;
+	  /* a[hint + ofs] <= key.  */
+	  lastofs = ofs;
+	  eassume (ofs <= (PTRDIFF_MAX - 1) / 2);
+	  ofs = (ofs << 1) + 1;
+	}
+      if (ofs > maxofs)
+	ofs = maxofs;
+      /* Translate back to use offsets relative to &a[0].  */
+      lastofs += hint;
+      ofs += hint;
+    }
+  a -= hint;
+
+  eassume (-1 <= lastofs && lastofs < ofs && ofs <= n);
+  /* Now a[lastofs] <= key < a[ofs], so key belongs somewhere to the
+     right of lastofs but no farther right than ofs.  Do a binary
+     search, with invariant a[lastofs - 1] <= key < a[ofs].  */
+  ++lastofs;
+  while (lastofs < ofs)
+    {
+      ptrdiff_t m = lastofs + ((ofs - lastofs) >> 1);
+
+      if (inorder (ms, key, a[m]))
+	ofs = m; /* key < a[m].  */
+      else
+	lastofs = m + 1; /* a[m] <= key.  */
+    }
+  eassume (lastofs == ofs); /* Now a[ofs-1] <= key < a[ofs].  */
+  return ofs;
+}
+
+/* If a merge was interrupted by a nonlocal exit, move the elements
+   that were still in temporary storage back into the sequence.  */
+
+static void
+reloc_cleanup (void *arg)
+{
+  merge_state *ms = arg;
+  struct reloc *r = &ms->reloc;
+  if (r->order != 0)
+    {
+      ptrdiff_t n = *r->size;
+      sortslice_memcpy (r->dst, r->order < 0 ? 1 - n : 0, r->src, 0, n);
+      r->order = 0;
+    }
+}
+
+/* Merge the NA elements starting at SSA with the NB elements starting
+   at SSB.KEYS = SSA.KEYS + NA in a stable way, in-place.  NA and NB
+   must be positive, and NA <= NB.  Must also have that SSB.KEYS[0]
+   belongs at the front of the merge and SSA.KEYS[NA-1] at its end.  */
+
+static void
+merge_lo (merge_state *ms, sortslice ssa, ptrdiff_t na, sortslice ssb,
+	  ptrdiff_t nb)
+{
+  eassume (ms && ssa.keys && ssb.keys && na > 0 && nb > 0);
+  eassume (ssa.keys + na == ssb.keys);
+
+  sortslice_memcpy (&ms->a, 0, &ssa, 0, na);
+  sortslice dest = ssa;
+  ssa = ms->a;
+
+  ms->reloc = (struct reloc) { &ssa, &dest, &na, 1 };
+
+  sortslice_copy_incr (&dest, &ssb);
+  --nb;
+  if (nb == 0)
+    goto Succeed;
+  if (na == 1)
+    goto CopyB;
+
+  ptrdiff_t min_gallop = ms->min_gallop;
+  for (;;)
+    {
+      ptrdiff_t acount = 0; /* The # of consecutive times A won.  */
+      ptrdiff_t bcount = 0; /* The # of consecutive times B won.  */
+
+      /* Do the straightforward thing until (if ever) one run appears
+	 to win consistently.  */
+      for (;;)
+	{
+	  eassume (na > 1 && nb > 0);
+	  if (inorder (ms, ssb.keys[0], ssa.keys[0]))
+	    {
+	      sortslice_copy_incr (&dest, &ssb);
+	      ++bcount;
+	      acount = 0;
+	      --nb;
+	      if (nb == 0)
+		goto Succeed;
+	      if (bcount >= min_gallop)
+		break;
+	    }
+	  else
+	    {
+	      sortslice_copy_incr (&dest, &ssa);
+	      ++acount;
+	      bcount = 0;
+	      --na;
+	      if (na == 1)
+		goto CopyB;
+	      if (acount >= min_gallop)
+		break;
+	    }
+	}
+
+      /* One run is winning so consistently that galloping may be a
+	 huge win.  So try that, and continue galloping until (if ever)
+	 neither run appears to be winning consistently anymore.  */
+      ++min_gallop;
+      do
+	{
+	  eassume (na > 1 && nb > 0);
+	  min_gallop -= min_gallop > 1;
+	  ms->min_gallop = min_gallop;
+	  ptrdiff_t k = gallop_right (ms, ssb.keys[0], ssa.keys, na, 0);
+	  acount = k;
+	  if (k)
+	    {
+	      sortslice_memcpy (&dest, 0, &ssa, 0, k);
+	      sortslice_advance (&dest, k);
+	      sortslice_advance (&ssa, k);
+	      na -= k;
+	      if (na == 1)
+		goto CopyB;
+	      /* While na == 0 is impossible for a consistent comparison
+		 function, we shouldn't assume that it is.  */
+	      if (na == 0)
+		goto Succeed;
+	    }
+	  sortslice_copy_incr (&dest, &ssb);
+	  --nb;
+	  if (nb == 0)
+	    goto Succeed;
+
+	  k = gallop_left (ms, ssa.keys[0], ssb.keys, nb, 0);
+	  bcount = k;
+	  if (k)
+	    {
+	      sortslice_memmove (&dest, 0, &ssb, 0, k);
+	      sortslice_advance (&dest, k);
+	      sortslice_advance (&ssb, k);
+	      nb -= k;
+	      if (nb == 0)
+		goto Succeed;
+	    }
+	  sortslice_copy_incr (&dest, &ssa);
+	  --na;
+	  if (na == 1)
+	    goto CopyB;
+	}
+      while (acount >= MIN_GALLOP || bcount >= MIN_GALLOP);
+      ++min_gallop; /* Apply a penalty for leaving galloping mode.  */
+      ms->min_gallop = min_gallop;
+    }
+
+ Succeed:
+  ms->reloc.order = 0;
+  if (na)
+    sortslice_memcpy (&dest, 0, &ssa, 0, na);
+  return;
+ CopyB:
+  eassume (na == 1 && nb > 0);
+  ms->reloc.order = 0;
+  /* The last element of ssa belongs at the end of the merge.  */
+  sortslice_memmove (&dest, 0, &ssb, 0, nb);
+  sortslice_copy (&dest, nb, &ssa, 0);
+}
+
+/* Merge the NA elements starting at SSA with the NB elements starting
+   at SSB.KEYS = SSA.KEYS + NA in a stable way, in-place.  NA and NB
+   must be positive, and NA >= NB.  Must also have that SSB.KEYS[0]
+   belongs at the front of the merge and SSA.KEYS[NA-1] at its end.  */
+
+static void
+merge_hi (merge_state *ms, sortslice ssa, ptrdiff_t na,
+	  sortslice ssb, ptrdiff_t nb)
+{
+  eassume (ms && ssa.keys && ssb.keys && na > 0 && nb > 0);
+  eassume (ssa.keys + na == ssb.keys);
+
+  sortslice dest = ssb;
+  sortslice_advance (&dest, nb - 1);
+  sortslice_memcpy (&ms->a, 0, &ssb, 0, nb);
+  sortslice basea = ssa;
+  sortslice baseb = ms->a;
+  ssb.keys = ms->a.keys + nb - 1;
+  if (ssb.values != NULL)
+    ssb.values = ms->a.values + nb - 1;
+  sortslice_advance (&ssa, na - 1);
+
+  ms->reloc = (struct reloc) { &baseb, &dest, &nb, -1 };
+
+  sortslice_copy_decr (&dest, &ssa);
+  --na;
+  if (na == 0)
+    goto Succeed;
+  if (nb == 1)
+    goto CopyA;
+
+  ptrdiff_t min_gallop = ms->min_gallop;
+  for (;;)
+    {
+      ptrdiff_t acount = 0; /* The # of consecutive times A won.  */
+      ptrdiff_t bcount = 0; /* The # of consecutive times B won.  */
+
+      /* Do the straightforward thing until (if ever) one run appears
+	 to win consistently.  */
+      for (;;)
+	{
+	  eassume (na > 0 && nb > 1);
+	  if (inorder (ms, ssb.keys[0], ssa.keys[0]))
+	    {
+	      sortslice_copy_decr (&dest, &ssa);
+	      ++acount;
+	      bcount = 0;
+	      --na;
+	      if (na == 0)
+		goto Succeed;
+	      if (acount >= min_gallop)
+		break;
+	    }
+	  else
+	    {
+	      sortslice_copy_decr (&dest, &ssb);
+	      ++bcount;
+	      acount = 0;
+	      --nb;
+	      if (nb == 1)
+		goto CopyA;
+	      if (bcount >= min_gallop)
+		break;
+	    }
+	}
+
+      /* One run is winning so consistently that galloping may be a
+	 huge win.  So try that, and continue galloping until (if ever)
+	 neither run appears to be winning consistently anymore.  */
+      ++min_gallop;
+      do
+	{
+	  eassume (na > 0 && nb > 1);
+	  min_gallop -= min_gallop > 1;
+	  ms->min_gallop = min_gallop;
+	  ptrdiff_t k = gallop_right (ms, ssb.keys[0], basea.keys, na, na - 1);
+	  k = na - k;
+	  acount = k;
+	  if (k)
+	    {
+	      sortslice_advance (&dest, -k);
+	      sortslice_advance (&ssa, -k);
+	      sortslice_memmove (&dest, 1, &ssa, 1, k);
+	      na -= k;
+	      if (na == 0)
+		goto Succeed;
+	    }
+	  sortslice_copy_decr (&dest, &ssb);
+	  --nb;
+	  if (nb == 1)
+	    goto CopyA;
+
+	  k = gallop_left (ms, ssa.keys[0], baseb.keys, nb, nb - 1);
+	  k = nb - k;
+	  bcount = k;
+	  if (k)
+	    {
+	      sortslice_advance (&dest, -k);
+	      sortslice_advance (&ssb, -k);
+	      sortslice_memcpy (&dest, 1, &ssb, 1, k);
+	      nb -= k;
+	      if (nb == 1)
+		goto CopyA;
+	      /* While nb == 0 is impossible for a consistent comparison
+		 function, we shouldn't assume that it is.  */
+	      if (nb == 0)
+		goto Succeed;
+	    }
+	  sortslice_copy_decr (&dest, &ssa);
+	  --na;
+	  if (na == 0)
+	    goto Succeed;
+	}
+      while (acount >= MIN_GALLOP || bcount >= MIN_GALLOP);
+      ++min_gallop; /* Apply a penalty for leaving galloping mode.  */
+      ms->min_gallop = min_gallop;
+    }
+
+ Succeed:
+  ms->reloc.order = 0;
+  if (nb)
+    sortslice_memcpy (&dest, 1 - nb, &baseb, 0, nb);
+  return;
+ CopyA:
+  eassume (nb == 1 && na > 0);
+  ms->reloc.order = 0;
+  /* The first element of ssb belongs at the front of the merge.  */
+  sortslice_memmove (&dest, 1 - na, &ssa, 1 - na, na);
+  sortslice_advance (&dest, -na);
+  sortslice_advance (&ssa, -na);
+  sortslice_copy (&dest, 0, &ssb, 0);
+}
+
+/* Merge the two runs at stack indices I and I+1.  */
+
+static void
+merge_at (merge_state *ms, const int i)
+{
+  eassume (ms->n >= 2);
+  eassume (i >= 0);
+  eassume (i == ms->n - 2 || i == ms->n - 3);
+
+  sortslice ssa = ms->pending[i].base;
+  ptrdiff_t na = ms->pending[i].len;
+  sortslice ssb = ms->pending[i + 1].base;
+  ptrdiff_t nb = ms->pending[i + 1].len;
+  eassume (na > 0 && nb > 0);
+  eassume (ssa.keys + na == ssb.keys);
+
+  /* Record the length of the combined runs; if i is the 3rd-last run
+     now, also slide over the last run (which isn't involved in this
+     merge).  The current run i+1 goes away in any case.  */
+  ms->pending[i].len = na + nb;
+  if (i == ms->n - 3)
+    ms->pending[i + 1] = ms->pending[i + 2];
+  --ms->n;
+
+  /* Where does b start in a?  Elements in a before that can be ignored
+     (already in place).  */
+  ptrdiff_t k = gallop_right (ms, *ssb.keys, ssa.keys, na, 0);
+  eassume (k >= 0);
+  sortslice_advance (&ssa, k);
+  na -= k;
+  if (na == 0)
+    return;
+
+  /* Where does a end in b?  Elements in b after that can be ignored
+     (already in place).  */
+  nb = gallop_left (ms, ssa.keys[na - 1], ssb.keys, nb, nb - 1);
+  if (nb == 0)
+    return;
+  eassume (nb > 0);
+  /* Merge what remains of the runs using a temp array with size
+     min(na, nb) elements.  */
+  if (na <= nb)
+    merge_lo (ms, ssa, na, ssb, nb);
+  else
+    merge_hi (ms, ssa, na, ssb, nb);
+}
+
+/* Examine the stack of runs waiting to be merged, merging adjacent
+   runs until the stack invariants are re-established:
+
+   1. len[-3] > len[-2] + len[-1]
+   2. len[-2] > len[-1]
+
+   Checking the invariant one run further down as well avoids the bug
+   in the original formulation reported by de Gouw et al. in 2015.  */
+
+static void
+merge_collapse (merge_state *ms)
+{
+  struct stretch *p = ms->pending;
+
+  while (ms->n > 1)
+    {
+      int n = ms->n - 2;
+      if ((n > 0 && p[n - 1].len <= p[n].len + p[n + 1].len)
+	  || (n > 1 && p[n - 2].len <= p[n - 1].len + p[n].len))
+	{
+	  if (p[n - 1].len < p[n + 1].len)
+	    --n;
+	  merge_at (ms, n);
+	}
+      else if (p[n].len <= p[n + 1].len)
+	merge_at (ms, n);
+      else
+	break;
+    }
+}
+
+/* Regardless of invariants, merge all runs on the stack until only
+   one remains.  This is used at the end of the mergesort.  */
+
+static void
+merge_force_collapse (merge_state *ms)
+{
+  struct stretch *p = ms->pending;
+
+  while (ms->n > 1)
+    {
+      int n = ms->n - 2;
+      if (n > 0 && p[n - 1].len < p[n + 1].len)
+	--n;
+      merge_at (ms, n);
+    }
+}
+
+/* Compute a good value for the minimum run length; natural runs
+   shorter than this are boosted artificially via binary insertion.
+
+   If N < MIN_MERGE, return N (it's too small to bother with fancy
+   stuff).  Else if N is an exact power of 2, return MIN_MERGE / 2.
+   Else return an int K, MIN_MERGE / 2 <= K <= MIN_MERGE, such that
+   N / K is close to, but strictly less than, an exact power of 2.  */
+
+static ptrdiff_t
+merge_compute_minrun (ptrdiff_t n)
+{
+  ptrdiff_t r = 0; /* r will become 1 if any 1 bits are shifted off.  */
+
+  eassume (n >= 0);
+  while (n >= MIN_MERGE)
+    {
+      r |= n & 1;
+      n >>= 1;
+    }
+  return n + r;
+}
+
+/* Sort the LENGTH elements of SEQ stably in place, using PREDICATE to
+   compare them.  If KEYFUNC is non-nil, call it exactly once on each
+   element and compare the results instead.  SEQ must be visible to
+   the garbage collector.  */
+
+void
+tim_sort (Lisp_Object predicate, Lisp_Object keyfunc,
+	  Lisp_Object *seq, const ptrdiff_t length)
+{
+  if (length < 2)
+    return;
+
+  ptrdiff_t count = SPECPDL_INDEX ();
+  USE_SAFE_ALLOCA;
+  merge_state ms;
+  sortslice lo;
+
+  if (NILP (keyfunc))
+    {
+      lo.keys = seq;
+      lo.values = NULL;
+    }
+  else
+    {
+      SAFE_ALLOCA_LISP (lo.keys, length);
+      for (ptrdiff_t i = 0; i < length; i++)
+	lo.keys[i] = Qnil;
+      for (ptrdiff_t i = 0; i < length; i++)
+	lo.keys[i] = call1 (keyfunc, seq[i]);
+      lo.values = seq;
+    }
+
+  ms.lessp = resolve_lessp (predicate);
+  ms.predicate = predicate;
+  ms.min_gallop = MIN_GALLOP;
+  ms.n = 0;
+  ms.reloc = (struct reloc) { NULL, NULL, NULL, 0 };
+  ms.a.keys = ms.a.values = NULL;
+
+  /* A merge never needs more temporary storage than half the
+     sequence, and there are no merges at all unless the sequence is
+     longer than the minimum run.  Allocate the storage before
+     registering reloc_cleanup, so that it is freed after the cleanup
+     has used it.  */
+  if (length >= MIN_MERGE)
+    {
+      ptrdiff_t half = length >> 1;
+      ptrdiff_t tmplen = lo.values ? 2 * half : half;
+      Lisp_Object *tmp;
+      SAFE_ALLOCA_LISP (tmp, tmplen);
+      for (ptrdiff_t i = 0; i < tmplen; i++)
+	tmp[i] = Qnil;
+      ms.a.keys = tmp;
+      if (lo.values)
+	ms.a.values = tmp + half;
+      record_unwind_protect_ptr (reloc_cleanup, &ms);
+    }
+
+  /* March over the sequence once, left to right, finding natural runs,
+     and extending short natural runs to minrun elements.  */
+  ptrdiff_t nremaining = length;
+  const ptrdiff_t minrun = merge_compute_minrun (nremaining);
+  do
+    {
+      bool descending;
+
+      /* Identify the next run.  */
+      ptrdiff_t n = count_run (&ms, lo.keys, lo.keys + nremaining,
+			       &descending);
+      if (descending)
+	reverse_sortslice (&lo, n);
+      /* If the run is short, extend it to min(minrun, nremaining).  */
+      if (n < minrun)
+	{
+	  const ptrdiff_t force = nremaining <= minrun ? nremaining : minrun;
+	  binarysort (&ms, lo, lo.keys + force, lo.keys + n);
+	  n = force;
+	}
+      /* Push run onto pending-runs stack, and maybe merge.  */
+      eassume (ms.n < MAX_MERGE_PENDING);
+      ms.pending[ms.n].base = lo;
+      ms.pending[ms.n].len = n;
+      ++ms.n;
+      merge_collapse (&ms);
+      /* Advance to find the next run.  */
+      sortslice_advance (&lo, n);
+      nremaining -= n;
+    }
+  while (nremaining);
+
+  merge_force_collapse (&ms);
+  eassume (ms.n == 1);
+  eassume (ms.pending[0].len == length);
+
+  SAFE_FREE_UNBIND_TO (count, Qnil);
+}
@@ -1802,6 +1802,19 @@ deliver_fatal_thread_signal (int sig)
   deliver_thread_signal (sig, handle_fatal_signal);
 }
 
+#ifdef SIGBUS
+/* Handle SIGBUS.  A bus error in buffer text mapped from a file that
+   has been truncated meanwhile is not fatal: see
+   mapped_buffer_text_fault.  */
+
+static void
+handle_sigbus (int sig, siginfo_t *siginfo, void *arg)
+{
+  if (! (siginfo && mapped_buffer_text_fault (siginfo->si_addr)))
+    deliver_fatal_thread_signal (sig);
+}
+#endif
+
 static AVOID
 handle_arith_signal (int sig)
 {
@@ -2185,7 +2198,13 @@ init_signals (void)
   sigaction (SIGEMT, &thread_fatal_action, 0);
 #endif
 #ifdef SIGBUS
-  sigaction (SIGBUS, &thread_fatal_action, 0);
+  {
+    struct sigaction sigbus_action;
+    sigfillset (&sigbus_action.sa_mask);
+    sigbus_action.sa_sigaction = handle_sigbus;
+    sigbus_action.sa_flags = SA_SIGINFO | emacs_sigaction_flags ();
+    sigaction (SIGBUS, &sigbus_action, 0);
+  }
 #endif
   if (!init_sigsegv ())
     sigaction (SIGSEGV, &thread_fatal_action, 0);
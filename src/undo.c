@@ -31,6 +31,426 @@
    an undo-boundary.  */
 static Lisp_Object pending_boundary;
 
+/* Undo logs.
+
+   If `undo-log-limit' is non-nil in a buffer, the functions below do
+   not put what they record on `buffer-undo-list' right away, but
+   append it to the buffer's undo log.  A record there is a tag byte
+   followed by a few integers of a variable number of bytes each, and
+   the text of a deletion, if it has no text properties, is copied in
+   after them.  The Lisp objects that records need are kept in their
+   own array, in the order of the records, and so are the markers of
+   marker adjustments, which the GC treats as weak references just
+   like the (MARKER . ADJUSTMENT) elements of an undo list.
+
+   The records become the usual list elements only when someone asks
+   for the undo list; see buffer_undo_list in buffer.h.  Until then a
+   change costs the GC almost nothing.  Each time a record is added,
+   the oldest changes are forgotten if the log no longer fits in
+   `undo-log-limit' bytes.  */
+
+enum undo_record
+  {
+    /* nil.  */
+    UNDO_BOUNDARY,
+    /* POSITION: POSITION.  */
+    UNDO_POINT,
+    /* (BEG . END): BEG, END - BEG.  */
+    UNDO_INSERT,
+    /* (TEXT . POSITION), TEXT multibyte without properties: POSITION,
+       the number of characters and of bytes of TEXT, its bytes.  */
+    UNDO_DELETE,
+    /* The same for a unibyte TEXT: POSITION, the number of bytes of
+       TEXT, its bytes.  */
+    UNDO_DELETE_UNIBYTE,
+    /* (TEXT . POSITION), any other TEXT: POSITION, the number of bytes
+       of TEXT.  TEXT is an object.  */
+    UNDO_DELETE_STRING,
+    /* (MARKER . ADJUSTMENT): ADJUSTMENT.  MARKER is a marker.  */
+    UNDO_MARKER,
+    /* (nil PROP VAL BEG . END): BEG, END - BEG.  PROP and VAL are
+       objects.  */
+    UNDO_PROPERTY,
+    /* (t . TIME-FLAG): nothing.  TIME-FLAG is an object.  */
+    UNDO_FIRST_CHANGE
+  };
+
+/* The most bytes an integer takes in an undo log.  */
+enum { UNDO_INT_BYTES = (sizeof (ptrdiff_t) * CHAR_BIT + 6) / 7 };
+
+/* Lisp objects in the order they were added, in V[HEAD..FILL).  */
+struct undo_objects
+{
+  Lisp_Object *v;
+  ptrdiff_t head, fill, size;
+};
+
+struct undo_log
+{
+  /* The records, oldest first, in BYTES[HEAD..FILL).  */
+  unsigned char *bytes;
+  ptrdiff_t head, fill, size;
+
+  /* Where the newest record starts, or -1 if there are none.  */
+  ptrdiff_t last;
+
+  /* The objects and the markers that the records refer to.  */
+  struct undo_objects objects, markers;
+
+  /* The number of boundaries among the records.  */
+  ptrdiff_t boundaries;
+
+  /* The number of bytes the records count for against
+     `undo-log-limit'.  */
+  ptrdiff_t used;
+};
+
+/* Append the integer N to LOG, which has room for it.  */
+static void
+undo_log_put_int (struct undo_log *log, ptrdiff_t n)
+{
+  /* Interleave negative and nonnegative numbers, so that numbers
+     near zero take few bytes whatever their sign.  */
+  uintmax_t u = n < 0 ? - (uintmax_t) (n + 1) * 2 + 1 : (uintmax_t) n * 2;
+  for (; 0x80 <= u; u >>= 7)
+    log->bytes[log->fill++] = u | 0x80;
+  log->bytes[log->fill++] = u;
+}
+
+/* Return the integer at *P, and advance *P past it.  */
+static ptrdiff_t
+undo_log_get_int (unsigned char const **p)
+{
+  uintmax_t u = 0;
+  int shift = 0;
+  unsigned char c;
+  do
+    {
+      c = *(*p)++;
+      u |= (uintmax_t) (c & 0x7f) << shift;
+      shift += 7;
+    }
+  while (c & 0x80);
+  return u & 1 ? - (ptrdiff_t) (u >> 1) - 1 : u >> 1;
+}
+
+/* Append OBJ to Q.  */
+static void
+undo_objects_push (struct undo_objects *q, Lisp_Object obj)
+{
+  if (q->fill == q->size)
+    {
+      /* Move the live objects to the front, and grow the array unless
+	 that freed at least half of it.  */
+      ptrdiff_t n = q->fill - q->head;
+      memmove (q->v, q->v + q->head, n * word_size);
+      q->head = 0;
+      q->fill = n;
+      if (q->size - n < q->size / 2 + 1)
+	q->v = xpalloc (q->v, &q->size, 1, -1, word_size);
+    }
+  q->v[q->fill++] = obj;
+}
+
+/* Start a record of kind KIND in LOG, making room for NBYTES more
+   bytes after the tag.  */
+static void
+undo_log_start (struct undo_log *log, enum undo_record kind,
+		ptrdiff_t nbytes)
+{
+  nbytes++;
+  if (log->size - log->fill < nbytes)
+    {
+      /* Move the live records to the front, and grow the log unless
+	 that freed at least half of it.  */
+      ptrdiff_t n = log->fill - log->head;
+      memmove (log->bytes, log->bytes + log->head, n);
+      if (0 <= log->last)
+	log->last -= log->head;
+      log->head = 0;
+      log->fill = n;
+      if (log->size - n < max (nbytes, log->size / 2))
+	log->bytes = xpalloc (log->bytes, &log->size, nbytes, -1, 1);
+    }
+  log->last = log->fill;
+  log->bytes[log->fill++] = kind;
+}
+
+/* Return the number of bytes the record at *P counts for against
+   `undo-log-limit', and advance *P past it.  Also advance *OBJECTS and
+   *MARKERS past the objects and markers it refers to.  */
+static ptrdiff_t
+undo_log_skip (unsigned char const **p, ptrdiff_t *objects,
+	       ptrdiff_t *markers)
+{
+  unsigned char const *start = *p;
+  ptrdiff_t nobjects = 0, nmarkers = 0, text = 0;
+
+  switch (*(*p)++)
+    {
+    case UNDO_BOUNDARY:
+      break;
+    case UNDO_POINT:
+      undo_log_get_int (p);
+      break;
+    case UNDO_INSERT:
+      undo_log_get_int (p);
+      undo_log_get_int (p);
+      break;
+    case UNDO_DELETE:
+      undo_log_get_int (p);
+      undo_log_get_int (p);
+      *p += undo_log_get_int (p);
+      break;
+    case UNDO_DELETE_UNIBYTE:
+      undo_log_get_int (p);
+      *p += undo_log_get_int (p);
+      break;
+    case UNDO_DELETE_STRING:
+      undo_log_get_int (p);
+      text = undo_log_get_int (p);
+      nobjects = 1;
+      break;
+    case UNDO_MARKER:
+      undo_log_get_int (p);
+      nmarkers = 1;
+      break;
+    case UNDO_PROPERTY:
+      undo_log_get_int (p);
+      undo_log_get_int (p);
+      nobjects = 2;
+      break;
+    case UNDO_FIRST_CHANGE:
+      nobjects = 1;
+      break;
+    default:
+      emacs_abort ();
+    }
+  *objects += nobjects;
+  *markers += nmarkers;
+  return *p - start + (nobjects + nmarkers) * word_size + text;
+}
+
+/* Empty LOG.  */
+static void
+undo_log_clear (struct undo_log *log)
+{
+  log->head = log->fill = 0;
+  log->last = -1;
+  log->objects.head = log->objects.fill = 0;
+  log->markers.head = log->markers.fill = 0;
+  log->boundaries = 0;
+  log->used = 0;
+}
+
+/* Forget the oldest records in LOG, the undo log of buffer B, until
+   it fits in LIMIT bytes.  Whole changes are forgotten if possible,
+   so that the log starts right after a boundary.  The changes on the
+   undo list of B are older than those, so all of them go too.  */
+static void
+undo_log_forget (struct buffer *b, struct undo_log *log, ptrdiff_t limit)
+{
+  bool boundary = false;
+
+  bset_undo_list (b, Qnil);
+  while (log->head < log->fill
+	 && (limit < log->used || (0 < log->boundaries && !boundary)))
+    {
+      unsigned char const *p = log->bytes + log->head;
+      boundary = *p == UNDO_BOUNDARY;
+      log->boundaries -= boundary;
+      log->used -= undo_log_skip (&p, &log->objects.head,
+				  &log->markers.head);
+      log->head = p - log->bytes;
+    }
+  if (log->head == log->fill)
+    undo_log_clear (log);
+}
+
+/* Finish the record started last in LOG, the undo log of the current
+   buffer.  */
+static void
+undo_log_finish (struct undo_log *log)
+{
+  unsigned char const *p = log->bytes + log->last;
+  ptrdiff_t objects = 0, markers = 0;
+
+  log->boundaries += *p == UNDO_BOUNDARY;
+  log->used += undo_log_skip (&p, &objects, &markers);
+  if (XFIXNAT (Vundo_log_limit) < log->used)
+    undo_log_forget (current_buffer, log, XFIXNAT (Vundo_log_limit));
+}
+
+/* Return the undo log to record changes to the current buffer in, or
+   NULL if they go on its undo list.  */
+static struct undo_log *
+current_undo_log (void)
+{
+  struct buffer *b = current_buffer;
+
+  /* Changes to indirect buffers, and to buffers that have them, are
+     recorded in whichever buffer is current, and set_buffer_internal
+     copies the list between them, so they don't use a log.  */
+  if (FIXNATP (Vundo_log_limit) && !b->base_buffer && !b->indirections)
+    {
+      if (!b->undo_log)
+	{
+	  b->undo_log = xzalloc (sizeof *b->undo_log);
+	  b->undo_log->last = -1;
+	}
+      return b->undo_log;
+    }
+  if (b->undo_log)
+    flush_undo_log (b);
+  return NULL;
+}
+
+/* Return true if the last change recorded for the current buffer,
+   either in LOG or on the undo list, is a boundary, or if there is
+   none.  */
+static bool
+at_undo_boundary (struct undo_log *log)
+{
+  if (log && 0 <= log->last)
+    return log->bytes[log->last] == UNDO_BOUNDARY;
+  return (! CONSP (BVAR (current_buffer, undo_list))
+	  || NILP (XCAR (BVAR (current_buffer, undo_list))));
+}
+
+/* Put the records in the undo log of buffer B on its undo list, and
+   empty the log.  */
+void
+flush_undo_log (struct buffer *b)
+{
+  struct undo_log *log = b->undo_log;
+  Lisp_Object list = BVAR (b, undo_list);
+  unsigned char const *p = log->bytes + log->head;
+  unsigned char const *end = log->bytes + log->fill;
+  Lisp_Object *object = log->objects.v + log->objects.head;
+  Lisp_Object *marker = log->markers.v + log->markers.head;
+
+  /* While recording is turned off, as by subst-char-in-region, leave
+     the log for when the list is restored.  */
+  if (EQ (list, Qt))
+    return;
+
+  while (p < end)
+    {
+      Lisp_Object elt;
+      ptrdiff_t pos, n, nbytes;
+
+      switch (*p++)
+	{
+	case UNDO_BOUNDARY:
+	  elt = Qnil;
+	  break;
+
+	case UNDO_POINT:
+	  elt = make_fixnum (undo_log_get_int (&p));
+	  break;
+
+	case UNDO_INSERT:
+	  pos = undo_log_get_int (&p);
+	  n = undo_log_get_int (&p);
+	  elt = Fcons (make_fixnum (pos), make_fixnum (pos + n));
+	  break;
+
+	case UNDO_DELETE:
+	  pos = undo_log_get_int (&p);
+	  n = undo_log_get_int (&p);
+	  nbytes = undo_log_get_int (&p);
+	  elt = Fcons (make_multibyte_string ((char const *) p, n, nbytes),
+		       make_fixnum (pos));
+	  p += nbytes;
+	  break;
+
+	case UNDO_DELETE_UNIBYTE:
+	  pos = undo_log_get_int (&p);
+	  nbytes = undo_log_get_int (&p);
+	  elt = Fcons (make_unibyte_string ((char const *) p, nbytes),
+		       make_fixnum (pos));
+	  p += nbytes;
+	  break;
+
+	case UNDO_DELETE_STRING:
+	  pos = undo_log_get_int (&p);
+	  undo_log_get_int (&p);
+	  elt = Fcons (*object++, make_fixnum (pos));
+	  break;
+
+	case UNDO_MARKER:
+	  n = undo_log_get_int (&p);
+	  /* The GC forgets markers that nothing else refers to.  */
+	  if (NILP (*marker))
+	    {
+	      marker++;
+	      continue;
+	    }
+	  elt = Fcons (*marker++, make_fixnum (n));
+	  break;
+
+	case UNDO_PROPERTY:
+	  pos = undo_log_get_int (&p);
+	  n = undo_log_get_int (&p);
+	  elt = Fcons (Qnil, Fcons (object[0],
+				    Fcons (object[1],
+					   Fcons (make_fixnum (pos),
+						  make_fixnum (pos + n)))));
+	  object += 2;
+	  break;
+
+	case UNDO_FIRST_CHANGE:
+	  elt = Fcons (Qt, *object++);
+	  break;
+
+	default:
+	  emacs_abort ();
+	}
+      list = Fcons (elt, list);
+    }
+
+  undo_log_clear (log);
+  bset_undo_list (b, list);
+}
+
+/* Forget the undo log of buffer B, if any, and free its storage.
+   Use this when B's undo list is replaced by something new.  */
+void
+discard_undo_log (struct buffer *b)
+{
+  struct undo_log *log = b->undo_log;
+
+  if (log)
+    {
+      xfree (log->bytes);
+      xfree (log->objects.v);
+      xfree (log->markers.v);
+      xfree (log);
+      b->undo_log = NULL;
+    }
+}
+
+/* Mark the objects that the undo log of buffer B refers to, for the
+   GC.  Its markers are not marked; those that nothing else refers to
+   are forgotten.  Free the storage of an empty log.  */
+void
+mark_undo_log (struct buffer *b)
+{
+  struct undo_log *log = b->undo_log;
+  ptrdiff_t i;
+
+  if (log->head == log->fill)
+    {
+      discard_undo_log (b);
+      return;
+    }
+  for (i = log->objects.head; i < log->objects.fill; i++)
+    mark_object (log->objects.v[i]);
+  for (i = log->markers.head; i < log->markers.fill; i++)
+    if (!survives_gc_p (log->markers.v[i]))
+      log->markers.v[i] = Qnil;
+}
+
 /* Prepare the undo info for recording a change. */
 static void
 prepare_record (void)
@@ -57,8 +477,7 @@ record_point (ptrdiff_t beg)
   first change. FIXME: This check is currently dependent on being
   called before record_first_change, but could be made not to by
   ignoring timestamp undo entries */
-  at_boundary = ! CONSP (BVAR (current_buffer, undo_list))
-                || NILP (XCAR (BVAR (current_buffer, undo_list)));
+  at_boundary = at_undo_boundary (current_undo_log ());
 
   /* If this is the first change since save, then record this.*/
   if (MODIFF <= SAVE_MODIFF)
@@ -73,9 +492,19 @@ record_point (ptrdiff_t beg)
   if (at_boundary
       && point_before_last_command_or_undo != beg
       && buffer_before_last_command_or_undo == current_buffer )
-    bset_undo_list (current_buffer,
-		    Fcons (make_fixnum (point_before_last_command_or_undo),
-			   BVAR (current_buffer, undo_list)));
+    {
+      struct undo_log *log = current_undo_log ();
+      if (log)
+	{
+	  undo_log_start (log, UNDO_POINT, UNDO_INT_BYTES);
+	  undo_log_put_int (log, point_before_last_command_or_undo);
+	  undo_log_finish (log);
+	}
+      else
+	bset_undo_list (current_buffer,
+			Fcons (make_fixnum (point_before_last_command_or_undo),
+			       BVAR (current_buffer, undo_list)));
+    }
 }
 
 /* Record an insertion that just happened or is about to happen,
@@ -87,6 +516,7 @@ record_point (ptrdiff_t beg)
 record_insert (ptrdiff_t beg, ptrdiff_t length)
 {
   Lisp_Object lbeg, lend;
+  struct undo_log *log;
 
   if (EQ (BVAR (current_buffer, undo_list), Qt))
     return;
@@ -95,9 +525,27 @@ record_insert (ptrdiff_t beg, ptrdiff_t length)
 
   record_point (beg);
 
+  log = current_undo_log ();
+
   /* If this is following another insertion and consecutive with it
      in the buffer, combine the two.  */
-  if (CONSP (BVAR (current_buffer, undo_list)))
+  if (log && 0 <= log->last)
+    {
+      if (log->bytes[log->last] == UNDO_INSERT)
+	{
+	  unsigned char const *p = log->bytes + log->last + 1;
+	  ptrdiff_t last_beg = undo_log_get_int (&p);
+	  ptrdiff_t last_length = undo_log_get_int (&p);
+	  if (last_beg + last_length == beg)
+	    {
+	      log->used -= p - (log->bytes + log->last);
+	      log->fill = log->last;
+	      beg = last_beg;
+	      length += last_length;
+	    }
+	}
+    }
+  else if (CONSP (BVAR (current_buffer, undo_list)))
     {
       Lisp_Object elt;
       elt = XCAR (BVAR (current_buffer, undo_list));
@@ -111,12 +559,71 @@ record_insert (ptrdiff_t beg, ptrdiff_t length)
 	}
     }
 
+  if (log)
+    {
+      undo_log_start (log, UNDO_INSERT, 2 * UNDO_INT_BYTES);
+      undo_log_put_int (log, beg);
+      undo_log_put_int (log, length);
+      undo_log_finish (log);
+      return;
+    }
+
   XSETFASTINT (lbeg, beg);
   XSETINT (lend, beg + length);
   bset_undo_list (current_buffer,
 		  Fcons (Fcons (lbeg, lend), BVAR (current_buffer, undo_list)));
 }
 
+/* The region of text whose markers record_marker_adjustment
+   records.  */
+
+struct marker_adjustment_region
+{
+  ptrdiff_t from, to;
+
+  /* The undo log to record adjustments in, or NULL.  */
+  struct undo_log *log;
+};
+
+/* Record the adjustment of marker M for the deletion of the region
+   REGION, a struct marker_adjustment_region.  */
+
+static void
+record_marker_adjustment (struct Lisp_Marker *m, void *region)
+{
+  ptrdiff_t from = ((struct marker_adjustment_region *) region)->from;
+  ptrdiff_t to = ((struct marker_adjustment_region *) region)->to;
+  ptrdiff_t charpos = marker_charpos (m);
+  eassert (charpos <= Z);
+
+  /* insertion_type nil markers will end up at the beginning of
+     the re-inserted text after undoing a deletion, and must be
+     adjusted to move them to the correct place.
+
+     insertion_type t markers will automatically move forward
+     upon re-inserting the deleted text, so we have to arrange
+     for them to move backward to the correct position.  */
+  ptrdiff_t adjustment = (m->insertion_type ? to : from) - charpos;
+
+  if (adjustment)
+    {
+      Lisp_Object marker = make_lisp_ptr (m, Lisp_Vectorlike);
+      struct undo_log *log = ((struct marker_adjustment_region *) region)->log;
+      if (log)
+	{
+	  undo_log_start (log, UNDO_MARKER, UNDO_INT_BYTES);
+	  undo_log_put_int (log, adjustment);
+	  undo_objects_push (&log->markers, marker);
+	  undo_log_finish (log);
+	}
+      else
+	bset_undo_list
+	  (current_buffer,
+	   Fcons (Fcons (marker, make_fixnum (adjustment)),
+		  BVAR (current_buffer, undo_list)));
+    }
+}
+
 /* Record the fact that markers in the region of FROM, TO are about to
    be adjusted.  This is done only when a marker points within text
    being deleted, because that's the only case where an automatic
@@ -126,34 +633,11 @@ record_insert (ptrdiff_t beg, ptrdiff_t length)
 static void
 record_marker_adjustments (ptrdiff_t from, ptrdiff_t to)
 {
-  prepare_record ();
+  struct marker_adjustment_region region = { from, to, current_undo_log () };
 
-  for (struct Lisp_Marker *m = BUF_MARKERS (current_buffer); m; m = m->next)
-    {
-      ptrdiff_t charpos = m->charpos;
-      eassert (charpos <= Z);
-
-      if (from <= charpos && charpos <= to)
-        {
-          /* insertion_type nil markers will end up at the beginning of
-             the re-inserted text after undoing a deletion, and must be
-             adjusted to move them to the correct place.
-
-             insertion_type t markers will automatically move forward
-             upon re-inserting the deleted text, so we have to arrange
-             for them to move backward to the correct position.  */
-	  ptrdiff_t adjustment = (m->insertion_type ? to : from) - charpos;
-
-          if (adjustment)
-            {
-	      Lisp_Object marker = make_lisp_ptr (m, Lisp_Vectorlike);
-              bset_undo_list
-                (current_buffer,
-                 Fcons (Fcons (marker, make_fixnum (adjustment)),
-                        BVAR (current_buffer, undo_list)));
-            }
-        }
-    }
+  prepare_record ();
+  traverse_markers (current_buffer, from, to,
+		    record_marker_adjustment, &region);
 }
 
 /* Record that a deletion is about to take place, of the characters in
@@ -163,6 +647,7 @@ record_marker_adjustments (ptrdiff_t from, ptrdiff_t to)
 record_delete (ptrdiff_t beg, Lisp_Object string, bool record_markers)
 {
   Lisp_Object sbeg;
+  struct undo_log *log;
 
   if (EQ (BVAR (current_buffer, undo_list), Qt))
     return;
@@ -186,6 +671,35 @@ record_delete (ptrdiff_t beg, Lisp_Object string, bool record_markers)
   if (record_markers)
     record_marker_adjustments (beg, beg + SCHARS (string));
 
+  log = current_undo_log ();
+  if (log)
+    {
+      ptrdiff_t nbytes = SBYTES (string);
+
+      /* Copy the text into the log unless it has properties.  */
+      if (string_intervals (string))
+	{
+	  undo_log_start (log, UNDO_DELETE_STRING, 2 * UNDO_INT_BYTES);
+	  undo_log_put_int (log, XFIXNUM (sbeg));
+	  undo_log_put_int (log, nbytes);
+	  undo_objects_push (&log->objects, string);
+	}
+      else
+	{
+	  bool multibyte = STRING_MULTIBYTE (string);
+	  undo_log_start (log, multibyte ? UNDO_DELETE : UNDO_DELETE_UNIBYTE,
+			  3 * UNDO_INT_BYTES + nbytes);
+	  undo_log_put_int (log, XFIXNUM (sbeg));
+	  if (multibyte)
+	    undo_log_put_int (log, SCHARS (string));
+	  undo_log_put_int (log, nbytes);
+	  memcpy (log->bytes + log->fill, SDATA (string), nbytes);
+	  log->fill += nbytes;
+	}
+      undo_log_finish (log);
+      return;
+    }
+
   bset_undo_list
     (current_buffer,
      Fcons (Fcons (string, sbeg), BVAR (current_buffer, undo_list)));
@@ -210,6 +724,7 @@ record_change (ptrdiff_t beg, ptrdiff_t length)
 record_first_change (void)
 {
   struct buffer *base_buffer = current_buffer;
+  struct undo_log *log;
 
   if (EQ (BVAR (current_buffer, undo_list), Qt))
     return;
@@ -217,6 +732,15 @@ record_first_change (void)
   if (base_buffer->base_buffer)
     base_buffer = base_buffer->base_buffer;
 
+  log = current_undo_log ();
+  if (log)
+    {
+      undo_log_start (log, UNDO_FIRST_CHANGE, 0);
+      undo_objects_push (&log->objects, Fvisited_file_modtime ());
+      undo_log_finish (log);
+      return;
+    }
+
   bset_undo_list (current_buffer,
 		  Fcons (Fcons (Qt, Fvisited_file_modtime ()),
 			 BVAR (current_buffer, undo_list)));
@@ -232,6 +756,7 @@ record_property_change (ptrdiff_t beg, ptrdiff_t length,
 {
   Lisp_Object lbeg, lend, entry;
   struct buffer *buf = XBUFFER (buffer);
+  struct undo_log *log;
 
   if (EQ (BVAR (buf, undo_list), Qt))
     return;
@@ -241,6 +766,18 @@ record_property_change (ptrdiff_t beg, ptrdiff_t length,
   if (MODIFF <= SAVE_MODIFF)
     record_first_change ();
 
+  log = current_undo_log ();
+  if (log)
+    {
+      undo_log_start (log, UNDO_PROPERTY, 2 * UNDO_INT_BYTES);
+      undo_log_put_int (log, beg);
+      undo_log_put_int (log, length);
+      undo_objects_push (&log->objects, prop);
+      undo_objects_push (&log->objects, value);
+      undo_log_finish (log);
+      return;
+    }
+
   XSETINT (lbeg, beg);
   XSETINT (lend, beg + length);
   entry = Fcons (Qnil, Fcons (prop, Fcons (value, Fcons (lbeg, lend))));
@@ -255,23 +792,37 @@ DEFUN ("undo-boundary", Fundo_boundary, Sundo_boundary, 0, 0, 0,
   (void)
 {
   Lisp_Object tem;
+  struct undo_log *log;
   if (EQ (BVAR (current_buffer, undo_list), Qt))
     return Qnil;
-  tem = Fcar (BVAR (current_buffer, undo_list));
-  if (!NILP (tem))
+  log = current_undo_log ();
+  if (log)
     {
-      /* One way or another, cons nil onto the front of the undo list.  */
-      if (!NILP (pending_boundary))
+      if (!at_undo_boundary (log))
 	{
-	  /* If we have preallocated the cons cell to use here,
-	     use that one.  */
-	  XSETCDR (pending_boundary, BVAR (current_buffer, undo_list));
-	  bset_undo_list (current_buffer, pending_boundary);
-	  pending_boundary = Qnil;
+	  undo_log_start (log, UNDO_BOUNDARY, 0);
+	  undo_log_finish (log);
+	}
+    }
+  else
+    {
+      tem = Fcar (BVAR (current_buffer, undo_list));
+      if (!NILP (tem))
+	{
+	  /* One way or another, cons nil onto the front of the undo
+	     list.  */
+	  if (!NILP (pending_boundary))
+	    {
+	      /* If we have preallocated the cons cell to use here,
+		 use that one.  */
+	      XSETCDR (pending_boundary, BVAR (current_buffer, undo_list));
+	      bset_undo_list (current_buffer, pending_boundary);
+	      pending_boundary = Qnil;
+	    }
+	  else
+	    bset_undo_list (current_buffer,
+			    Fcons (Qnil, BVAR (current_buffer, undo_list)));
 	}
-      else
-	bset_undo_list (current_buffer,
-			Fcons (Qnil, BVAR (current_buffer, undo_list)));
     }
 
   Fset (Qundo_auto__last_boundary_cause, Qexplicit);
@@ -487,4 +1038,23 @@ syms_of_undo (void)
   DEFVAR_BOOL ("undo-inhibit-record-point", undo_inhibit_record_point,
 	       doc: /* Non-nil means do not record `point' in `buffer-undo-list'.  */);
   undo_inhibit_record_point = false;
+
+  DEFVAR_LISP ("undo-log-limit", Vundo_log_limit,
+	       doc: /* If non-nil, keep undo information compactly, within this many bytes.
+If this is an integer in a buffer, changes to the buffer's text are
+recorded in a compact log until something looks at `buffer-undo-list',
+and only then do they become elements of that list.  This takes much
+less memory than the list, and garbage collection need not scan it,
+so long runs of changes made by Lisp programs are cheaper to record.
+
+The log is kept within this many bytes as changes are recorded: when
+it would grow larger, the oldest changes are forgotten, and all of
+those on `buffer-undo-list' too.  If the changes made by a single
+command don't fit, the oldest of them are forgotten as well.
+
+This variable automatically becomes buffer-local when set.  Indirect
+buffers, and buffers that have indirect buffers, don't use a log.  */);
+  Vundo_log_limit = Qnil;
+  DEFSYM (Qundo_log_limit, "undo-log-limit");
+  Fmake_variable_buffer_local (Qundo_log_limit);
 }
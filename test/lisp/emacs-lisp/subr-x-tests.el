@@ -580,5 +580,38 @@ subr-x-test-string-remove-suffix
   (should (equal (string-remove-suffix "a" "aa") "a"))
   (should (equal (string-remove-suffix "a" "ba") "b")))
 
+(ert-deftest subr-x-test-string-builder ()
+  "Test `make-string-builder' and related functions."
+  (let ((builder (make-string-builder)))
+    (should (string-builder-p builder))
+    (should (equal (string-builder-string builder) ""))
+    (should (eq (string-builder-append builder "foo" ?- "" ?\N{U+2764})
+                builder))
+    (string-builder-append-number builder 42)
+    (should (= (string-builder-length builder) 7))
+    (should (equal (string-builder-string builder) "foo-\N{U+2764}42"))
+    (should (multibyte-string-p (string-builder-string builder)))
+    ;; The result is a fresh string, and appending can continue.
+    (aset (string-builder-string builder) 0 ?x)
+    (string-builder-append builder (propertize "bar" 'face 'bold))
+    (let ((string (string-builder-string builder)))
+      (should (equal string "foo-\N{U+2764}42bar"))
+      (should (eq (get-text-property 7 'face string) 'bold))
+      (should-not (get-text-property 0 'face string)))
+    (should-error (string-builder-append builder 'foo)
+                  :type 'wrong-type-argument)))
+
+(ert-deftest subr-x-test-string-builder-many-pieces ()
+  "Test a string builder with enough pieces to be joined internally."
+  (let ((builder (make-string-builder))
+        (pieces nil))
+    (dotimes (i 2000)
+      (string-builder-append builder (number-to-string i) ?,)
+      (push (format "%d," i) pieces))
+    (should (= (string-builder-length builder)
+               (apply #'+ (mapcar #'length pieces))))
+    (should (equal (string-builder-string builder)
+                   (apply #'concat (nreverse pieces))))))
+
 (provide 'subr-x-tests)
 ;;; subr-x-tests.el ends here
@@ -51,3 +51,196 @@ record-3
     (should-not (eq x y))
     (dotimes (i 4)
       (should (eql (aref x i) (aref y i))))))
+
+(ert-deftest gc-deeply-nested-object ()
+  ;; Marking must not recurse on the C stack for each nesting level.
+  (let ((x nil))
+    (dotimes (_ 1000000)
+      (setq x (vector (list x))))
+    (garbage-collect)
+    (should (vectorp x))))
+
+(ert-deftest gc-deeply-nested-tables ()
+  ;; Nor for nested hash tables and char-tables.
+  (let ((h nil)
+        (c nil))
+    (dotimes (_ 100000)
+      (let ((table (make-hash-table :size 1)))
+        (puthash 1 h table)
+        (setq h table)))
+    (dotimes (_ 100000)
+      (let ((table (make-char-table 'alloc-tests)))
+        (set-char-table-range table nil c)
+        (setq c table)))
+    (garbage-collect)
+    (should (hash-table-p (gethash 1 h)))
+    (should (char-table-p (char-table-range c nil)))))
+
+(ert-deftest gc-free-cons-before-sweep ()
+  ;; `save-restriction' frees the cons it made on entry.  If a GC ran
+  ;; meanwhile, the cons may be in a block that has not been swept.
+  (with-temp-buffer
+    (insert "hello")
+    (narrow-to-region 2 4)
+    (save-restriction
+      (make-list 100000 nil)
+      (garbage-collect))
+    (let ((conses (list (cons 1 2) (cons 3 4))))
+      (garbage-collect)
+      (should (equal conses '((1 . 2) (3 . 4)))))))
+
+(ert-deftest gc-free-large-blocks ()
+  ;; Freeing blocks of various sizes must keep the page index used to
+  ;; find Lisp data from the C stack consistent.
+  (let ((keep nil))
+    (dotimes (i 200)
+      (let ((v (make-vector (* 100 (1+ i)) i)))
+        (when (zerop (% i 3))
+          (push v keep))))
+    (garbage-collect)
+    (dotimes (i 200)
+      (make-string (* 50 i) ?x))
+    (garbage-collect)
+    (should (= (length keep) 67))
+    (should (eql (aref (car keep) 0) 198))))
+
+(ert-deftest gc-trace ()
+  (garbage-collect)
+  (let ((n (length (gc-trace))))
+    (dotimes (_ 1000)
+      (make-vector 10 nil))
+    (garbage-collect)
+    (let ((record (car (gc-trace))))
+      (should (= (length (gc-trace)) (min 64 (1+ n))))
+      (should (floatp (nth 1 record)))
+      (should (assq 'sweep-conses (nth 2 record)))
+      (should (>= (cdr (assq 'vectors (nth 3 record))) 1000)))))
+
+(ert-deftest gc-trace-nested ()
+  ;; A finalizer that collects garbage must not disturb the record of
+  ;; the collection that ran it.
+  (let ((f (make-finalizer (lambda () (garbage-collect)))))
+    (setq f nil))
+  (garbage-collect)
+  (garbage-collect)
+  (should (assq 'finalizers (nth 2 (car (gc-trace))))))
+
+(ert-deftest gc-trace-file ()
+  (let ((file (make-temp-file "gc-trace")))
+    (unwind-protect
+        (progn
+          ;; The file name is expanded when the variable is set.
+          (let ((default-directory (file-name-directory file)))
+            (setq gc-trace-file (file-name-nondirectory file)))
+          (let ((default-directory "/"))
+            (garbage-collect))
+          (setq gc-trace-file nil)
+          (garbage-collect)
+          (with-temp-buffer
+            (insert-file-contents file)
+            (should (= (count-lines (point-min) (point-max)) 1))
+            (should (equal (length (read (current-buffer))) 4))))
+      (setq gc-trace-file nil)
+      (delete-file file))))
+
+(ert-deftest gc-pause-budget ()
+  ;; A generous budget with no limit on the heap overhead lets much
+  ;; more than `gc-cons-threshold' be allocated between collections.
+  (unwind-protect
+      (let ((gc-pause-budget 10.0)
+            (gc-max-heap-overhead nil)
+            (gc-cons-threshold 800000))
+        (garbage-collect)
+        (let ((n gcs-done))
+          (dotimes (_ 200000)
+            (cons nil nil))
+          (should (= gcs-done n))))
+    (garbage-collect)))
+
+(ert-deftest gc-trim ()
+  (let ((x (make-list 100000 "")))
+    (should (= (length x) 100000)))
+  (garbage-collect)
+  (let ((reclaimed (gc-trim)))
+    (should (or (null reclaimed) (natnump reclaimed))))
+  (should-error (gc-trim -1)))
+
+(ert-deftest profiler-alloc ()
+  (skip-unless (not (profiler-alloc-running-p)))
+  (let ((keep nil) logs)
+    (profiler-alloc-start 1024)
+    (unwind-protect
+        (progn
+          (dotimes (_ 10000)
+            (push (make-string 10 ?x) keep))
+          (garbage-collect)
+          (setq logs (profiler-alloc-log)))
+      (profiler-alloc-stop))
+    (should (= (length keep) 10000))
+    (should (= (length logs) 2))
+    (dolist (log logs)
+      (let ((types nil))
+        (maphash (lambda (backtrace bytes)
+                   (should (natnump bytes))
+                   (push (aref backtrace 0) types))
+                 log)
+        (should (memq 'strings types))))))
+
+(defun alloc-tests--weak-chain (weakness n reverse)
+  "Make N weak tables chained from a fresh key, and return (HEAD . TABLES).
+The entry of each table maps a key to the key of the next table in
+TABLES, or of the previous one if REVERSE.  Each table also gets
+entries that nothing else refers to."
+  (let* ((tables (make-vector n nil))
+         (head (list 'head))
+         (key head))
+    (dotimes (i n)
+      (aset tables i (make-hash-table :test 'eq :weakness weakness)))
+    (dotimes (i n)
+      (let ((next (list i)))
+        (puthash key next (aref tables (if reverse (- n i 1) i)))
+        (setq key next)))
+    (dotimes (i n)
+      (dotimes (j 100)
+        (puthash (list 'garbage i j) (list j) (aref tables i))))
+    (cons head tables)))
+
+(ert-deftest gc-weak-table-chains ()
+  (dolist (weakness '(key key-or-value))
+    (dolist (reverse '(nil t))
+      (let* ((n 50)
+             (chain (alloc-tests--weak-chain weakness n reverse))
+             (key (car chain))
+             (tables (cdr chain)))
+        (garbage-collect)
+        (dotimes (i n)
+          (setq key (gethash key (aref tables (if reverse (- n i 1) i))))
+          (should (equal key (list i))))
+        ;; The unreferenced entries are gone, except for the few that
+        ;; conservative stack scanning may keep.
+        (should (< (apply #'+ (mapcar #'hash-table-count tables))
+                   (* n 10)))))))
+
+(ert-deftest gc-weak-table-long-chain ()
+  ;; Each entry keeps the key of the next one alive, and the entry
+  ;; reached first comes last in the table.  This used to take a round
+  ;; over the pending entries per link.
+  (dolist (weakness '(key key-or-value))
+    (let* ((n 20000)
+           (table (make-hash-table :test 'eq :weakness weakness))
+           (keys (make-vector (1+ n) nil))
+           head)
+      (dotimes (i (1+ n))
+        (aset keys i (list i)))
+      (dotimes (i n)
+        (puthash (aref keys (- n i 1)) (aref keys (- n i)) table))
+      (dotimes (i 1000)
+        (puthash (list 'garbage i) (list i) table))
+      (setq head (aref keys 0)
+            keys nil)
+      (garbage-collect)
+      (let ((key head))
+        (dotimes (i n)
+          (setq key (gethash key table))
+          (should (equal key (list (1+ i))))))
+      (should (< (hash-table-count table) (+ n 100))))))
@@ -20,6 +20,7 @@
 ;;; Code:
 
 (require 'ert)
+(require 'seq)
 
 (ert-deftest overlay-modification-hooks-message-other-buf ()
   "Test for bug#21824.
@@ -94,4 +95,88 @@ overlay-evaporation-after-killed-buffer
       (insert "toto")
       (move-overlay ol (point-min) (point-min)))))
 
+;; Check the overlay queries against the overlays' own bounds after
+;; edits of all kinds, since the overlays are kept in a tree ordered
+;; by start position that edits must not disorder.
+
+(defun buffer-tests--overlay-ids (ovs)
+  (sort (mapcar (lambda (ov) (overlay-get ov 'id)) ovs) #'<))
+
+(defun buffer-tests--check-overlays (ovs)
+  (let ((live (seq-filter #'overlay-buffer ovs)))
+    (should (equal (buffer-tests--overlay-ids
+                    (overlays-in (point-min) (point-max)))
+                   (buffer-tests--overlay-ids live)))
+    (should (equal (buffer-tests--overlay-ids (car (overlay-lists)))
+                   (buffer-tests--overlay-ids live)))
+    (should (null (cdr (overlay-lists))))
+    (dotimes (_ 10)
+      (let* ((pos (+ (point-min) (random (1+ (buffer-size)))))
+             (end (+ pos (random (1+ (- (point-max) pos)))))
+             (bounds (mapcan (lambda (ov)
+                               (list (overlay-start ov) (overlay-end ov)))
+                             live)))
+        (should (equal (buffer-tests--overlay-ids (overlays-at pos))
+                       (buffer-tests--overlay-ids
+                        (seq-filter (lambda (ov)
+                                      (and (<= (overlay-start ov) pos)
+                                           (< pos (overlay-end ov))))
+                                    live))))
+        (should (equal (buffer-tests--overlay-ids (overlays-in pos end))
+                       (buffer-tests--overlay-ids
+                        (seq-filter
+                         (lambda (ov)
+                           (let ((s (overlay-start ov))
+                                 (e (overlay-end ov)))
+                             (if (= s e)
+                                 (or (<= pos s (1- end)) (= s pos)
+                                     (= s end (point-max)))
+                               (and (< s end) (> e pos)))))
+                         live))))
+        (should (= (next-overlay-change pos)
+                   (apply #'min (point-max)
+                          (seq-filter (lambda (b) (> b pos)) bounds))))
+        (should (= (previous-overlay-change pos)
+                   (apply #'max (point-min)
+                          (seq-filter (lambda (b) (< b pos)) bounds))))))))
+
+(ert-deftest overlay-tree-random-edits ()
+  (random "overlay-tree-random-edits")
+  (with-temp-buffer
+    (buffer-enable-undo)
+    (insert (make-string 300 ?x))
+    (let ((indirect (make-indirect-buffer (current-buffer) " *indirect*"))
+          (ovs nil))
+      (unwind-protect
+          (progn
+            (dotimes (i 80)
+              (let* ((s (1+ (random 300)))
+                     (e (min 301 (+ s (random 30))))
+                     (ov (make-overlay s e nil
+                                       (zerop (random 2)) (zerop (random 2)))))
+                (overlay-put ov 'id i)
+                (push ov ovs)))
+            (buffer-tests--check-overlays ovs)
+            (dotimes (_ 200)
+              (let ((pos (+ (point-min) (random (1+ (buffer-size))))))
+                (pcase (random 7)
+                  (0 (goto-char pos) (insert (make-string (random 5) ?y)))
+                  (1 (delete-region pos (min (point-max)
+                                             (+ pos (random 10)))))
+                  (2 (let ((ov (nth (random (length ovs)) ovs))
+                           (end (min (point-max) (+ pos (random 20)))))
+                       (move-overlay ov pos end)))
+                  (3 (when (< (+ pos 10) (point-max))
+                       (transpose-regions pos (+ pos (random 4))
+                                          (+ pos 5) (+ pos 5 (random 5)))))
+                  (4 (with-current-buffer indirect
+                       (goto-char pos)
+                       (insert-before-markers "zz")))
+                  (5 (undo-boundary)
+                     (ignore-errors (primitive-undo 1 buffer-undo-list)))
+                  (6 (goto-char pos) (insert-before-markers "w"))))
+              (undo-boundary)
+              (buffer-tests--check-overlays ovs)))
+        (kill-buffer indirect)))))
+
 ;;; buffer-tests.el ends here
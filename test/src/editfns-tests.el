@@ -385,4 +385,49 @@ test-translate-region-internal
       (translate-region-internal (point-min) (point-max) tt)
       (should (string-equal (buffer-string) "*")))))
 
+;; Each replacement is made with positions from before all of them.
+(ert-deftest replace-buffer-regions ()
+  (with-temp-buffer
+    (insert "one two three four")
+    (goto-char 5)
+    (let ((m1 (copy-marker 9))
+          (m2 (copy-marker 15)))
+      (replace-buffer-regions '((15 19 "4") (1 4 "ONE") (9 9 "[")
+                                (9 14 "3") (9 9 "<") (5 5 "x")))
+      (should (equal (buffer-string) "ONE xtwo [<3 4"))
+      (should (= m1 12))
+      (should (= m2 14))
+      ;; As with `replace-match', point stays before text inserted at it.
+      (should (= (point) 5))
+      (should-error (replace-buffer-regions '((1 3 "a") (2 4 "b"))))
+      (should-error (replace-buffer-regions '((1 3 "a") (0 4 "b")))
+                    :type 'args-out-of-range)
+      (should-error (replace-buffer-regions '((1 3 a))))
+      (should (equal (buffer-string) "ONE xtwo [<3 4"))))
+  ;; Many replacements in a random order, far from the gap.
+  (let ((edits nil))
+    (random "replace-buffer-regions")
+    (dotimes (i 500)
+      (push (list (1+ (* i 200)) (+ (* i 200) 1 (random 50))
+                  (make-string (random 100) (if (= (% i 2) 1) ?\u00e9 ?a)))
+            edits))
+    (setq edits (sort edits (lambda (a b) (< (% (* (car a) 7919) 1009)
+                                              (% (* (car b) 7919) 1009)))))
+    (with-temp-buffer
+      (insert (make-string 100000 ?b))
+      (goto-char 50000)
+      (insert ?c)
+      (delete-char -1)
+      (buffer-enable-undo)
+      (let ((expected (buffer-string)))
+        (dolist (edit (sort (copy-sequence edits)
+                            (lambda (a b) (> (car a) (car b)))))
+          (setq expected (concat (substring expected 0 (1- (car edit)))
+                                 (nth 2 edit)
+                                 (substring expected (1- (nth 1 edit))))))
+        (replace-buffer-regions edits)
+        (should (equal (buffer-string) expected)))
+      (primitive-undo 2000 buffer-undo-list)
+      (should (equal (buffer-string) (make-string 100000 ?b))))))
+
 ;;; editfns-tests.el ends here
@@ -147,3 +147,58 @@ fileio-tests--file-name-absolute-p
       (should (file-name-absolute-p (concat "~" user-login-name suffix))))
     (unless (user-full-name "nosuchuser")
       (should (not (file-name-absolute-p (concat "~nosuchuser" suffix)))))))
+
+(ert-deftest fileio-tests--insert-file-contents-mapped ()
+  "Test inserting a file literally by mapping it into memory."
+  (let ((f (make-temp-file "fileio"))
+        (text (apply #'concat
+                     (mapcar (lambda (i) (format "line %d \351\n" i))
+                             (number-sequence 1 5000)))))
+    (unwind-protect
+        (let ((coding-system-for-write 'no-conversion))
+          (write-region text nil f nil 'silent)
+          (with-temp-buffer
+            (let ((large-file-map-threshold 1))
+              (insert-file-contents-literally f t))
+            (should-not enable-multibyte-characters)
+            (should-not (buffer-modified-p))
+            (should (equal (buffer-string) (string-to-unibyte text)))
+            (should (re-search-forward "^line 4321 " nil t))
+            ;; The first change copies the text to ordinary memory.
+            (insert "x")
+            (goto-char (point-max))
+            (insert "end\n")
+            (should (equal (buffer-string)
+                           (string-to-unibyte
+                            (replace-regexp-in-string
+                             "^line 4321 " "line 4321 x"
+                             (concat text "end\n"))))))
+          ;; Truncating a mapped file does not crash Emacs.
+          (with-temp-buffer
+            (set-buffer-multibyte nil)
+            (let ((large-file-map-threshold 1))
+              (insert-file-contents-literally f))
+            (write-region "short\n" nil f nil 'silent)
+            (should (= (buffer-size) (length text)))
+            (should (memq (char-before (point-max)) '(0 ?\n)))))
+      (delete-file f))))
+
+(ert-deftest fileio-tests--write-region-mapped ()
+  "Test writing a buffer mapped from a file back to that file."
+  (let ((f (make-temp-file "fileio"))
+        (text (apply #'concat
+                     (mapcar (lambda (i) (format "line %d \351\n" i))
+                             (number-sequence 1 5000)))))
+    (unwind-protect
+        (let ((coding-system-for-write 'no-conversion))
+          (write-region text nil f nil 'silent)
+          (with-temp-buffer
+            (let ((large-file-map-threshold 1))
+              (insert-file-contents-literally f t))
+            (write-region nil nil f nil 'silent)
+            (should (equal (buffer-string) (string-to-unibyte text))))
+          (with-temp-buffer
+            (set-buffer-multibyte nil)
+            (insert-file-contents-literally f)
+            (should (equal (buffer-string) (string-to-unibyte text)))))
+      (delete-file f))))
@@ -166,6 +166,106 @@ fns-tests-sort
   (should (equal (should-error (sort "cba" #'<) :type 'wrong-type-argument)
                  '(wrong-type-argument list-or-vector-p "cba"))))
 
+(ert-deftest fns-tests-sort-key ()
+  (let ((calls 0)
+        (seq (list '(3 . a) '(1 . b) '(3 . c) '(2 . d) '(1 . e))))
+    (should (equal (sort seq #'< :key (lambda (x) (setq calls (1+ calls))
+                                        (car x)))
+                   '((1 . b) (1 . e) (2 . d) (3 . a) (3 . c))))
+    ;; The key function is called once per element, not per comparison.
+    (should (= calls 5))
+    ;; A list is sorted within its own cons cells.
+    (should (equal seq '((1 . b) (1 . e) (2 . d) (3 . a) (3 . c)))))
+  (should (equal (sort (vector "bb" "a" "ccc" "" "dd") #'> :key #'length)
+                 ["ccc" "bb" "dd" "a" ""]))
+  (should (equal (sort (list 2 1 3) #'< :key nil) '(1 2 3)))
+  (should-error (sort (list 2 1) #'< :test #'car))
+  (should-error (sort (list 2 1) #'< :key)))
+
+(ert-deftest fns-tests-sort-runs ()
+  ;; Sequences long enough to be merged, with and without presorted
+  ;; runs, and with the built-in predicates that avoid `funcall'.
+  (let* ((n 1000)
+         (up (number-sequence 0 (1- n)))
+         (down (reverse up))
+         (saw (append (number-sequence 0 (1- n) 2)
+                      (number-sequence 1 (1- n) 2)))
+         (shuffled (let ((v (vconcat up)))
+                     (dotimes (i n)
+                       (let* ((j (+ i (random (- n i))))
+                              (tem (aref v i)))
+                         (aset v i (aref v j))
+                         (aset v j tem)))
+                     (append v nil))))
+    (dolist (seq (list up down saw shuffled))
+      (should (equal (sort (copy-sequence seq) #'<) up))
+      (should (equal (sort (copy-sequence seq) #'>) down))
+      (should (equal (sort (vconcat seq) (lambda (a b) (< a b)))
+                     (vconcat up)))
+      (should (equal (sort (mapcar #'float seq) #'<) (mapcar #'float up))))
+    ;; Stability across merges.
+    (let ((pairs (mapcar (lambda (x) (cons (% x 7) x)) shuffled)))
+      (should (equal (sort (copy-sequence pairs) #'< :key #'car)
+                     (sort (copy-sequence pairs)
+                           (lambda (a b) (< (car a) (car b)))))))
+    (should (equal (sort (mapcar #'number-to-string shuffled) #'string<)
+                   (sort (mapcar #'number-to-string up)
+                         (lambda (a b) (string< a b)))))
+    ;; The fast paths signal like the predicates they replace.
+    (should-error (sort (list 1 'a 2) #'<) :type 'wrong-type-argument)
+    ;; A nonlocal exit from the predicate loses no elements.
+    (let ((v (vconcat shuffled))
+          (count 0))
+      (catch 'done
+        (sort v (lambda (a b)
+                  (when (> (setq count (1+ count)) 3000)
+                    (throw 'done nil))
+                  (< a b))))
+      (should (equal (sort v #'<) (vconcat up))))))
+
+(ert-deftest string-search ()
+  (should (equal (string-search "zot" "foobarzot") 6))
+  (should (equal (string-search "foo" "foobarzot") 0))
+  (should-not (string-search "fooz" "foobarzot"))
+  (should-not (string-search "zot" "barfoo"))
+  (should (equal (string-search "ab" "ab") 0))
+  (should-not (string-search "ab\0" "ab"))
+  (should (equal (string-search "ab" "abababab" 3) 4))
+  (should-not (string-search "ab" "ababac" 3))
+  (should-not (string-search "aaa" "aa"))
+  (should (equal (string-search "" "abc") 0))
+  (should (equal (string-search "" "abc" 3) 3))
+  (let ((case-fold-search t))
+    (should-not (string-search "ab" "AB")))
+  ;; Positions are in characters.
+  (should (equal (string-search "fóo" "zotfóo") 3))
+  (should (equal (string-search "ó" "fóoó" 2) 3))
+  (should (equal (string-search "o" "fóoó") 2))
+  (should (equal (string-search (make-string 2 130)
+	                        (concat "helló" (make-string 5 130 t) "bár"))
+                 5))
+  ;; Raw bytes in unibyte and multibyte strings.
+  (should (equal (string-search "\377" "a\377ø") 1))
+  (should (equal (string-search "\377" "a\377a") 1))
+  (should-not (string-search (make-string 1 255) "a\377ø"))
+  (should-not (string-search (make-string 1 255) "a\377a"))
+  (should (equal (string-search (string-to-multibyte "\377") "ab\377c") 2))
+  (should-not (string-search "ø" "a\370"))
+  (should (equal (string-search "\303" "\303") 0))
+  (should-not (string-search "\303" "ø"))
+  ;; Case folding.
+  (should (equal (string-search "ab" "xAB" nil t) 1))
+  (should (equal (string-search "B" "AbB" 2 t) 2))
+  (should (equal (string-search "ÉT" "l'été" nil t) 2))
+  (should-not (string-search "ÉT" "l'été"))
+  ;; The match data is left alone.
+  (string-match "b" "abc")
+  (string-search "c" "abc")
+  (should (equal (match-data) '(1 2)))
+  (should-error (string-search "a" "abc" -1) :type 'args-out-of-range)
+  (should-error (string-search "a" "abc" 4) :type 'args-out-of-range)
+  (should-error (string-search "a" 'abc) :type 'wrong-type-argument))
+
 (ert-deftest fns-tests-collate-sort ()
   (skip-unless (fns-tests--collate-enabled-p))
 
@@ -412,6 +512,92 @@ fns-tests-base64-decode-string
   (should (eq :got-error (condition-case () (base64-decode-string "Zm9vYmFy=") (error :got-error))))
   (should (eq :got-error (condition-case () (base64-decode-string "Zg=Zg=") (error :got-error)))))
 
+;; The region commands convert large regions in chunks.
+(defun fns-tests--base64-data (length)
+  "Return a unibyte string of LENGTH pseudo-random bytes."
+  (let ((data (make-string length 0)))
+    (random "fns-tests--base64-data")
+    (dotimes (i length)
+      (aset data i (random 256)))
+    data))
+
+(ert-deftest fns-tests-base64-large ()
+  (dolist (length '(0 1 2 3 56 57 58 100000 300001))
+    (let* ((data (fns-tests--base64-data length))
+           (encoded (base64-encode-string data))
+           (encoded-url (base64url-encode-string data t)))
+      (should (equal (base64-decode-string encoded) data))
+      (should (equal (base64-decode-string encoded-url t) data))
+      (should (equal (fns-tests--with-region base64-encode-region data)
+                     encoded))
+      (should (equal (fns-tests--with-region base64url-encode-region data t)
+                     encoded-url))
+      (should (equal (fns-tests--with-region base64-decode-region encoded)
+                     (string-to-multibyte data)))
+      (should (equal (fns-tests--with-region base64-decode-region
+                       encoded-url t)
+                     (string-to-multibyte data)))
+      ;; Raw bytes in multibyte text are encoded as the bytes.
+      (should (equal (base64-encode-string (string-to-multibyte data))
+                     encoded))
+      (should (equal (fns-tests--with-region base64-encode-region
+                       (string-to-multibyte data))
+                     encoded))
+      (with-temp-buffer
+        (set-buffer-multibyte nil)
+        (insert encoded)
+        (should (= (base64-decode-region (point-min) (point-max))
+                   length))
+        (should (equal (buffer-string) data))))))
+
+(ert-deftest fns-tests-base64-region-chunks ()
+  (let* ((data (fns-tests--base64-data 200000))
+         (encoded (base64-encode-string data t)))
+    ;; Whitespace may separate the characters of a quadruplet, and
+    ;; padding may be followed by more data.
+    (should (equal (fns-tests--with-region base64-decode-region
+                     (mapconcat #'string encoded " "))
+                   (string-to-multibyte data)))
+    (should (equal (fns-tests--with-region base64-decode-region
+                     (concat encoded "Zg=\n\n=" encoded))
+                   (string-to-multibyte (concat data "f" data))))
+    ;; Markers and point outside the region stay where they were
+    ;; relative to the text, and the change can be undone.
+    (with-temp-buffer
+      (buffer-enable-undo)
+      (insert "<" data ">")
+      (let ((before (copy-marker 2))
+            (after (copy-marker (1- (point-max)))))
+        (goto-char (point-max))
+        (undo-boundary)
+        (should (= (base64-encode-region 2 (1- (point-max)) t)
+                   (length encoded)))
+        (should (equal (buffer-string) (concat "<" encoded ">")))
+        (should (= before 2))
+        (should (= after (- (point-max) 1)))
+        (should (= (point) (point-max)))
+        (primitive-undo 1 buffer-undo-list)
+        (should (equal (buffer-string) (string-to-multibyte
+                                        (concat "<" data ">"))))))
+    ;; Invalid data leaves the buffer alone, wherever it occurs.
+    (dolist (bad (list (concat encoded "Zg=")
+                       (concat encoded "!")
+                       (concat encoded "Zm9")
+                       (concat "Z!" encoded)
+                       (concat (substring encoded 0 100000) "\u00e9"
+                               (substring encoded 100000))))
+      (with-temp-buffer
+        (insert bad)
+        (set-buffer-modified-p nil)
+        (should-error (base64-decode-region (point-min) (point-max)))
+        (should (equal (buffer-string) bad))
+        (should-not (buffer-modified-p))))
+    (with-temp-buffer
+      (insert data "\u20ac")
+      (set-buffer-modified-p nil)
+      (should-error (base64-encode-region (point-min) (point-max)))
+      (should-not (buffer-modified-p)))))
+
 (ert-deftest fns-tests-hash-buffer ()
   (should (equal (sha1 "foo") "0beec7b5ea3f0fdbc95d0dd47f3c5bc275da8a33"))
   (should (equal (with-temp-buffer
@@ -428,6 +614,92 @@ fns-tests-hash-buffer
                    (buffer-hash))
                  (sha1 "foo"))))
 
+;; Buffer text is hashed a chunk at a time, across the gap.
+(ert-deftest fns-tests-secure-hash-buffer ()
+  (let ((text (apply #'concat
+                     (mapcar (lambda (i)
+                               (format "%d: ascii \u00e9\u65e5\u672c\n" i))
+                             (number-sequence 1 10000)))))
+    (dolist (coding '(utf-8-unix utf-8-dos utf-8-with-signature utf-16
+                      iso-2022-jp euc-jp raw-text))
+      (with-temp-buffer
+        (insert text)
+        (goto-char (/ (point-max) 3))
+        (insert "x")
+        (delete-char -1)
+        (dolist (algorithm '(md5 sha1 sha256 sha512))
+          (let ((coding-system-for-write coding))
+            (should (equal (secure-hash algorithm (current-buffer))
+                           (secure-hash algorithm
+                                        (encode-coding-string text coding))))
+            (should (equal (secure-hash algorithm (current-buffer) 1000 90000)
+                           (secure-hash algorithm
+                                        (encode-coding-string
+                                         (substring text 999 89999)
+                                         coding))))))
+        (should (equal (md5 (current-buffer) nil nil coding)
+                       (md5 (encode-coding-string text coding))))))
+    ;; Text that is all ASCII at the end still needs the encoder to
+    ;; finish its output.
+    (with-temp-buffer
+      (insert "\u65e5" (make-string 70000 ?a))
+      (let ((coding-system-for-write 'iso-2022-jp))
+        (should (equal (sha1 (current-buffer))
+                       (sha1 (encode-coding-string (buffer-string)
+                                                   'iso-2022-jp))))))
+    (with-temp-buffer
+      (set-buffer-multibyte nil)
+      (insert (encode-coding-string text 'utf-8))
+      (goto-char 100)
+      (insert "x")
+      (delete-char -1)
+      (should (equal (secure-hash 'sha256 (current-buffer))
+                     (secure-hash 'sha256
+                                  (encode-coding-string text 'utf-8)))))))
+
+;; Buffer text is hashed a chunk of 1 MiB characters at a time.
+(ert-deftest fns-tests-secure-hash-buffer-chunks ()
+  (let* ((line "ascii \u00e9\u65e5\u672c \U0001F600\n")
+         (text (apply #'concat (make-list (/ 2500000 (length line)) line)))
+         (start 1000)
+         (end (- (length text) 1000)))
+    (with-temp-buffer
+      (insert text)
+      ;; Put the gap in the middle of the second chunk.
+      (goto-char 1500000)
+      (insert "x")
+      (delete-char -1)
+      (dolist (coding '(utf-8-unix utf-8-dos utf-16 iso-2022-jp))
+        (let ((coding-system-for-write coding))
+          (should (equal (sha1 (current-buffer))
+                         (sha1 (encode-coding-string text coding))))
+          (should (equal (sha1 (current-buffer) start end)
+                         (sha1 (encode-coding-string
+                                (substring text (1- start) (1- end))
+                                coding)))))))))
+
+(ert-deftest fns-tests-secure-hash-file ()
+  (let ((file (make-temp-file "fns-tests"))
+        (data (apply #'unibyte-string
+                     (mapcar (lambda (i) (% (* i 7) 256))
+                             (number-sequence 0 99999)))))
+    (unwind-protect
+        (progn
+          (let ((coding-system-for-write 'no-conversion))
+            (write-region data nil file nil 'silent))
+          (dolist (algorithm (secure-hash-algorithms))
+            (should (equal (secure-hash-file algorithm file)
+                           (secure-hash algorithm data)))
+            (should (equal (secure-hash-file algorithm file t)
+                           (secure-hash algorithm data nil nil t))))
+          (write-region "" nil file nil 'silent)
+          (should (equal (secure-hash-file 'sha1 file) (sha1 "")))
+          (should-error (secure-hash-file 'sha3 file))
+          (delete-file file)
+          (should-error (secure-hash-file 'sha1 file) :type 'file-missing))
+      (when (file-exists-p file)
+        (delete-file file)))))
+
 (ert-deftest fns-tests-mapcan ()
   (should-error (mapcan))
   (should-error (mapcan #'identity))
@@ -786,6 +1058,58 @@ test-string-distance
   (should (equal 1 (string-distance "ab" "a我b")))
   (should (equal 1 (string-distance "我" "她"))))
 
+(defun fns-tests--string-distance (s1 s2)
+  "Return the Levenshtein distance between S1 and S2, the slow way."
+  (let ((column (vconcat (number-sequence 0 (length s1)))))
+    (dotimes (x (length s2))
+      (let ((new (make-vector (1+ (length s1)) (1+ x))))
+        (dotimes (y (length s1))
+          (aset new (1+ y)
+                (min (1+ (aref column (1+ y))) (1+ (aref new y))
+                     (+ (aref column y)
+                        (if (eq (aref s1 y) (aref s2 x)) 0 1)))))
+        (setq column new)))
+    (aref column (length s1))))
+
+(ert-deftest test-string-distance-long ()
+  "Test `string-distance' on strings that need several words."
+  (random "test-string-distance-long")
+  (dolist (alphabet '("ab" "abcdefghij" "ab\u00e9\u6211\u5979\U0001F600"))
+    (dolist (len1 '(0 1 5 63 64 65 130 200))
+      (dolist (len2 '(0 3 64 70 129))
+        (let ((s1 (make-string len1 ?a (multibyte-string-p alphabet)))
+              (s2 (make-string len2 ?a (multibyte-string-p alphabet))))
+          (dolist (s (list s1 s2))
+            (dotimes (i (length s))
+              (aset s i (aref alphabet (random (length alphabet))))))
+          (let ((d (fns-tests--string-distance s1 s2)))
+            (should (= (string-distance s1 s2) d))
+            (should (= (string-distance s2 s1) d))
+            (should (equal (string-distances s1 (list s2 s1)) (vector d 0)))
+            (should (equal (string-distances s1 (vector s2) nil d)
+                           (vector d)))
+            (when (> d 0)
+              (should (equal (string-distances s1 (vector s2) nil (1- d))
+                             [nil]))))))))
+  ;; Many distinct characters use the plain algorithm.
+  (let ((s1 (apply #'string (number-sequence #x4e00 (+ #x4e00 299))))
+        (s2 (apply #'string (number-sequence #x4e00 (+ #x4e00 599) 2))))
+    (should (= (string-distance s1 s2) (fns-tests--string-distance s1 s2)))))
+
+(ert-deftest test-string-distances ()
+  (should (equal (string-distances "kitten" '("sitting" "kitten" "" "mitten"))
+                 [3 0 6 1]))
+  (should (equal (string-distances "kitten" ["sitting" "kitten" "" "mitten"]
+                                   nil 1)
+                 [nil 0 nil 1]))
+  (should (equal (string-distances "ab" ["ab\u6211\u5979" "a\u6211b"] t)
+                 [6 3]))
+  (should (equal (string-distances "ab" ["ab\u6211\u5979" "a\u6211b"])
+                 [2 1]))
+  (should (equal (string-distances "" []) []))
+  (should-error (string-distances "a" ["a" b]) :type 'wrong-type-argument)
+  (should-error (string-distances "a" "a") :type 'wrong-type-argument))
+
 (ert-deftest test-bignum-eql ()
   "Test that `eql' works for bignums."
   (let ((x (+ most-positive-fixnum 1))
@@ -858,4 +1182,104 @@ test-hash-function-that-mutates-hash-table
        (puthash k k h)))
     (should (= 100 (hash-table-count h)))))
 
+(ert-deftest test-hash-table-wide-hash-codes ()
+  "Test hash codes whose high-order bits decide the index slot."
+  (define-hash-table-test 'fns-tests-wide-eq 'eql
+    (lambda (k) (* k most-positive-fixnum)))
+  (dolist (test '(eq eql equal fns-tests-wide-eq))
+    (let ((h (make-hash-table :test test)))
+      (dotimes (i 5000)
+        (puthash (ash i 32) i h)
+        (puthash (- i) i h))
+      (should (= (hash-table-count h) 9999))
+      (dotimes (i 5000)
+        (should (eq (gethash (ash i 32) h) i))
+        (should (eq (gethash (- i) h) i)))
+      (dotimes (i 5000)
+        (remhash (ash i 32) h))
+      (should (= (hash-table-count h) 4999))
+      (should-not (gethash (ash 7 32) h))
+      (should (eq (gethash -7 h) 7)))))
+
+;; Removing and adding keys without growing the table leaves deleted
+;; slots in its index, which must be reused or dropped.
+(ert-deftest test-hash-table-churn ()
+  (define-hash-table-test 'fns-tests-constant-eq 'eql (lambda (_) 0))
+  (dolist (test '(eq equal fns-tests-constant-eq))
+    (let ((h (make-hash-table :test test :size 200))
+          (keys (make-vector 100 nil)))
+      (dotimes (i 100)
+        (aset keys i i)
+        (puthash i i h))
+      (dotimes (n 5000)
+        (let* ((j (% (* n 37) 100))
+               (old (aref keys j))
+               (new (+ 100 n)))
+          (should (eq (gethash old h) old))
+          (remhash old h)
+          (should-not (gethash old h))
+          (puthash new new h)
+          (aset keys j new)))
+      (should (= (hash-table-count h) 100))
+      (dotimes (j 100)
+        (should (eq (gethash (aref keys j) h) (aref keys j))))
+      (should-not (gethash 42 h)))))
+
+(ert-deftest test-sxhash-equal-distribution ()
+  "Test that `sxhash-equal' tells apart similar strings and lists."
+  (let ((seen (make-hash-table)))
+    (dotimes (i 100)
+      (dotimes (j 100)
+        (puthash (sxhash-equal (list i j)) t seen)))
+    (should (< 9900 (hash-table-count seen))))
+  (should-not (= (sxhash-equal "a") (sxhash-equal "a\0")))
+  (dotimes (len 20)
+    (let ((s (make-string len ?x)))
+      (should (= (sxhash-equal s) (sxhash-equal (copy-sequence s))))
+      (unless (zerop len)
+        (should-not (= (sxhash-equal s)
+                       (sxhash-equal (concat (substring s 1) "y"))))))))
+
+(ert-deftest test-hash-table-shrink ()
+  "Test that hash tables shrink after removing most entries."
+  (let ((h (make-hash-table :test 'equal)))
+    (dotimes (i 10000)
+      (puthash (number-to-string i) i h))
+    (let ((size (hash-table-size h)))
+      (dotimes (i 9990)
+        (remhash (number-to-string i) h))
+      (should (< (hash-table-size h) (/ size 8))))
+    (should (= (hash-table-count h) 10))
+    (dotimes (i 10)
+      (should (eq (gethash (number-to-string (+ 9990 i)) h) (+ 9990 i))))
+    (clrhash h)
+    (should (<= (hash-table-size h) 65)))
+  ;; Removing entries within `maphash' must not make it skip any.
+  (let ((h (make-hash-table))
+        (visited 0))
+    (dotimes (i 1000)
+      (puthash i i h))
+    (maphash (lambda (k _)
+               (setq visited (1+ visited))
+               (remhash k h))
+             h)
+    (should (= visited 1000))
+    (should (= (hash-table-count h) 0))))
+
+(ert-deftest test-compact-hash-table ()
+  (let ((h (make-hash-table :size 1000)))
+    (dotimes (i 100)
+      (puthash i (* i i) h))
+    (should (eq (compact-hash-table h) h))
+    (should (= (hash-table-size h) 100))
+    (dotimes (i 100)
+      (should (= (gethash i h) (* i i))))
+    (puthash 100 0 h)
+    (should (= (hash-table-count h) 101))
+    (clrhash h)
+    (compact-hash-table h)
+    (should (= (hash-table-count h) 0))
+    (puthash 'a 1 h)
+    (should (= (gethash 'a h) 1))))
+
 (provide 'fns-tests)
@@ -220,4 +220,27 @@ lread-string-to-number-trailing-dot
                    (* most-positive-fixnum most-positive-fixnum)))
     (should (= n (string-to-number (format "%d." n))))))
 
+(ert-deftest lread-intern-one-bucket ()
+  "Test an obarray where all symbols share a bucket."
+  (let ((ob (make-vector 1 0))
+        (names (mapcar (lambda (i) (format "s%d" i)) (number-sequence 0 499))))
+    (dolist (name names)
+      (intern name ob))
+    (dolist (name names)
+      (should (equal (symbol-name (intern-soft name ob)) name)))
+    (should-not (intern-soft "s500" ob))
+    (should-not (intern-soft (make-symbol "s1") ob))
+    (should (unintern "s1" ob))
+    (should-not (intern-soft "s1" ob))
+    (should (intern-soft "s2" ob))
+    (let ((n 0))
+      (mapatoms (lambda (_) (setq n (1+ n))) ob)
+      (should (= n 499)))
+    ;; Names with the same bytes but different multibyteness.
+    (let ((unibyte (intern "\303\251" ob))
+          (multibyte (intern "\u00e9" ob)))
+      (should-not (eq unibyte multibyte))
+      (should (eq (intern-soft "\303\251" ob) unibyte))
+      (should (eq (intern-soft "\u00e9" ob) multibyte)))))
+
 ;;; lread-tests.el ends here
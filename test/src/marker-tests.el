@@ -20,6 +20,7 @@
 ;;; Code:
 
 (require 'ert)
+(require 'cl-lib)
 
 ;; The following three tests assert that Emacs survives operations
 ;; copying a marker whose character position differs from its byte
@@ -57,4 +58,112 @@ marker-goto-char-from-other-buffer
     (set-marker marker-2 marker-1)
     (should (goto-char marker-2))))
 
+;; Many markers are kept in an index ordered by position; check that
+;; edits move them as they would move without it.
+
+(ert-deftest marker-many-markers-follow-edits ()
+  (random "marker-many-markers-follow-edits")
+  (with-temp-buffer
+    (let (markers expected)
+      (dotimes (i 2000)
+        (insert (if (zerop (% i 3)) "é" "a")))
+      (dotimes (_ 1000)
+        (let ((m (copy-marker (1+ (random (point-max))) (zerop (random 2)))))
+          (push m markers)
+          (push (marker-position m) expected)))
+      (setq markers (vconcat markers) expected (vconcat expected))
+      (dotimes (_ 500)
+        (let ((pos (1+ (random (point-max))))
+              (op (random 5)))
+          (cond
+           ((< op 2)
+            ;; Insert, possibly before markers.
+            (goto-char pos)
+            (if (zerop op) (insert "xλ") (insert-before-markers "xλ"))
+            (dotimes (i (length expected))
+              (let ((e (aref expected i)))
+                (when (or (> e pos)
+                          (and (= e pos)
+                               (or (= op 1)
+                                   (marker-insertion-type
+                                    (aref markers i)))))
+                  (aset expected i (+ e 2))))))
+           ((< op 4)
+            ;; Delete.
+            (let ((end (min (point-max) (+ pos (random 20)))))
+              (delete-region pos end)
+              (dotimes (i (length expected))
+                (let ((e (aref expected i)))
+                  (cond ((> e end) (aset expected i (- e (- end pos))))
+                        ((> e pos) (aset expected i pos)))))))
+           (t
+            ;; Move a marker.
+            (let ((i (random (length markers))))
+              (set-marker (aref markers i) pos)
+              (aset expected i pos))))))
+      (dotimes (i (length markers))
+        (should (= (marker-position (aref markers i)) (aref expected i)))
+        (should (= (position-bytes (aref expected i))
+                   (1+ (string-bytes
+                        (buffer-substring 1 (aref expected i)))))))
+      ;; Markers that are collected go away from the index.
+      (setq markers nil)
+      (garbage-collect)
+      (should (= (position-bytes (point-max))
+                 (1+ (string-bytes (buffer-string))))))))
+
+;; Large multibyte texts keep checkpoints of the correspondence
+;; between character and byte positions; check that edits keep them
+;; right.
+
+(ert-deftest marker-charpos-checkpoints-follow-edits ()
+  (random "marker-charpos-checkpoints-follow-edits")
+  (with-temp-buffer
+    (let ((pieces ["abc" "é" "λx" "日本語" "ß" "\n" "🙂"])
+          model)
+      (cl-flet ((check ()
+                  (dotimes (_ 20)
+                    (let* ((pos (1+ (random (point-max))))
+                           (byte (1+ (string-bytes
+                                      (substring model 0 (1- pos))))))
+                      (should (= (position-bytes pos) byte))
+                      (should (= (byte-to-position byte) pos))))))
+        (dotimes (_ 40000)
+          (insert (aref pieces (random (length pieces)))))
+        (setq model (buffer-string))
+        (check)
+        (dotimes (_ 100)
+          (let ((pos (1+ (random (point-max))))
+                (op (random 4)))
+            (cond
+             ((zerop op)
+              (let ((text (aref pieces (random (length pieces)))))
+                (goto-char pos)
+                (insert text)
+                (setq model (concat (substring model 0 (1- pos)) text
+                                    (substring model (1- pos))))))
+             ((= op 1)
+              (let ((end (min (point-max) (+ pos (random 10000)))))
+                (delete-region pos end)
+                (setq model (concat (substring model 0 (1- pos))
+                                    (substring model (1- end))))))
+             ((= op 2)
+              ;; Upcasing "ß" makes the text longer.
+              (let ((end (min (point-max) (+ pos (random 100)))))
+                (upcase-region pos end)
+                (setq model (concat (substring model 0 (1- pos))
+                                    (upcase (substring model (1- pos)
+                                                       (1- end)))
+                                    (substring model (1- end))))))
+             (t
+              (let* ((end1 (min (point-max) (+ pos (random 50))))
+                     (end2 (min (point-max) (+ end1 (random 50)))))
+                (transpose-regions pos end1 end1 end2)
+                (setq model (concat (substring model 0 (1- pos))
+                                    (substring model (1- end1) (1- end2))
+                                    (substring model (1- pos) (1- end1))
+                                    (substring model (1- end2)))))))
+            (check)))
+        (should (equal (buffer-string) model))))))
+
 ;;; marker-tests.el ends here.
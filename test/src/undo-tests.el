@@ -466,5 +466,111 @@ undo-test-skip-invalidated-markers
     (undo-boundary)
     (undo)))
 
+;; Undo logs
+
+(defun undo-test--log-edits (limit)
+  "Make random changes in a new buffer, and return its undo list.
+Record undo information in a log of at most LIMIT bytes, or on the
+undo list if LIMIT is nil.  Markers in the list are replaced by
+their positions."
+  (random "undo-log")
+  (with-temp-buffer
+    (buffer-enable-undo)
+    (setq undo-log-limit limit)
+    (let ((markers nil)
+          (texts ["a" "bc" "\n" "é" "日本" "\x80"]))
+      (dotimes (_ 3000)
+        (let ((beg (1+ (random (1+ (buffer-size)))))
+              (end (1+ (random (1+ (buffer-size))))))
+          (pcase (random 9)
+            ((or 0 1) (goto-char beg)
+             (insert (aref texts (random (length texts)))))
+            (2 (goto-char beg)
+               (insert (propertize "p" 'face 'bold)))
+            (3 (delete-region beg end))
+            (4 (put-text-property (min beg end) (max beg end)
+                                  'undo-test (random 3)))
+            (5 (push (copy-marker beg (zerop (random 2))) markers))
+            (6 (undo-boundary))
+            (7 (ignore buffer-undo-list))
+            (8 (when (zerop (random 20))
+                 (garbage-collect)))))))
+    (mapcar (lambda (elt)
+              (if (and (consp elt) (markerp (car elt)))
+                  (cons (marker-position (car elt)) (cdr elt))
+                elt))
+            buffer-undo-list)))
+
+(ert-deftest undo-test-log ()
+  "Test that an undo log records the same as the undo list."
+  (should (equal-including-properties
+           (undo-test--log-edits most-positive-fixnum)
+           (undo-test--log-edits nil))))
+
+(ert-deftest undo-test-log-undo ()
+  "Test undoing changes recorded in an undo log."
+  (with-temp-buffer
+    (buffer-enable-undo)
+    (setq undo-log-limit most-positive-fixnum)
+    (insert "hello")
+    (undo-boundary)
+    (let ((m (copy-marker 3))
+          pending)
+      (delete-region 2 5)
+      (undo-boundary)
+      (put-text-property 1 3 'face 'bold)
+      (undo-boundary)
+      (goto-char (point-min))
+      (insert "é")
+      (undo-boundary)
+      (setq pending (primitive-undo 1 (cdr buffer-undo-list)))
+      (should (equal-including-properties (buffer-string)
+                                          #("ho" 0 2 (face bold))))
+      (setq pending (primitive-undo 1 pending))
+      (should (equal (buffer-string) "ho"))
+      (should-not (get-text-property 1 'face))
+      (setq pending (primitive-undo 1 pending))
+      (should (equal (buffer-string) "hello"))
+      (should (= m 3))
+      (primitive-undo 1 pending)
+      (should (equal (buffer-string) "")))))
+
+(ert-deftest undo-test-log-limit ()
+  "Test that an undo log forgets the oldest changes to stay small."
+  (with-temp-buffer
+    (dotimes (i 1000)
+      (insert (format "line%d\n" i)))
+    (let ((text (buffer-string)))
+      (buffer-enable-undo)
+      (setq undo-log-limit 2000)
+      (while (> (buffer-size) 0)
+        (goto-char (point-min))
+        (delete-region (point) (line-beginning-position 2))
+        (undo-boundary))
+      (should (null (car buffer-undo-list)))
+      (primitive-undo (length buffer-undo-list) buffer-undo-list)
+      (should (< 1000 (buffer-size) 2000))
+      (should (string-suffix-p (buffer-string) text)))))
+
+;; `subst-char-in-region' turns recording off while it runs, and
+;; change hooks that read the list meanwhile must not lose what the
+;; log holds.
+(ert-deftest undo-test-log-noundo ()
+  (let (lengths)
+    (dolist (limit '(nil 100000))
+      (with-temp-buffer
+        (buffer-enable-undo)
+        (setq undo-log-limit limit)
+        (insert "hello")
+        (undo-boundary)
+        (insert " world")
+        (add-hook 'before-change-functions
+                  (lambda (_beg _end) buffer-undo-list) nil t)
+        (subst-char-in-region 1 6 ?l ?L t)
+        (should (equal (buffer-string) "heLLo world"))
+        (push (length buffer-undo-list) lengths)))
+    (should (= (car lengths) (cadr lengths)))
+    (should (< 0 (car lengths)))))
+
 (provide 'undo-tests)
 ;;; undo-tests.el ends here